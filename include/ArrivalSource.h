@@ -0,0 +1,115 @@
+/**
+ * @file ArrivalSource.h
+ * @brief Processes that arrive while a simulation is running
+ * @version 1.0
+ */
+
+#ifndef ARRIVAL_SOURCE_H
+#define ARRIVAL_SOURCE_H
+
+#include "ProcessTable.h"
+#include "WorkloadGenerator.h"
+#include <vector>
+#include <cstddef>
+
+/**
+ * @struct Arrival
+ * @brief One process handed to a running scheduler
+ */
+struct Arrival {
+    int pid;            ///< Process ID
+    int priority;       ///< Priority (lower is higher)
+    int burstTime;      ///< CPU burst time
+    int arrivalTime;    ///< Time the process enters the system
+};
+
+/**
+ * @class ArrivalSource
+ * @brief Stream of processes in arrival order, pulled on demand
+ *
+ * A scheduler with a source attached pulls from it as the clock advances,
+ * always holding the next arrival so the event engine can jump to it.
+ * Arrival times must not decrease; an earlier one is delayed to the
+ * previous arrival. rewind() must restart the same sequence, since every
+ * run() starts from the beginning of the stream.
+ */
+class ArrivalSource {
+public:
+    virtual ~ArrivalSource() = default;
+
+    /**
+     * @brief Produce the next arrival
+     * @param arrival Output arrival
+     * @return false once the source is exhausted
+     */
+    virtual bool next(Arrival& arrival) = 0;
+
+    /**
+     * @brief Restart the sequence from its first arrival
+     */
+    virtual void rewind() = 0;
+};
+
+/**
+ * @class TableArrivalSource
+ * @brief Replays the rows of a process table in arrival order
+ *
+ * Ties keep table order, matching the scheduler's own arrival index, so
+ * replaying a table gives the same schedule as loading it up front. Round
+ * Robin is the exception when arrival times tie, since it sorts its table
+ * with std::sort first.
+ */
+class TableArrivalSource : public ArrivalSource {
+private:
+    ProcessTable table;         ///< Processes to replay
+    std::vector<int> order;     ///< Row indices sorted by arrival
+    size_t cursor;              ///< Next order entry to produce
+
+public:
+    /**
+     * @brief Constructor
+     * @param table Processes to replay (moved in)
+     */
+    explicit TableArrivalSource(ProcessTable table);
+
+    bool next(Arrival& arrival) override;
+    void rewind() override { cursor = 0; }
+};
+
+/**
+ * @class GeneratedArrivalSource
+ * @brief Open workload drawn lazily from a WorkloadGenerator
+ *
+ * Produces the rows generate() would, one chunk at a time, so memory is a
+ * chunk of columns however long the run. Pids start at firstPid, so the
+ * stream can follow a static workload without clashing. The spec must
+ * use POISSON or DIURNAL arrivals, which come out in arrival order; its
+ * count bounds the number of arrivals (INT_MAX for an open-ended stream).
+ */
+class GeneratedArrivalSource : public ArrivalSource {
+private:
+    WorkloadGenerator generator;    ///< Draws the chunks
+    size_t chunkSize;               ///< Rows per chunk
+    int firstPid;                   ///< Pid of the first arrival
+    std::vector<int> priorities;    ///< Current chunk's priorities
+    std::vector<int> bursts;        ///< Current chunk's bursts
+    std::vector<int> arrivals;      ///< Current chunk's arrival times
+    size_t chunk;                   ///< Chunk held in the buffers
+    size_t rows;                    ///< Rows in the current chunk
+    size_t cursor;                  ///< Next row of the current chunk
+    double timeOffset;              ///< Operational time at the start of the chunk
+
+public:
+    /**
+     * @brief Constructor
+     * @param spec Distributions and seed of the stream
+     * @param firstPid Pid of the first arrival
+     * @throws std::invalid_argument if the spec is invalid or uses UNIFORM arrivals
+     */
+    GeneratedArrivalSource(const WorkloadSpec& spec, int firstPid = 0);
+
+    bool next(Arrival& arrival) override;
+    void rewind() override;
+};
+
+#endif // ARRIVAL_SOURCE_H
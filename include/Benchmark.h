@@ -0,0 +1,127 @@
+/**
+ * @file Benchmark.h
+ * @brief Reproducible timing of the schedulers on generated workloads
+ * @version 1.0
+ */
+
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+#include "Scheduler.h"
+#include "ProcessTable.h"
+#include "RunStats.h"
+#include <vector>
+#include <string>
+#include <iostream>
+
+/**
+ * @struct BenchmarkOptions
+ * @brief Workload sizes, repetitions and algorithms to benchmark
+ */
+struct BenchmarkOptions {
+    std::vector<int> sizes = {1000, 10000, 100000};    ///< Process counts to run
+    int warmupRuns = 1;                         ///< Untimed runs before measuring
+    int iterations = 5;                         ///< Timed runs per measurement
+    unsigned int seed = 42;                     ///< Workload generator seed
+    bool keepHistory = false;                   ///< Keep timeline and per-process metrics
+    std::vector<SchedulerType> algorithms;      ///< Algorithms to run (empty = all)
+};
+
+/**
+ * @struct BenchmarkResult
+ * @brief Timing of one algorithm on one workload size
+ */
+struct BenchmarkResult {
+    SchedulerType algorithm;        ///< Algorithm that was run
+    std::string schedulerName;      ///< Display name of the algorithm
+    int processes;                  ///< Workload size
+    std::vector<double> wallMs;     ///< Wall time of each timed run
+    double minMs;                   ///< Fastest run
+    double medianMs;                ///< Median run
+    double p90Ms;                   ///< 90th percentile run
+    double p99Ms;                   ///< 99th percentile run
+    double maxMs;                   ///< Slowest run
+    long long events;               ///< Timeline events per run
+    double eventsPerSecond;         ///< Events over the median wall time
+    long long peakRssKb;            ///< Peak resident set during this result's runs
+    bool peakRssPerAlgorithm;       ///< false: the peak could not be reset, so it is the process's
+    RunStats profile;               ///< Phase counters of the timed runs (profiling builds)
+};
+
+/**
+ * @class Benchmark
+ * @brief Times run() of each algorithm on seeded synthetic workloads
+ *
+ * A workload depends only on its size and the seed, so results from
+ * different builds are comparable. Only Scheduler::run() is timed:
+ * building the workload, copying it into the scheduler and reporting are
+ * not. Events are counted by a sink, so by default no timeline or
+ * per-process metrics are kept and memory stays proportional to the
+ * process table. On Linux the peak RSS is reset before each algorithm's
+ * runs (/proc/self/clear_refs), so each result reports its own peak:
+ * the resident set the process already had plus what the runs added.
+ * Elsewhere it is the whole process's high-water mark, which never
+ * decreases across results (0 where unsupported). Profiling builds
+ * (make profile) also report each phase's share of run() time and the
+ * queue high-water marks.
+ */
+class Benchmark {
+private:
+    SchedulerConfig config;         ///< Configuration of every scheduler
+    BenchmarkOptions options;       ///< Sizes, repetitions and algorithms
+
+public:
+    /**
+     * @brief Constructor
+     * @param config Scheduler configuration
+     * @param options Sizes, repetitions and algorithms
+     * @throws std::invalid_argument if a size or count is out of range
+     */
+    Benchmark(const SchedulerConfig& config,
+              const BenchmarkOptions& options = BenchmarkOptions());
+
+    /**
+     * @brief Algorithms the benchmark will run
+     * @return Requested algorithms, or Simulator::defaultAlgorithms() if none were requested
+     */
+    std::vector<SchedulerType> getAlgorithms() const;
+
+    /**
+     * @brief Run every algorithm at every size
+     * @param progress Stream for a line per result (nullptr = quiet)
+     * @return One result per (size, algorithm), sizes in option order
+     */
+    std::vector<BenchmarkResult> run(std::ostream* progress = nullptr) const;
+
+    /**
+     * @brief Generate a reproducible workload
+     *
+     * Bursts are 1-20, priorities 0-9, and arrivals are spread so the CPU
+     * stays about as busy as it can be.
+     * @param count Number of processes
+     * @param seed Generator seed
+     * @return Process table in pid order
+     */
+    static ProcessTable generateWorkload(int count, unsigned int seed);
+
+    /**
+     * @brief Peak resident set size of this process
+     * @return High-water mark in KiB (VmHWM on Linux), or 0 if the platform has no query
+     */
+    static long long peakRssKb();
+
+    /**
+     * @brief Restart the peak resident set from the current resident set
+     * @return true if the platform supports it (Linux 4.0 and later)
+     */
+    static bool resetPeakRss();
+
+    /**
+     * @brief Write options and results as a JSON document
+     * @param out Destination stream
+     * @param results Results from run()
+     */
+    void writeJson(std::ostream& out, const std::vector<BenchmarkResult>& results) const;
+};
+
+#endif // BENCHMARK_H
@@ -0,0 +1,132 @@
+/**
+ * @file EventQueue.h
+ * @brief Time-ordered event queue for the discrete-event simulation core
+ * @version 1.0
+ */
+
+#ifndef EVENT_QUEUE_H
+#define EVENT_QUEUE_H
+
+#include <vector>
+#include <climits>
+#include <cstddef>
+
+/**
+ * @enum SimEventType
+ * @brief Kinds of future events a scheduler can wait for
+ */
+enum class SimEventType {
+    AGING,          ///< A waiting process reaches its aging threshold
+    PRIORITY_BOOST, ///< Periodic MLFQ boost becomes due
+    IO_COMPLETE     ///< A blocked process finishes its I/O burst (kept in a TimerWheel)
+};
+
+/**
+ * @struct SimEvent
+ * @brief A single pending simulation event
+ */
+struct SimEvent {
+    int time;               ///< Simulation time the event fires at
+    SimEventType type;      ///< Event kind
+    int processIdx;         ///< Index into the scheduler's processes (-1 if none)
+    long long sequence;     ///< Insertion order, breaks ties deterministically
+};
+
+/**
+ * @class EventQueue
+ * @brief Binary min-heap of simulation events ordered by time
+ *
+ * Events with the same time are returned in insertion order. Arrivals are
+ * not queued here: Scheduler reads them off its sorted arrival index.
+ */
+class EventQueue {
+private:
+    std::vector<SimEvent> heap;     ///< Heap storage (earliest event at front)
+    long long nextSequence;         ///< Sequence number for the next push
+
+    /**
+     * @brief Heap comparator: true if a fires after b
+     */
+    static bool later(const SimEvent& a, const SimEvent& b);
+
+public:
+    /**
+     * @brief Constructor
+     */
+    EventQueue();
+
+    /**
+     * @brief Schedule an event
+     * @param time Time the event fires at
+     * @param type Event kind
+     * @param processIdx Process index the event refers to
+     */
+    void push(int time, SimEventType type, int processIdx = -1);
+
+    /**
+     * @brief Get the earliest pending event
+     * @return Reference to the earliest event (queue must not be empty)
+     */
+    const SimEvent& top() const { return heap.front(); }
+
+    /**
+     * @brief Remove the earliest pending event
+     */
+    void pop();
+
+    /**
+     * @brief Drop every event scheduled at or before a given time
+     * @param time Cut-off time (inclusive)
+     */
+    void discardUntil(int time);
+
+    /**
+     * @brief Time of the earliest pending event
+     * @return Event time, INT_MAX if the queue is empty
+     */
+    int nextTime() const { return heap.empty() ? INT_MAX : heap.front().time; }
+
+    /**
+     * @brief Check if no events are pending
+     * @return true if empty
+     */
+    bool empty() const { return heap.empty(); }
+
+    /**
+     * @brief Number of pending events
+     * @return Event count
+     */
+    size_t size() const { return heap.size(); }
+
+    /**
+     * @brief Reserve storage for a number of events
+     * @param count Expected number of pending events
+     */
+    void reserve(size_t count) { heap.reserve(count); }
+
+    /**
+     * @brief Remove all pending events
+     */
+    void clear();
+
+    /**
+     * @brief Pending events in heap (not time) order, for snapshots
+     */
+    const std::vector<SimEvent>& pending() const { return heap; }
+
+    /**
+     * @brief Sequence number the next push will get
+     */
+    long long getNextSequence() const { return nextSequence; }
+
+    /**
+     * @brief Replace the pending events with a saved set
+     *
+     * Restores the queue exactly, ties included.
+     * @param saved Events as returned by pending()
+     * @param sequence Sequence number for the next push (above every saved one)
+     */
+    void restore(const std::vector<SimEvent>& saved, long long sequence);
+};
+
+#endif // EVENT_QUEUE_H
@@ -0,0 +1,163 @@
+/**
+ * @file IndexedHeap.h
+ * @brief Binary min-heap over process indices with decrease-key support
+ * @version 1.0
+ */
+
+#ifndef INDEXED_HEAP_H
+#define INDEXED_HEAP_H
+
+#include <vector>
+#include <cstddef>
+
+/**
+ * @class IndexedHeap
+ * @brief Min-heap of integer ids in [0, capacity) with O(log n) update
+ *
+ * Keeps a position table next to the heap so an id already in the heap
+ * can be re-sifted after its key changes (decrease-key) or removed.
+ * Ordering is supplied by a strict-weak-order functor over ids.
+ *
+ * @tparam Less Functor: Less(a, b) is true if id a should come out first
+ */
+template <typename Less>
+class IndexedHeap {
+private:
+    std::vector<int> heap;          ///< Ids in heap order
+    std::vector<int> position;      ///< Heap position of each id, -1 if absent
+    Less less;                      ///< Ordering functor
+
+    void place(size_t pos, int id) {
+        heap[pos] = id;
+        position[id] = static_cast<int>(pos);
+    }
+
+    void siftUp(size_t pos) {
+        int id = heap[pos];
+        while (pos > 0) {
+            size_t parent = (pos - 1) / 2;
+            if (!less(id, heap[parent])) {
+                break;
+            }
+            place(pos, heap[parent]);
+            pos = parent;
+        }
+        place(pos, id);
+    }
+
+    void siftDown(size_t pos) {
+        int id = heap[pos];
+        size_t count = heap.size();
+        while (true) {
+            size_t child = 2 * pos + 1;
+            if (child >= count) {
+                break;
+            }
+            if (child + 1 < count && less(heap[child + 1], heap[child])) {
+                child++;
+            }
+            if (!less(heap[child], id)) {
+                break;
+            }
+            place(pos, heap[child]);
+            pos = child;
+        }
+        place(pos, id);
+    }
+
+public:
+    /**
+     * @brief Constructor
+     * @param less Ordering functor
+     */
+    explicit IndexedHeap(Less less = Less()) : less(less) {}
+
+    /**
+     * @brief Empty the heap and size it for ids in [0, capacity)
+     * @param capacity Number of distinct ids
+     */
+    void reset(size_t capacity) {
+        heap.clear();
+        heap.reserve(capacity);
+        position.assign(capacity, -1);
+    }
+
+    /**
+     * @brief Allow ids up to a larger capacity, keeping the heap
+     * @param capacity Number of distinct ids (no effect if not larger)
+     */
+    void grow(size_t capacity) {
+        if (capacity > position.size()) {
+            position.resize(capacity, -1);
+        }
+    }
+
+    /**
+     * @brief Insert an id (must not already be present)
+     * @param id Id to insert
+     */
+    void push(int id) {
+        heap.push_back(id);
+        siftUp(heap.size() - 1);
+    }
+
+    /**
+     * @brief Smallest id under the ordering (heap must not be empty)
+     */
+    int top() const { return heap.front(); }
+
+    /**
+     * @brief Remove and return the smallest id
+     * @return Removed id
+     */
+    int pop() {
+        int id = heap.front();
+        erase(id);
+        return id;
+    }
+
+    /**
+     * @brief Remove an id if present
+     * @param id Id to remove
+     */
+    void erase(int id) {
+        int pos = position[id];
+        if (pos < 0) {
+            return;
+        }
+        position[id] = -1;
+        int last = heap.back();
+        heap.pop_back();
+        if (last != id) {
+            place(static_cast<size_t>(pos), last);
+            update(last);
+        }
+    }
+
+    /**
+     * @brief Restore heap order after an id's key changed
+     * @param id Id whose key changed
+     */
+    void update(int id) {
+        size_t pos = static_cast<size_t>(position[id]);
+        siftUp(pos);
+        siftDown(static_cast<size_t>(position[id]));
+    }
+
+    /**
+     * @brief Check if an id is in the heap
+     */
+    bool contains(int id) const {
+        return id >= 0 && static_cast<size_t>(id) < position.size() && position[id] >= 0;
+    }
+
+    bool empty() const { return heap.empty(); }
+    size_t size() const { return heap.size(); }
+
+    /**
+     * @brief Ids currently in the heap, in heap (not sorted) order
+     */
+    const std::vector<int>& items() const { return heap; }
+};
+
+#endif // INDEXED_HEAP_H
@@ -0,0 +1,133 @@
+/**
+ * @file LevelMask.h
+ * @brief Bitmask of non-empty queue levels with find-first-set lookup
+ * @version 1.0
+ */
+
+#ifndef LEVEL_MASK_H
+#define LEVEL_MASK_H
+
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+/**
+ * @class LevelMask
+ * @brief Set of levels in [0, levels) with O(1) lowest-level lookup
+ *
+ * One bit per level, plus a summary word with one bit per non-zero level
+ * word, so first() is two find-first-set instructions for up to 4096
+ * levels (deeper masks scan one summary word per 4096 levels). Multilevel
+ * schedulers set a level's bit when its queue becomes non-empty and clear
+ * it when the queue drains, so picking the top queue does not depend on
+ * the number of levels.
+ */
+class LevelMask {
+private:
+    std::vector<std::uint64_t> words;   ///< Bit l % 64 of words[l / 64] is level l
+    std::vector<std::uint64_t> summary; ///< Bit w % 64 of summary[w / 64]: words[w] != 0
+
+    static int lowestBit(std::uint64_t word) {
+#if defined(__GNUC__) || defined(__clang__)
+        return __builtin_ctzll(word);
+#elif defined(_MSC_VER)
+        unsigned long bit;
+        _BitScanForward64(&bit, word);
+        return static_cast<int>(bit);
+#else
+        int bit = 0;
+        while ((word & 1) == 0) {
+            word >>= 1;
+            bit++;
+        }
+        return bit;
+#endif
+    }
+
+public:
+    /**
+     * @brief Clear every level and size the mask
+     * @param levels Number of levels
+     */
+    void reset(size_t levels) {
+        words.assign((levels + 63) / 64, 0);
+        summary.assign((words.size() + 63) / 64, 0);
+    }
+
+    /**
+     * @brief Mark a level non-empty
+     */
+    void set(int level) {
+        const size_t word = static_cast<size_t>(level) >> 6;
+        words[word] |= std::uint64_t(1) << (level & 63);
+        summary[word >> 6] |= std::uint64_t(1) << (word & 63);
+    }
+
+    /**
+     * @brief Mark a level empty
+     */
+    void clear(int level) {
+        const size_t word = static_cast<size_t>(level) >> 6;
+        words[word] &= ~(std::uint64_t(1) << (level & 63));
+        if (words[word] == 0) {
+            summary[word >> 6] &= ~(std::uint64_t(1) << (word & 63));
+        }
+    }
+
+    /**
+     * @brief Check if a level is marked non-empty
+     */
+    bool test(int level) const {
+        return (words[static_cast<size_t>(level) >> 6] >> (level & 63)) & 1;
+    }
+
+    /**
+     * @brief Lowest marked level
+     * @return Level, -1 if none is marked
+     */
+    int first() const {
+        for (size_t s = 0; s < summary.size(); ++s) {
+            if (summary[s] != 0) {
+                const size_t word = s * 64 + static_cast<size_t>(lowestBit(summary[s]));
+                return static_cast<int>(word * 64 + static_cast<size_t>(lowestBit(words[word])));
+            }
+        }
+        return -1;
+    }
+
+    /**
+     * @brief Lowest marked level at or above a level
+     * @param from First level to consider
+     * @return Level, -1 if none at or above from is marked
+     */
+    int next(int from) const {
+        size_t word = static_cast<size_t>(from) >> 6;
+        if (word >= words.size()) {
+            return -1;
+        }
+        const std::uint64_t rest = words[word] & (~std::uint64_t(0) << (from & 63));
+        if (rest != 0) {
+            return static_cast<int>(word * 64 + static_cast<size_t>(lowestBit(rest)));
+        }
+        word++;
+        for (size_t s = word >> 6; s < summary.size(); ++s) {
+            std::uint64_t bits = summary[s];
+            if (s == word >> 6) {
+                bits &= ~std::uint64_t(0) << (word & 63);
+            }
+            if (bits != 0) {
+                const size_t found = s * 64 + static_cast<size_t>(lowestBit(bits));
+                return static_cast<int>(found * 64 + static_cast<size_t>(lowestBit(words[found])));
+            }
+        }
+        return -1;
+    }
+
+    bool empty() const { return first() == -1; }
+};
+
+#endif // LEVEL_MASK_H
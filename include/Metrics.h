@@ -11,6 +11,7 @@
 #include <string>
 #include <iostream>
 #include <iomanip>
+#include "Statistics.h"
 
 /**
  * @class Metrics
@@ -32,11 +33,21 @@ private:
     int totalContextSwitches;       ///< Number of context switches
     int contextSwitchOverhead;      ///< Total time spent in context switching
     int processCount;               ///< Number of processes
+    int totalMigrations;            ///< Dispatches on a different CPU (SMP runs)
+    std::vector<int> cpuBusyTimes;  ///< Execution time per CPU (empty for one CPU)
 
     // Individual process metrics for detailed analysis
     std::vector<int> waitingTimes;
     std::vector<int> turnaroundTimes;
     std::vector<int> responseTimes;
+    bool keepSamples;               ///< Store individual times (not just running totals)
+
+    // Constant-memory summaries, so no statistic needs the stored samples
+    RunningStats waitingStats;      ///< Waiting time count, sum, spread
+    RunningStats turnaroundStats;   ///< Turnaround time count, sum, spread
+    RunningStats responseStats;     ///< Response time count, sum, spread
+    QuantileSketch waitingSketch;   ///< Waiting time percentiles
+    QuantileSketch responseSketch;  ///< Response time percentiles
 
 public:
     /**
@@ -46,9 +57,21 @@ public:
 
     /**
      * @brief Reset all metrics to initial values
+     *
+     * The sample retention setting is kept.
      */
     void reset();
 
+    /**
+     * @brief Choose whether individual times are stored
+     *
+     * Every statistic comes from the running summaries either way; without
+     * samples memory stays constant and the per-process tables are omitted.
+     * @param keep true to store every individual time (default)
+     */
+    void setKeepSamples(bool keep) { keepSamples = keep; }
+    bool getKeepSamples() const { return keepSamples; }
+
     // Setters
     void setAvgWaitingTime(double time) { avgWaitingTime = time; }
     void setAvgTurnaroundTime(double time) { avgTurnaroundTime = time; }
@@ -60,6 +83,7 @@ public:
     void setTotalContextSwitches(int count) { totalContextSwitches = count; }
     void setContextSwitchOverhead(int overhead) { contextSwitchOverhead = overhead; }
     void setProcessCount(int count) { processCount = count; }
+    void setTotalMigrations(int count) { totalMigrations = count; }
 
     // Getters
     double getAvgWaitingTime() const { return avgWaitingTime; }
@@ -72,6 +96,24 @@ public:
     int getTotalContextSwitches() const { return totalContextSwitches; }
     int getContextSwitchOverhead() const { return contextSwitchOverhead; }
     int getProcessCount() const { return processCount; }
+    int getTotalMigrations() const { return totalMigrations; }
+
+    /**
+     * @brief Number of simulated CPUs (1 unless calculateCpuUtilization() ran)
+     */
+    size_t getCpuCount() const { return cpuBusyTimes.empty() ? 1 : cpuBusyTimes.size(); }
+
+    /**
+     * @brief Utilization of one CPU
+     * @param cpu CPU index
+     * @return Execution time over the total time, as a percentage
+     */
+    double getCpuUtilization(size_t cpu) const;
+
+    /**
+     * @brief Execution time of every CPU (empty for single-CPU runs)
+     */
+    const std::vector<int>& getCpuBusyTimes() const { return cpuBusyTimes; }
 
     /**
      * @brief Add individual waiting time
@@ -104,6 +146,18 @@ public:
      */
     void calculateUtilization(int totalTime, int idleTime, int switchOverhead);
 
+    /**
+     * @brief Calculate utilization of a multi-CPU run
+     *
+     * Replaces the single-CPU utilization, idle time and switch overhead.
+     * Capacity is the total execution time on every CPU, so utilization is
+     * the execution time of all CPUs over that capacity. Call after
+     * calculateUtilization(), which sets the total execution time.
+     * @param busyTimes Execution time per CPU
+     * @param switchOverhead Context switch and migration time of all CPUs
+     */
+    void calculateCpuUtilization(const std::vector<int>& busyTimes, int switchOverhead);
+
     /**
      * @brief Calculate throughput
      * @param totalTime Total simulation time
@@ -134,6 +188,38 @@ public:
      */
     int getMaxWaitingTime() const;
 
+    /**
+     * @brief Get a waiting time percentile
+     * @param fraction Quantile in [0, 1] (0.99 = p99)
+     * @return Percentile, within 2% of the exact value
+     */
+    int getWaitingTimePercentile(double fraction) const;
+
+    /**
+     * @brief Get a response time percentile
+     * @param fraction Quantile in [0, 1] (0.99 = p99)
+     * @return Percentile, within 2% of the exact value
+     */
+    int getResponseTimePercentile(double fraction) const;
+
+    const RunningStats& getWaitingStats() const { return waitingStats; }
+    const RunningStats& getTurnaroundStats() const { return turnaroundStats; }
+    const RunningStats& getResponseStats() const { return responseStats; }
+
+    /**
+     * @brief Combine with the results of another run
+     *
+     * The result describes both runs back to back: per-process statistics
+     * and percentiles cover every process, times and switch counts are
+     * summed, and utilization and throughput are recomputed from the sums.
+     * Per-CPU times are summed when both runs used the same CPU count and
+     * dropped otherwise.
+     * Samples are appended when both sides keep them; otherwise they are
+     * dropped, since a partial per-process table would be misleading.
+     * @param other Metrics of another run
+     */
+    void merge(const Metrics& other);
+
     /**
      * @brief Print formatted metrics report
      */
@@ -158,6 +244,11 @@ public:
      */
     std::string compareTo(const Metrics& other) const;
 
+    /**
+     * @brief Exact equality of every aggregate and per-process value
+     */
+    bool operator==(const Metrics& other) const;
+
     /**
      * @brief Output stream operator
      */
@@ -8,9 +8,11 @@
 #define MULTILEVEL_FEEDBACK_QUEUE_SCHEDULER_H
 
 #include "Scheduler.h"
+#include "LevelMask.h"
 #include <vector>
 #include <queue>
-#include <map>
+#include <set>
+#include <memory_resource>
 
 /**
  * @class MultilevelFeedbackQueueScheduler
@@ -24,13 +26,72 @@ class MultilevelFeedbackQueueScheduler : public Scheduler {
 private:
     int numQueues;                              ///< Number of queue levels
     std::vector<int> quantums;                  ///< Time quantum for each queue
-    std::vector<std::queue<int>> queues;        ///< Process queues
-    std::map<int, int> processQueueMap;         ///< Map PID to queue level
-    std::map<int, int> timeInQueue;             ///< Track time in current queue
+    /// FIFO of process indices whose blocks come from the run arena
+    using LevelQueue = std::queue<int, std::pmr::deque<int>>;
+
+    /**
+     * @struct LevelQueues
+     * @brief The queue of every level, for one CPU
+     */
+    struct LevelQueues {
+        std::vector<LevelQueue> queues;     ///< Process queues (levels are in the table)
+        std::pmr::set<int> boosted;         ///< Head of the top queue: boosted processes in table order
+        LevelMask nonEmpty;                 ///< Levels whose queue is non-empty
+
+        /**
+         * @brief Empty queues whose storage comes from a memory resource
+         */
+        LevelQueues(int numQueues, std::pmr::memory_resource* memory);
+
+        /**
+         * @brief Append a process to a level's queue
+         */
+        void enqueue(int level, int processIdx);
+
+        /**
+         * @brief Remove and return the front of a non-empty level's queue
+         *
+         * The top queue serves the boosted set before its FIFO tail.
+         */
+        int dequeue(int level);
+
+        /**
+         * @brief Front of a non-empty level's queue
+         */
+        int front(int level) const;
+
+        /**
+         * @brief Move every queued READY process to the top queue's boosted set
+         */
+        void boost(ProcessTable& processes);
+
+        /**
+         * @brief Empty every level, handing the blocks back to the pool
+         */
+        void clear();
+    };
+
+    std::vector<LevelQueues> cpuQueues;         ///< Level queues of each CPU (one outside SMP runs)
+    std::vector<int> timeInQueue;               ///< CPU time received per pid slot
     bool agingEnabled;                          ///< Enable aging mechanism
     int agingInterval;                          ///< Interval for priority boost
     int lastBoostTime;                          ///< Last time priority boost occurred
 
+    /**
+     * @brief Create the empty level queues of every CPU on the run arena
+     * @param cpuCount Number of CPUs
+     */
+    void buildQueues(int cpuCount = 1);
+
+    /**
+     * @brief Start a run from empty level queues
+     *
+     * Queues of the last run are emptied in place when the CPU count is
+     * unchanged, so their blocks are reused and a rerun allocates nothing.
+     * @param cpuCount Number of CPUs
+     */
+    void clearQueues(int cpuCount = 1);
+
     /**
      * @brief Demote process to lower priority queue
      * @param processIdx Process index to demote
@@ -45,12 +106,17 @@ private:
 
     /**
      * @brief Perform priority boost (move all to top queue)
-     * Called periodically to prevent starvation
+     * Called periodically to prevent starvation. The top queue is rebuilt
+     * in table order: processes boosted earlier stay in the sorted set, and
+     * only those queued since (the top queue's tail and the lower levels)
+     * are merged in, so a boost costs O(moved log ready), not O(processes).
+     * SMP runs boost every CPU's queues.
      */
     void priorityBoost();
 
     /**
      * @brief Get the highest priority non-empty queue
+     * Find-first-set on the level mask, whatever the number of levels.
      * @return Queue index, -1 if all empty
      */
     int getHighestPriorityQueue();
@@ -62,6 +128,25 @@ private:
      */
     int getQuantumForQueue(int queueLevel) const;
 
+protected:
+    /**
+     * @brief Give an injected process its pid slot
+     */
+    void onProcessInjected(int idx) override;
+
+    /**
+     * @brief Drop the queues and boosted set, release the arena, rebuild empty queues
+     */
+    void releaseRunMemory() override;
+
+    /// SMP mode: per-CPU level queues, boosted together
+    void smpBegin(int cpuCount) override;
+    void smpEnqueue(int cpu, int idx) override;
+    int smpDequeue(int cpu) override;
+    int smpSliceLength(int idx) const override;
+    EventKind smpSliceEnd(int idx, int ran) override;
+    void smpDeadlines() override;
+
 public:
     /**
      * @brief Constructor
@@ -89,9 +174,9 @@ public:
 
     /**
      * @brief Get next process from highest priority non-empty queue
-     * @return Pointer to next process
+     * @return Index of next process, -1 if none ready
      */
-    Process* getNextProcess() override;
+    int getNextProcess() override;
 
     /**
      * @brief Get algorithm name
@@ -105,6 +190,11 @@ public:
      */
     SchedulerType getType() const override { return SchedulerType::MULTILEVEL_FEEDBACK_QUEUE; }
 
+    /**
+     * @brief MLFQ runs on config.numCpus CPUs
+     */
+    bool supportsSmp() const override { return true; }
+
     /**
      * @brief Reset scheduler state
      */
@@ -8,6 +8,8 @@
 #define MULTILEVEL_QUEUE_SCHEDULER_H
 
 #include "Scheduler.h"
+#include "RingQueue.h"
+#include "LevelMask.h"
 #include <vector>
 #include <queue>
 
@@ -44,19 +46,28 @@ struct QueueConfig {
 class MultilevelQueueScheduler : public Scheduler {
 private:
     std::vector<QueueConfig> queueConfigs;              ///< Configuration for each queue
-    std::vector<std::vector<int>> queues;               ///< Process indices in each queue
+    std::vector<RingQueue> queues;                      ///< Process indices in each queue
+    LevelMask nonEmpty;                                  ///< Levels whose queue is non-empty
     int numQueues;                                       ///< Number of queue levels
     int currentQueue;                                    ///< Currently active queue
+    int lastCompletionTime;                              ///< Time of the latest completion
+    int completionsAtLast;                               ///< Completions at lastCompletionTime
 
     /**
      * @brief Assign process to appropriate queue based on priority
-     * @param process Process to assign
+     * @param priority Process priority
      * @return Queue index
      */
-    int assignToQueue(const Process& process);
+    int assignToQueue(int priority) const;
+
+    /**
+     * @brief Append a process to a level's queue
+     */
+    void enqueue(int level, int processIdx);
 
     /**
      * @brief Get next non-empty queue
+     * Find-first-set on the level mask, whatever the number of levels.
      * @return Queue index, -1 if all empty
      */
     int getActiveQueue();
@@ -68,6 +79,12 @@ private:
      */
     bool executeQueue(int queueIdx);
 
+protected:
+    /**
+     * @brief Assign an injected process to its queue
+     */
+    void onProcessInjected(int idx) override;
+
 public:
     /**
      * @brief Constructor
@@ -95,9 +112,9 @@ public:
 
     /**
      * @brief Get next process from highest priority non-empty queue
-     * @return Pointer to next process
+     * @return Index of next process, -1 if none ready
      */
-    Process* getNextProcess() override;
+    int getNextProcess() override;
 
     /**
      * @brief Get algorithm name
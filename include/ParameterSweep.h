@@ -0,0 +1,135 @@
+/**
+ * @file ParameterSweep.h
+ * @brief Grid and random search over scheduler configurations
+ * @version 1.0
+ */
+
+#ifndef PARAMETER_SWEEP_H
+#define PARAMETER_SWEEP_H
+
+#include "Scheduler.h"
+#include "Process.h"
+#include "Metrics.h"
+#include <vector>
+#include <string>
+#include <iostream>
+
+/**
+ * @struct SweepSpace
+ * @brief Candidate values for each swept SchedulerConfig field
+ *
+ * An empty list keeps the base configuration's value for that field.
+ */
+struct SweepSpace {
+    std::vector<int> timeQuantums;              ///< Values for timeQuantum
+    std::vector<int> contextSwitchTimes;        ///< Values for contextSwitchTime
+    std::vector<int> numQueues;                 ///< Values for numQueues
+    std::vector<std::vector<int>> quantums;     ///< Per-level quantum sets
+    std::vector<int> agingThresholds;           ///< Values for agingThreshold
+};
+
+/**
+ * @enum SweepMode
+ * @brief How sweep points are chosen
+ */
+enum class SweepMode {
+    GRID,   ///< Every combination of the candidate values
+    RANDOM  ///< Fixed number of points, each field drawn uniformly
+};
+
+/**
+ * @struct SweepOptions
+ * @brief Execution options for a parameter sweep
+ */
+struct SweepOptions {
+    SweepMode mode = SweepMode::GRID;           ///< Point selection
+    int samples = 100;                          ///< Points drawn in random mode
+    unsigned int seed = 1;                      ///< Seed for random mode
+    int workerThreads = 0;                      ///< Pool size (0 = hardware threads)
+    std::vector<SchedulerType> algorithms;      ///< Algorithms to run (empty = all)
+};
+
+/**
+ * @struct SweepResult
+ * @brief Metrics of one algorithm at one sweep point
+ */
+struct SweepResult {
+    size_t point;                   ///< Index of the configuration point
+    SchedulerType algorithm;        ///< Algorithm that was run
+    std::string schedulerName;      ///< Display name of the algorithm
+    SchedulerConfig config;         ///< Configuration used
+    Metrics metrics;                ///< Resulting metrics
+};
+
+/**
+ * @class ParameterSweep
+ * @brief Runs algorithms over many configurations of one in-memory workload
+ *
+ * The workload is parsed once and shared read-only by all runs. Every
+ * (point, algorithm) pair is an independent task on a thread pool; results
+ * come back in point order, then algorithm order, whatever the thread count.
+ */
+class ParameterSweep {
+private:
+    std::vector<Process> workload;      ///< Processes every run starts from
+    SchedulerConfig baseConfig;         ///< Values for fields not swept
+    SweepSpace space;                   ///< Candidate values
+    SweepOptions options;               ///< Execution options
+
+public:
+    /**
+     * @brief Constructor
+     * @param workload Processes to simulate
+     * @param baseConfig Configuration the swept fields are applied to
+     * @param space Candidate values
+     * @param options Execution options
+     * @throws std::invalid_argument if a candidate value is out of range
+     */
+    ParameterSweep(const std::vector<Process>& workload,
+                   const SchedulerConfig& baseConfig,
+                   const SweepSpace& space,
+                   const SweepOptions& options = SweepOptions());
+
+    /**
+     * @brief Configuration points the sweep will run
+     * @return Grid combinations, or the seeded random sample
+     */
+    std::vector<SchedulerConfig> generatePoints() const;
+
+    /**
+     * @brief Algorithms the sweep will run at each point
+     * @return Requested algorithms, or Simulator::defaultAlgorithms() if none were requested
+     */
+    std::vector<SchedulerType> getAlgorithms() const;
+
+    /**
+     * @brief Run every algorithm at every point
+     * @return One result per (point, algorithm)
+     */
+    std::vector<SweepResult> run() const;
+
+    /**
+     * @brief Write results as a CSV table
+     * @param out Destination stream
+     * @param results Results from run()
+     */
+    static void writeTable(std::ostream& out, const std::vector<SweepResult>& results);
+
+    /**
+     * @brief Parse a comma-separated list of integers ("2,4,8")
+     * @param text List text
+     * @return Parsed values
+     * @throws std::invalid_argument on malformed input
+     */
+    static std::vector<int> parseList(const std::string& text);
+
+    /**
+     * @brief Parse comma-separated quantum sets ("2:4:8,4:8:16")
+     * @param text Set list text
+     * @return Parsed sets
+     * @throws std::invalid_argument on malformed input
+     */
+    static std::vector<std::vector<int>> parseQuantumSets(const std::string& text);
+};
+
+#endif // PARAMETER_SWEEP_H
@@ -8,7 +8,8 @@
 #define PRIORITY_SCHEDULER_H
 
 #include "Scheduler.h"
-#include <map>
+#include "IndexedHeap.h"
+#include <vector>
 
 /**
  * @class PriorityScheduler
@@ -20,14 +21,55 @@
  */
 class PriorityScheduler : public Scheduler {
 private:
+    /**
+     * @struct ReadyOrder
+     * @brief Heap ordering: priority, then arrival time, then table order
+     */
+    struct ReadyOrder {
+        const ProcessTable* processes;
+        bool operator()(int a, int b) const;
+    };
+
+    /**
+     * @struct QueuedProcess
+     * @brief SMP heap entry: the ordering key when queued or aged
+     */
+    struct QueuedProcess {
+        int priority;           ///< Priority when the entry was pushed
+        int arrivalTime;        ///< Arrival time (tie-breaker)
+        int processIdx;         ///< Process index (last tie-breaker)
+        unsigned int epoch;     ///< Entry is stale unless it matches queueEpochs
+    };
+
+    /**
+     * @struct QueuedAfter
+     * @brief Heap comparator: true if a comes out after b (same order as ReadyOrder)
+     */
+    struct QueuedAfter {
+        bool operator()(const QueuedProcess& a, const QueuedProcess& b) const;
+    };
+
+    static constexpr int NOT_WAITING = -1;  ///< waitingSince entry of a pid not waiting
+
     bool preemptive;                    ///< Preemptive mode flag
     bool agingEnabled;                  ///< Aging enabled flag
     int agingThreshold;                 ///< Time units before priority boost
-    std::map<int, int> waitingSince;    ///< Track waiting time for aging
+    std::vector<int> waitingSince;      ///< Aging clock start per pid slot
+    IndexedHeap<ReadyOrder> readyHeap;  ///< READY processes by priority
+    std::vector<SimEvent> dueAging;     ///< Scratch list of due aging deadlines
+    std::vector<std::vector<QueuedProcess>> cpuQueues; ///< SMP: ready heap of each CPU
+    std::vector<unsigned int> queueEpochs;  ///< SMP: current entry epoch per process
+
+    /**
+     * @brief Move a process to READY and start its aging clock
+     * @param processIdx Process index
+     */
+    void markReady(int processIdx);
 
     /**
      * @brief Apply aging to waiting processes
-     * Boosts priority of processes that have waited too long
+     * Boosts the priority of processes whose aging deadline has passed.
+     * Only due deadlines are touched; other waiting processes are not.
      */
     void applyAging();
 
@@ -37,12 +79,41 @@ private:
      */
     int findHighestPriority();
 
+    /**
+     * @brief Check if a ready process outranks the running one
+     * @param runningIdx Index of the running process
+     * @return true if the running process would be preempted
+     */
+    bool hasPreemptor(int runningIdx);
+
     /**
      * @brief Check if preemption should occur
-     * @param arriving Newly arrived process
+     * @param arrivingIdx Index of the newly arrived process
      * @return true if current process should be preempted
      */
-    bool shouldPreempt(const Process& arriving);
+    bool shouldPreempt(int arrivingIdx);
+
+protected:
+    /**
+     * @brief Make room in the ready heap and aging clocks for an injected process
+     */
+    void onProcessInjected(int idx) override;
+
+    /**
+     * @brief Push a process's current key onto a CPU's heap
+     *
+     * Earlier entries of the process become stale and are skipped when
+     * they reach the top, so aging costs one O(log n) push on a
+     * contiguous heap instead of a re-sift in a per-CPU position table.
+     */
+    void pushQueued(int cpu, int idx);
+
+    /// SMP mode: per-CPU priority heaps; aging and preemption act within a CPU
+    void smpBegin(int cpuCount) override;
+    void smpEnqueue(int cpu, int idx) override;
+    int smpDequeue(int cpu) override;
+    bool smpPreempts(int idx, int running) const override;
+    void smpDeadlines() override;
 
 public:
     /**
@@ -65,9 +136,9 @@ public:
 
     /**
      * @brief Get next highest priority process
-     * @return Pointer to next process
+     * @return Index of next process, -1 if none ready
      */
-    Process* getNextProcess() override;
+    int getNextProcess() override;
 
     /**
      * @brief Get algorithm name
@@ -81,6 +152,11 @@ public:
      */
     SchedulerType getType() const override;
 
+    /**
+     * @brief Priority scheduling runs on config.numCpus CPUs
+     */
+    bool supportsSmp() const override { return true; }
+
     /**
      * @brief Reset scheduler state
      */
@@ -8,6 +8,7 @@
 #define PROCESS_H
 
 #include <string>
+#include <vector>
 #include <iostream>
 
 /**
@@ -22,6 +23,18 @@ enum class ProcessState {
     TERMINATED  ///< Process has finished execution
 };
 
+/**
+ * @struct IoBurst
+ * @brief An I/O burst that interrupts a process's CPU time
+ *
+ * The process blocks once it has executed `after` time units of CPU in
+ * total, and becomes READY again `length` time units later.
+ */
+struct IoBurst {
+    int after;      ///< CPU time executed before the burst, in (0, burst time)
+    int length;     ///< Time spent blocked, at least 1
+};
+
 /**
  * @class Process
  * @brief Represents a process in the CPU scheduler simulation
@@ -44,6 +57,7 @@ private:
     bool hasStarted;            ///< Flag indicating if process has started execution
     ProcessState state;         ///< Current state of the process
     std::string name;           ///< Human-readable process name
+    std::vector<IoBurst> ioBursts; ///< I/O bursts in CPU-time order (none: one CPU burst)
 
 public:
     /**
@@ -99,8 +113,10 @@ public:
     int getCompletionTime() const { return completionTime; }
     int getQueueLevel() const { return queueLevel; }
     bool getHasStarted() const { return hasStarted; }
+    bool hasStartedExecution() const { return hasStarted; }
     ProcessState getState() const { return state; }
     std::string getName() const { return name; }
+    const std::vector<IoBurst>& getIoBursts() const { return ioBursts; }
 
     // Setters
     void setPid(int pid) { this->pid = pid; }
@@ -117,6 +133,25 @@ public:
     void setState(ProcessState state) { this->state = state; }
     void setName(const std::string& name) { this->name = name; }
 
+    /**
+     * @brief Block the process for I/O after a given amount of CPU time
+     * @param after CPU time executed before the burst, above the previous burst's
+     * @param length Time spent blocked
+     * @return false (and no burst added) if after or length is out of range
+     */
+    bool addIoBurst(int after, int length);
+
+    /**
+     * @brief Total time the process spends blocked on I/O
+     */
+    int getIoTime() const;
+
+    /**
+     * @brief Add time spent waiting in the ready queue
+     * @param time Additional waiting time
+     */
+    void incrementWaitingTime(int time) { waitingTime += time; }
+
     /**
      * @brief Execute the process for a given time slice
      * @param timeSlice Amount of time to execute
@@ -135,6 +170,11 @@ public:
      */
     void reset();
 
+    /**
+     * @brief Reset execution progress (same as reset())
+     */
+    void resetExecution() { reset(); }
+
     /**
      * @brief Get string representation of process state
      * @return State as string
@@ -0,0 +1,286 @@
+/**
+ * @file ProcessTable.h
+ * @brief Structure-of-arrays process storage used by the schedulers
+ * @version 1.0
+ */
+
+#ifndef PROCESS_TABLE_H
+#define PROCESS_TABLE_H
+
+#include "Process.h"
+#include <vector>
+#include <string>
+#include <unordered_map>
+#include <cstddef>
+
+/**
+ * @class ProcessTable
+ * @brief Column-wise storage for every process of a simulation
+ *
+ * Each Process field lives in its own contiguous column, so the sweeps
+ * of the scheduling loops only touch the columns they read instead of
+ * whole Process objects. Names are
+ * interned: each row stores an index into a shared string pool, or
+ * DEFAULT_NAME for the "P<pid>" name, which is built on demand.
+ *
+ * I/O bursts are kept apart from the columns: each row with bursts has a
+ * contiguous range in a shared pool, and a cursor to its next burst. The
+ * I/O columns stay empty until a row gets its first burst, so CPU-only
+ * workloads pay nothing for them.
+ *
+ * Rows are addressed by index, in the order processes were added.
+ * Process remains the value type used to add processes and to report them.
+ */
+class ProcessTable {
+private:
+    std::vector<int> pids;                  ///< Process IDs
+    std::vector<int> priorities;            ///< Priority levels (lower = higher)
+    std::vector<int> burstTimes;            ///< Total CPU burst times
+    std::vector<int> remainingTimes;        ///< Remaining CPU time
+    std::vector<int> arrivalTimes;          ///< Arrival times
+    std::vector<int> waitingTimes;          ///< Time spent waiting
+    std::vector<int> turnaroundTimes;       ///< Arrival to completion
+    std::vector<int> responseTimes;         ///< Arrival to first execution
+    std::vector<int> completionTimes;       ///< Completion times
+    std::vector<int> queueLevels;           ///< Current queue levels
+    std::vector<int> waitStarts;            ///< Service clock when last made READY
+    std::vector<unsigned char> started;     ///< Has-started flags
+    std::vector<ProcessState> states;       ///< Process states
+    std::vector<int> nameIds;               ///< Index into names
+    std::vector<std::string> names;         ///< Interned process names
+    std::unordered_map<std::string, int> nameIndex; ///< Name to pool index
+    std::vector<int> ioFirst;               ///< First ioBursts entry of each row
+    std::vector<int> ioCounts;              ///< I/O bursts of each row
+    std::vector<int> ioNext;                ///< Next I/O burst of each row
+    std::vector<int> ioTimes;               ///< Total I/O time of each row
+    std::vector<IoBurst> ioBursts;          ///< Every row's I/O bursts, each row's contiguous
+    std::vector<int> sortOrder;             ///< sortByArrival() scratch: old row of each row
+    std::vector<unsigned char> sortPlaced;  ///< sortByArrival() scratch: rows already moved
+
+    /**
+     * @brief Pool index of a name, adding it if new
+     */
+    int internName(const std::string& name);
+
+public:
+    /// nameIds entry for rows named "P<pid>"
+    static constexpr int DEFAULT_NAME = -1;
+
+    /**
+     * @brief Append a process as a new row
+     * @param process Process to copy into the table
+     */
+    void add(const Process& process);
+
+    /**
+     * @brief Append a new (NEW state) process without building a Process
+     * @param pid Process ID
+     * @param priority Priority level
+     * @param burstTime CPU burst time
+     * @param arrivalTime Arrival time
+     * @param name Process name (empty = "P<pid>")
+     */
+    void add(int pid, int priority, int burstTime, int arrivalTime,
+             const std::string& name = "");
+
+    /**
+     * @brief Append new processes column by column
+     *
+     * Rows get default names; use setName() to name them.
+     * @param pidColumn Process IDs
+     * @param priorityColumn Priority levels
+     * @param burstColumn CPU burst times
+     * @param arrivalColumn Arrival times
+     * @param count Number of rows
+     */
+    void addColumns(const int* pidColumn, const int* priorityColumn,
+                    const int* burstColumn, const int* arrivalColumn, size_t count);
+
+    /**
+     * @brief Remove every row and interned name
+     */
+    void clear();
+
+    /**
+     * @brief Drop every row from a given index on
+     *
+     * Interned names are kept.
+     * @param count Number of rows to keep (no effect if not below size())
+     */
+    void truncate(size_t count);
+
+    /**
+     * @brief Replace every row with copies of another table's rows
+     *
+     * Copies into the existing columns, so reloading a table of the same
+     * size (or smaller) allocates nothing. The name pool is only copied
+     * when it differs, which keeps repeated loads of one table cheap.
+     * @param source Table to copy (not modified)
+     */
+    void loadFrom(const ProcessTable& source);
+
+    /**
+     * @brief Reserve storage for a number of rows
+     * @param count Expected number of processes
+     */
+    void reserve(size_t count);
+
+    size_t size() const { return pids.size(); }
+    bool empty() const { return pids.empty(); }
+
+    /**
+     * @brief Build a Process from a row
+     * @param i Row index
+     * @return Process with the row's current values
+     */
+    Process getProcess(size_t i) const;
+
+    /**
+     * @brief Build Process objects for every row
+     * @return Processes in row order
+     */
+    std::vector<Process> toProcesses() const;
+
+    // Getters
+    int getPid(size_t i) const { return pids[i]; }
+    int getPriority(size_t i) const { return priorities[i]; }
+    int getBurstTime(size_t i) const { return burstTimes[i]; }
+    int getRemainingTime(size_t i) const { return remainingTimes[i]; }
+    int getArrivalTime(size_t i) const { return arrivalTimes[i]; }
+    int getWaitingTime(size_t i) const { return waitingTimes[i]; }
+    int getTurnaroundTime(size_t i) const { return turnaroundTimes[i]; }
+    int getResponseTime(size_t i) const { return responseTimes[i]; }
+    int getCompletionTime(size_t i) const { return completionTimes[i]; }
+    int getQueueLevel(size_t i) const { return queueLevels[i]; }
+    bool getHasStarted(size_t i) const { return started[i] != 0; }
+    int getWaitStart(size_t i) const { return waitStarts[i]; }
+    int getIoTime(size_t i) const { return ioTimes.empty() ? 0 : ioTimes[i]; }
+    size_t getIoBurstCount(size_t i) const {
+        return ioCounts.empty() ? 0 : static_cast<size_t>(ioCounts[i]);
+    }
+    const IoBurst& getIoBurst(size_t i, size_t k) const { return ioBursts[ioFirst[i] + k]; }
+    int getIoNext(size_t i) const { return ioNext.empty() ? 0 : ioNext[i]; }
+    ProcessState getState(size_t i) const { return states[i]; }
+    std::string getName(size_t i) const {
+        return nameIds[i] == DEFAULT_NAME ? "P" + std::to_string(pids[i]) : names[nameIds[i]];
+    }
+
+    // Setters
+    void setPriority(size_t i, int priority) { priorities[i] = priority; }
+    void setRemainingTime(size_t i, int time) { remainingTimes[i] = time; }
+    void setWaitingTime(size_t i, int time) { waitingTimes[i] = time; }
+    void setTurnaroundTime(size_t i, int time) { turnaroundTimes[i] = time; }
+    void setResponseTime(size_t i, int time) { responseTimes[i] = time; }
+    void setCompletionTime(size_t i, int time) { completionTimes[i] = time; }
+    void setQueueLevel(size_t i, int level) { queueLevels[i] = level; }
+    void setHasStarted(size_t i, bool value) { started[i] = value ? 1 : 0; }
+    void setWaitStart(size_t i, int clock) { waitStarts[i] = clock; }
+    void setIoNext(size_t i, int burst) { ioNext[i] = burst; }
+    void setState(size_t i, ProcessState state) { states[i] = state; }
+    void setName(size_t i, const std::string& name) { nameIds[i] = internName(name); }
+
+    /**
+     * @brief Check if any row has I/O bursts
+     */
+    bool hasIo() const { return !ioFirst.empty(); }
+
+    /**
+     * @brief Append an I/O burst to a row
+     *
+     * Same rules as Process::addIoBurst(). A row whose bursts are not at
+     * the end of the pool is moved there first.
+     * @param i Row index
+     * @param after CPU time executed before the burst
+     * @param length Time spent blocked
+     * @return false (and no burst added) if after or length is out of range
+     */
+    bool addIoBurst(size_t i, int after, int length);
+
+    /**
+     * @brief CPU time a process can run before it blocks or finishes
+     * @param i Row index
+     * @return Time to the next I/O burst, or the remaining time if none is left
+     */
+    int cpuBeforeIo(size_t i) const {
+        if (ioFirst.empty() || ioNext[i] == ioCounts[i]) {
+            return remainingTimes[i];
+        }
+        return ioBursts[ioFirst[i] + ioNext[i]].after - (burstTimes[i] - remainingTimes[i]);
+    }
+
+    /**
+     * @brief Start the I/O burst a process has just reached
+     * @param i Row index
+     * @return Length of the burst (the cursor moves past it), 0 if none starts now
+     */
+    int takeIoBurst(size_t i) {
+        if (ioFirst.empty() || ioNext[i] == ioCounts[i] || remainingTimes[i] == 0) {
+            return 0;
+        }
+        const IoBurst& burst = ioBursts[ioFirst[i] + ioNext[i]];
+        if (burst.after != burstTimes[i] - remainingTimes[i]) {
+            return 0;
+        }
+        ioNext[i]++;
+        return burst.length;
+    }
+
+    /**
+     * @brief Check if a process has no CPU time left
+     * @param i Row index
+     */
+    bool isCompleted(size_t i) const { return remainingTimes[i] == 0; }
+
+    /**
+     * @brief Execute a process for a time slice (same rules as Process::execute)
+     * @param i Row index
+     * @param timeSlice Amount of time to execute
+     * @return Actual time executed
+     */
+    int execute(size_t i, int timeSlice);
+
+    /**
+     * @brief Reset one process to its initial state (same as Process::reset)
+     * @param i Row index
+     */
+    void resetProcess(size_t i);
+
+    /**
+     * @brief Reset every process to its initial state
+     */
+    void resetAll();
+
+    /**
+     * @brief Start a waiting interval
+     *
+     * Waiting time is measured on the scheduler's service clock (CPU time
+     * executed so far), so it only accrues while other processes run.
+     * @param i Row index
+     * @param clock Current service clock
+     */
+    void beginWait(size_t i, int clock) { waitStarts[i] = clock; }
+
+    /**
+     * @brief Close a waiting interval and add it to the waiting time
+     * @param i Row index
+     * @param clock Current service clock
+     */
+    void endWait(size_t i, int clock) { waitingTimes[i] += clock - waitStarts[i]; }
+
+    /**
+     * @brief Count processes that have not terminated
+     * @return Number of unfinished processes
+     */
+    size_t countUnfinished() const;
+
+    /**
+     * @brief Reorder rows by arrival time
+     *
+     * Uses std::sort (not stable), matching a sort of the equivalent
+     * std::vector<Process>. Columns are permuted in place through scratch
+     * kept in the table, so sorting again allocates nothing.
+     */
+    void sortByArrival();
+};
+
+#endif // PROCESS_TABLE_H
@@ -0,0 +1,113 @@
+/**
+ * @file ReplicaRunner.h
+ * @brief Monte Carlo replicas of seeded workloads with confidence intervals
+ * @version 1.0
+ */
+
+#ifndef REPLICA_RUNNER_H
+#define REPLICA_RUNNER_H
+
+#include "Scheduler.h"
+#include "Metrics.h"
+#include "Statistics.h"
+#include "WorkloadGenerator.h"
+#include <vector>
+#include <string>
+#include <iostream>
+
+/**
+ * @struct ReplicaOptions
+ * @brief Replica counts, stopping rule and algorithms of a replica run
+ */
+struct ReplicaOptions {
+    int minReplicas = 5;                        ///< Replicas before the first stopping check
+    int maxReplicas = 100;                      ///< Upper bound on replicas per algorithm
+    int batchSize = 8;                          ///< Replicas between stopping checks
+    double confidence = 0.95;                   ///< Confidence level of the intervals
+    double targetPrecision = 0.05;              ///< Half-width / |mean| to stop at (0 = run all)
+    int workerThreads = 0;                      ///< Pool size (0 = hardware threads)
+    std::vector<SchedulerType> algorithms;      ///< Algorithms to run (empty = all)
+};
+
+/**
+ * @struct ReplicaResult
+ * @brief Per-replica summaries and pooled metrics of one algorithm
+ */
+struct ReplicaResult {
+    SchedulerType algorithm;        ///< Algorithm that was run
+    std::string schedulerName;      ///< Display name of the algorithm
+    int replicas = 0;               ///< Replicas run
+    bool converged = false;         ///< Stopped because every interval met the target
+    SampleStats waiting;            ///< Average waiting time of each replica
+    SampleStats turnaround;         ///< Average turnaround time of each replica
+    SampleStats response;           ///< Average response time of each replica
+    SampleStats utilization;        ///< CPU utilization of each replica
+    SampleStats throughput;         ///< Throughput of each replica
+    Metrics pooled;                 ///< Every replica merged with Metrics::merge
+};
+
+/**
+ * @class ReplicaRunner
+ * @brief Runs algorithms over independently seeded workloads until stable
+ *
+ * Replica r draws its workload from the spec with seed + r, so replica 0
+ * is the workload -n and --seed give, and every algorithm sees the same
+ * replicas. This pairing narrows the intervals on differences between
+ * algorithms. Replicas run on a thread pool in rounds: minReplicas first,
+ * then batchSize at a time. After each round an algorithm stops once the
+ * waiting, turnaround and response intervals are all within
+ * targetPrecision of their means. Rounds do not depend on the thread
+ * count, and results are folded in replica order, so a given seed always
+ * gives the same replica count and the same numbers.
+ */
+class ReplicaRunner {
+private:
+    WorkloadSpec spec;              ///< Workload of replica 0
+    SchedulerConfig config;         ///< Configuration of every scheduler
+    ReplicaOptions options;         ///< Counts, stopping rule and algorithms
+
+    /**
+     * @brief Check whether every interval of a result meets the target
+     */
+    bool isConverged(const ReplicaResult& result) const;
+
+public:
+    /**
+     * @brief Constructor
+     * @param spec Workload of replica 0 (later replicas change the seed)
+     * @param config Scheduler configuration
+     * @param options Counts, stopping rule and algorithms
+     * @throws std::invalid_argument if the spec or an option is out of range
+     */
+    ReplicaRunner(const WorkloadSpec& spec, const SchedulerConfig& config,
+                  const ReplicaOptions& options = ReplicaOptions());
+
+    /**
+     * @brief Algorithms the runner will replicate
+     * @return Requested algorithms, or Simulator::defaultAlgorithms() if none were requested
+     */
+    std::vector<SchedulerType> getAlgorithms() const;
+
+    /**
+     * @brief Run replicas until every algorithm converges or hits maxReplicas
+     * @param progress Stream for one line per round (nullptr = quiet)
+     * @return One result per algorithm, in getAlgorithms() order
+     */
+    std::vector<ReplicaResult> run(std::ostream* progress = nullptr) const;
+
+    /**
+     * @brief Print each algorithm's means with their intervals
+     * @param out Destination stream
+     * @param results Results from run()
+     */
+    void printSummary(std::ostream& out, const std::vector<ReplicaResult>& results) const;
+
+    /**
+     * @brief Write results as a CSV table of means and half-widths
+     * @param out Destination stream
+     * @param results Results from run()
+     */
+    void writeTable(std::ostream& out, const std::vector<ReplicaResult>& results) const;
+};
+
+#endif // REPLICA_RUNNER_H
@@ -0,0 +1,97 @@
+/**
+ * @file RingQueue.h
+ * @brief FIFO ring buffer of process indices
+ * @version 1.0
+ */
+
+#ifndef RING_QUEUE_H
+#define RING_QUEUE_H
+
+#include <vector>
+#include <cstddef>
+
+/**
+ * @class RingQueue
+ * @brief Contiguous FIFO of ints that reuses its storage
+ *
+ * Capacity is kept at a power of two so wrap-around is a mask. Storage only
+ * grows when the queue is full; clear() keeps it for the next run.
+ */
+class RingQueue {
+private:
+    std::vector<int> slots;     ///< Ring storage (size is a power of two)
+    size_t head;                ///< Position of the front element
+    size_t count;               ///< Number of queued elements
+
+    void grow() {
+        size_t capacity = slots.empty() ? 16 : slots.size() * 2;
+        std::vector<int> larger(capacity);
+        for (size_t i = 0; i < count; ++i) {
+            larger[i] = slots[(head + i) & (slots.size() - 1)];
+        }
+        slots.swap(larger);
+        head = 0;
+    }
+
+public:
+    /**
+     * @brief Constructor
+     */
+    RingQueue() : head(0), count(0) {}
+
+    /**
+     * @brief Make room for at least a number of elements
+     * @param capacity Expected maximum queue length
+     */
+    void reserve(size_t capacity) {
+        while (slots.size() < capacity) {
+            grow();
+        }
+    }
+
+    /**
+     * @brief Append a value at the back
+     * @param value Value to enqueue
+     */
+    void push(int value) {
+        if (count == slots.size()) {
+            grow();
+        }
+        slots[(head + count) & (slots.size() - 1)] = value;
+        count++;
+    }
+
+    /**
+     * @brief Front value (queue must not be empty)
+     */
+    int front() const { return slots[head]; }
+
+    /**
+     * @brief Value at a position, counted from the front (must be < size())
+     */
+    int at(size_t pos) const { return slots[(head + pos) & (slots.size() - 1)]; }
+
+    /**
+     * @brief Remove and return the front value
+     * @return Dequeued value
+     */
+    int pop() {
+        int value = slots[head];
+        head = (head + 1) & (slots.size() - 1);
+        count--;
+        return value;
+    }
+
+    bool empty() const { return count == 0; }
+    size_t size() const { return count; }
+
+    /**
+     * @brief Remove all values, keeping the storage
+     */
+    void clear() {
+        head = 0;
+        count = 0;
+    }
+};
+
+#endif // RING_QUEUE_H
@@ -8,7 +8,7 @@
 #define ROUND_ROBIN_SCHEDULER_H
 
 #include "Scheduler.h"
-#include <queue>
+#include "RingQueue.h"
 
 /**
  * @class RoundRobinScheduler
@@ -21,7 +21,21 @@
 class RoundRobinScheduler : public Scheduler {
 private:
     int timeQuantum;                    ///< Time slice for each process
-    std::queue<int> processQueue;       ///< Queue of process indices
+    RingQueue processQueue;             ///< Circular queue of process indices
+    std::vector<char> enqueued;         ///< Per-process "in processQueue" flag
+    std::vector<RingQueue> cpuQueues;   ///< SMP: circular queue of each CPU
+
+    /**
+     * @brief Append a process to the queue unless it is already queued
+     * @param processIdx Process index
+     */
+    void enqueue(int processIdx);
+
+    /**
+     * @brief Admit arrivals up to a time and queue them in arrival order
+     * @param time Latest arrival time to admit (inclusive)
+     */
+    void enqueueArrivals(int time);
 
     /**
      * @brief Check if any process is waiting
@@ -29,6 +43,18 @@ private:
      */
     bool hasWaitingProcesses() const;
 
+protected:
+    /**
+     * @brief Size the enqueued flag of an injected process
+     */
+    void onProcessInjected(int idx) override;
+
+    /// SMP mode: one circular queue per CPU, slices of one quantum
+    void smpBegin(int cpuCount) override;
+    void smpEnqueue(int cpu, int idx) override { cpuQueues[cpu].push(idx); }
+    int smpDequeue(int cpu) override;
+    int smpSliceLength(int idx) const override;
+
 public:
     /**
      * @brief Constructor
@@ -50,9 +76,9 @@ public:
 
     /**
      * @brief Get next process from the queue
-     * @return Pointer to next process
+     * @return Index of next process, -1 if the queue is empty
      */
-    Process* getNextProcess() override;
+    int getNextProcess() override;
 
     /**
      * @brief Get algorithm name
@@ -66,6 +92,11 @@ public:
      */
     SchedulerType getType() const override { return SchedulerType::ROUND_ROBIN; }
 
+    /**
+     * @brief Round Robin runs on config.numCpus CPUs
+     */
+    bool supportsSmp() const override { return true; }
+
     /**
      * @brief Reset scheduler state
      */
@@ -0,0 +1,163 @@
+/**
+ * @file RunStats.h
+ * @brief Opt-in per-phase counters of the scheduling loops
+ * @version 1.0
+ */
+
+#ifndef RUN_STATS_H
+#define RUN_STATS_H
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @enum RunPhase
+ * @brief Parts of a scheduling loop timed by a profiling build
+ */
+enum class RunPhase : std::uint8_t {
+    ADMISSION,      ///< Taking arrivals and queueing them
+    SELECTION,      ///< Picking the next process to run
+    DEADLINES,      ///< Aging and priority boost sweeps
+    TIMELINE,       ///< Recording events, trace sink included
+    METRICS         ///< Computing the metrics at the end of a run
+};
+
+constexpr size_t RUN_PHASE_COUNT = 5;   ///< Number of RunPhase values
+
+/**
+ * @struct PhaseCounter
+ * @brief Calls and time spent in one phase
+ */
+struct PhaseCounter {
+    std::uint64_t calls = 0;        ///< Times the phase was entered
+    std::uint64_t nanoseconds = 0;  ///< Wall time inside the phase
+};
+
+/**
+ * @struct RunStats
+ * @brief Hot-path counters of one run, or of several merged
+ *
+ * Filled only when the tree is built with SCHEDULER_PROFILE defined
+ * (make profile); otherwise the SCHED_PROFILE macros compile to nothing
+ * and every counter stays 0. Time not covered by a phase is the loop's
+ * own bookkeeping: executing slices, switches and completions.
+ */
+struct RunStats {
+#ifdef SCHEDULER_PROFILE
+    static constexpr bool enabled = true;   ///< Built with SCHEDULER_PROFILE
+#else
+    static constexpr bool enabled = false;  ///< Built with SCHEDULER_PROFILE
+#endif
+
+    PhaseCounter phases[RUN_PHASE_COUNT];   ///< Counters by RunPhase
+    std::uint64_t events = 0;               ///< Timeline entries recorded
+    std::uint64_t runNanoseconds = 0;       ///< Wall time of run(), phases included
+    size_t runnable = 0;                    ///< Admitted processes not yet terminated
+    size_t peakRunnable = 0;                ///< Most processes READY or RUNNING at once
+    size_t peakDeadlines = 0;               ///< Most pending deadlines, sampled at admission
+    int runs = 0;                           ///< Runs these counters cover
+
+    PhaseCounter& counter(RunPhase phase) { return phases[static_cast<size_t>(phase)]; }
+    const PhaseCounter& counter(RunPhase phase) const {
+        return phases[static_cast<size_t>(phase)];
+    }
+
+    /**
+     * @brief Count processes taken from the arrival index
+     * @param count Processes admitted
+     * @param deadlines Deadlines pending at the time
+     */
+    void noteAdmitted(size_t count, size_t deadlines) {
+        runnable += count;
+        if (runnable > peakRunnable) {
+            peakRunnable = runnable;
+        }
+        if (deadlines > peakDeadlines) {
+            peakDeadlines = deadlines;
+        }
+    }
+
+    /**
+     * @brief Count a terminated process
+     */
+    void noteCompleted() {
+        if (runnable > 0) {
+            runnable--;
+        }
+    }
+
+    /**
+     * @brief Clear the counters for a new run
+     */
+    void reset() { *this = RunStats(); }
+
+    /**
+     * @brief Add another run's counters; peaks take the larger value
+     */
+    void merge(const RunStats& other);
+
+    /**
+     * @brief Time spent in all phases together
+     */
+    std::uint64_t phaseNanoseconds() const;
+
+    /**
+     * @brief Timeline events per second of run() time
+     * @return Rate, 0 if no time was measured
+     */
+    double eventsPerSecond() const;
+
+    /**
+     * @brief Share of run() time spent in a phase
+     * @return Fraction in [0, 1], 0 if no time was measured
+     */
+    double share(RunPhase phase) const;
+
+    /**
+     * @brief Lower-case name of a phase ("admission", "selection", ...)
+     */
+    static const char* phaseName(RunPhase phase);
+};
+
+/**
+ * @class PhaseTimer
+ * @brief Adds the lifetime of a scope to a phase counter
+ */
+class PhaseTimer {
+private:
+    PhaseCounter& counter;                              ///< Counter to add to
+    std::chrono::steady_clock::time_point start;        ///< Entry time
+
+public:
+    explicit PhaseTimer(PhaseCounter& counter)
+        : counter(counter)
+        , start(std::chrono::steady_clock::now())
+    {}
+
+    ~PhaseTimer() {
+        counter.calls++;
+        counter.nanoseconds += static_cast<std::uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now() - start).count());
+    }
+
+    PhaseTimer(const PhaseTimer&) = delete;
+    PhaseTimer& operator=(const PhaseTimer&) = delete;
+};
+
+// Instrumentation points inside Scheduler members, where runStats is in scope.
+// SCHED_PROFILE_PHASE times the rest of the enclosing block as a RunPhase;
+// SCHED_PROFILE runs a statement only in profiling builds.
+#define SCHED_PROFILE_CONCAT2(a, b) a##b
+#define SCHED_PROFILE_CONCAT(a, b) SCHED_PROFILE_CONCAT2(a, b)
+#ifdef SCHEDULER_PROFILE
+#define SCHED_PROFILE_PHASE(phase) \
+    PhaseTimer SCHED_PROFILE_CONCAT(phaseTimer, __LINE__)(runStats.counter(phase))
+#define SCHED_PROFILE(statement) statement
+#else
+#define SCHED_PROFILE_PHASE(phase) ((void)0)
+#define SCHED_PROFILE(statement) ((void)0)
+#endif
+
+#endif // RUN_STATS_H
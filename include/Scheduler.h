@@ -8,12 +8,24 @@
 #define SCHEDULER_H
 
 #include "Process.h"
+#include "ProcessTable.h"
 #include "Metrics.h"
+#include "EventQueue.h"
+#include "IndexedHeap.h"
+#include "LevelMask.h"
+#include "TimerWheel.h"
+#include "Workload.h"
+#include "RunStats.h"
 #include <vector>
 #include <queue>
 #include <memory>
+#include <memory_resource>
 #include <string>
 #include <functional>
+#include <unordered_map>
+#include <cstdint>
+#include <climits>
+#include <chrono>
 
 /**
  * @enum SchedulerType
@@ -24,7 +36,10 @@ enum class SchedulerType {
     PRIORITY_PREEMPTIVE,
     PRIORITY_NON_PREEMPTIVE,
     MULTILEVEL_QUEUE,
-    MULTILEVEL_FEEDBACK_QUEUE
+    MULTILEVEL_FEEDBACK_QUEUE,
+    FAIR,                       ///< Policy engine only
+    SHORTEST_JOB_FIRST,         ///< Policy engine only
+    SHORTEST_REMAINING_TIME     ///< Policy engine only
 };
 
 /**
@@ -38,18 +53,82 @@ struct SchedulerConfig {
     std::vector<int> quantums;      ///< Quantum for each queue level
     bool agingEnabled = true;       ///< Enable aging to prevent starvation
     int agingThreshold = 10;        ///< Time before priority boost
+    bool eventDriven = true;        ///< Jump between events instead of ticking
+    bool keepTimeline = true;       ///< Store the whole timeline (false: newest event only)
+    bool keepProcessMetrics = true; ///< Store per-process times in Metrics
+    int numCpus = 1;                ///< Simulated CPUs (SMP mode if more than one)
+    bool pushMigration = true;      ///< SMP: place work on the least-loaded CPU
+    bool workStealing = true;       ///< SMP: idle CPUs take work from the longest queue
+    int migrationCost = 1;          ///< SMP: switch time added when a process changes CPU
+    int targetLatency = 20;         ///< Fair: period in which every runnable process runs once
+    int minGranularity = 2;         ///< Fair: shortest slice, stretches the period when crowded
+    bool policyEngine = false;      ///< Build schedulers from SchedulerEngine instantiations
+};
+
+/**
+ * @enum EventKind
+ * @brief What happened during a timeline entry
+ */
+enum class EventKind : std::uint8_t {
+    EXECUTE,        ///< Process ran (and finished or continues)
+    CONTEXT_SWITCH, ///< Switch overhead between two processes
+    IDLE,           ///< CPU had nothing to run
+    PREEMPT,        ///< Process ran and was then preempted
+    DEMOTE,         ///< Process used its full quantum and was demoted
+    BLOCK           ///< Process ran up to an I/O burst and blocked
 };
 
 /**
  * @struct ExecutionEvent
  * @brief Records a single execution event for visualization
+ *
+ * Kept to plain fields so long timelines stay compact; the text shown
+ * for an event is built on demand by describe().
  */
 struct ExecutionEvent {
-    int processId;
-    int startTime;
-    int endTime;
-    bool isContextSwitch;
-    std::string description;
+    int processId;                      ///< Process ID (-1 for idle and context switches)
+    int startTime;                      ///< Start of the entry
+    int endTime;                        ///< End of the entry
+    EventKind kind = EventKind::EXECUTE; ///< What happened
+    std::uint16_t cpu = 0;              ///< CPU of the entry (SMP runs; fits the padding)
+
+    bool isContextSwitch() const { return kind == EventKind::CONTEXT_SWITCH; }
+
+    /**
+     * @brief Human-readable description ("Execute P3", "Context Switch", ...)
+     */
+    std::string describe() const;
+};
+
+class TraceSink;
+class ArrivalSource;
+struct SchedulerSnapshot;
+
+/**
+ * @struct ArrivalRange
+ * @brief Contiguous run of process indices taken from the arrival index
+ */
+struct ArrivalRange {
+    const int* first;   ///< First process index in the range
+    const int* last;    ///< One past the last process index
+
+    const int* begin() const { return first; }
+    const int* end() const { return last; }
+    size_t size() const { return static_cast<size_t>(last - first); }
+    bool empty() const { return first == last; }
+};
+
+/**
+ * @struct CpuState
+ * @brief One simulated CPU of an SMP run
+ */
+struct CpuState {
+    int running = -1;       ///< Process index on the CPU, -1 if idle
+    int lastPid = -1;       ///< Pid of the process it ran last, -1 if none yet
+    int sliceStart = 0;     ///< Time the running slice starts executing (after the switch)
+    int sliceEnd = 0;       ///< Time the running slice ends
+    int busyTime = 0;       ///< Execution time this run
+    int queued = 0;         ///< Processes in the CPU's ready queue
 };
 
 /**
@@ -61,15 +140,63 @@ struct ExecutionEvent {
  */
 class Scheduler {
 protected:
-    std::vector<Process> processes;          ///< All processes in the system
-    std::vector<Process> readyQueue;         ///< Processes ready to execute
+    ProcessTable processes;                  ///< All processes in the system
+    std::vector<int> readyQueue;             ///< Indices of admitted processes
     std::vector<ExecutionEvent> timeline;    ///< Execution timeline for visualization
     SchedulerConfig config;                  ///< Scheduler configuration
     Metrics metrics;                         ///< Performance metrics
     int currentTime;                         ///< Current simulation time
     int contextSwitches;                     ///< Number of context switches
-    Process* currentProcess;                 ///< Currently executing process
+    int serviceClock;                        ///< CPU time executed this run
+    int currentProcess;                      ///< Index of executing process (-1 if none)
     bool isRunning;                          ///< Simulation running flag
+    EventQueue events;                       ///< Pending aging and boost deadlines
+    TimerWheel ioTimers;                     ///< I/O completions of WAITING processes
+    std::vector<int> arrivalOrder;           ///< Process indices sorted by arrival
+    size_t arrivalCursor;                    ///< Next arrivalOrder entry to admit
+    TraceSink* sink;                         ///< Receives events and completions (not owned)
+    int idleTime;                            ///< Idle gaps between execution events
+    int lastExecutionEnd;                    ///< End of the latest execution event
+    ArrivalSource* arrivalSource;            ///< Injects processes during runs (not owned)
+    int arrivalHorizon;                      ///< Latest arrival time taken from the source
+    size_t injectedCount;                    ///< Rows at the end of the table from the source
+    std::shared_ptr<const Workload> workload; ///< Shared processes reloaded every run, if any
+    int lastInjectedArrival;                 ///< Arrival time of the newest injected row
+    bool sourceDrained;                      ///< Source has nothing more before the horizon
+    std::vector<int> pidSlots;               ///< Dense slot of each row's pid
+    std::unordered_map<int, int> pidSlotIndex; ///< Pid to slot when pids are not in [0, rows)
+    size_t pidSlotCount;                     ///< Slots handed out (size for per-pid vectors)
+    std::pmr::monotonic_buffer_resource runArena;  ///< Bulk storage for per-run containers
+    std::pmr::unsynchronized_pool_resource runPool; ///< Recycles per-run nodes, backed by runArena
+    RunStats runStats;                       ///< Profiling counters of the last run
+    std::chrono::steady_clock::time_point runStarted; ///< Profiling: when the last run began
+
+    /// SMP heap orders over CPU indices; ties go to the lower CPU
+    struct SliceEndOrder {
+        const std::vector<CpuState>* cpus;
+        bool operator()(int a, int b) const;
+    };
+    struct LeastLoadedOrder {
+        const std::vector<CpuState>* cpus;
+        bool operator()(int a, int b) const;
+    };
+    struct LongestQueueOrder {
+        const std::vector<CpuState>* cpus;
+        bool operator()(int a, int b) const;
+    };
+
+    std::vector<CpuState> cpus;              ///< SMP: state of each CPU
+    std::vector<int> queuedCpu;              ///< SMP: CPU whose queue holds or ran a process
+    std::vector<int> lastCpu;                ///< SMP: CPU a process last ran on, -1 if none
+    IndexedHeap<SliceEndOrder> sliceEnds;    ///< SMP: busy CPUs by end of their slice
+    IndexedHeap<LeastLoadedOrder> leastLoaded;  ///< SMP: CPUs by queued plus running
+    IndexedHeap<LongestQueueOrder> longestQueue; ///< SMP: CPUs by queue length, longest first
+    LevelMask idleCpus;                      ///< SMP: CPUs with nothing running
+    LevelMask readyCpus;                     ///< SMP: idle CPUs given work since the last dispatch
+    std::vector<int> requeued;               ///< SMP: unfinished slices waiting to be queued again
+    size_t queuedTotal;                      ///< SMP: processes in all CPU queues
+    int switchTime;                          ///< SMP: switch and migration time of all CPUs
+    int migrations;                          ///< SMP: dispatches on a different CPU
 
     /**
      * @brief Add arrived processes to ready queue
@@ -77,18 +204,311 @@ protected:
      */
     virtual void checkArrivals(int time);
 
+    /**
+     * @brief Build the arrival index over the current processes
+     *
+     * Sorts process indices by arrival time (ties keep process order) and
+     * rewinds the arrival cursor. Called at the start of run(), after
+     * processes are in their final order. With an arrival source attached,
+     * the first injected process is pulled as well.
+     */
+    void buildArrivalIndex();
+
+    /**
+     * @brief Start a run from the static workload
+     *
+     * Drops the processes injected by the previous run (reloading the
+     * shared workload, if one is set) and rewinds the arrival source.
+     * Called first in run(), so repeated runs see the same arrivals.
+     */
+    void rewindArrivals();
+
+    /**
+     * @brief Reload the shared workload, or drop the injected rows without one
+     */
+    void reloadProcesses();
+
+    /**
+     * @brief Clear the profiling counters and start timing a run
+     *
+     * Called by rewindArrivals(), and by loadRunState() so a resumed run
+     * is profiled from the resume on.
+     */
+    void beginRunStats();
+
+    /**
+     * @brief Copy the state every run loop shares into a snapshot
+     *
+     * Table, arrival cursor, deadlines, timeline, clocks and counters; the
+     * scheduler adds its own loop and policy state.
+     * @param snapshot Snapshot to fill
+     */
+    void saveRunState(SchedulerSnapshot& snapshot) const;
+
+    /**
+     * @brief Load the state saved by saveRunState() to resume a run
+     *
+     * Replaces the table, rebuilds the arrival index and moves its cursor
+     * past the processes already admitted.
+     * @param snapshot Snapshot to resume
+     * @throws std::invalid_argument if the snapshot is inconsistent
+     * @throws std::logic_error if an arrival source is attached
+     */
+    void loadRunState(const SchedulerSnapshot& snapshot);
+
+    /**
+     * @brief Inject source arrivals until one arrives after a time
+     *
+     * Injected processes are appended to the table and merged into the
+     * unconsumed part of the arrival index, so the index always holds the
+     * next arrival and nextArrivalTime() stays exact.
+     * @param time Latest arrival time that must be in the index
+     */
+    void pullArrivals(int time);
+
+    /**
+     * @brief Give every row's pid a dense slot, once per run
+     *
+     * Per-pid state can then live in vectors indexed by pidSlot() instead
+     * of maps keyed by pid; rows sharing a pid share a slot, as they would
+     * share a map entry. When every pid is in [0, rows) the slot is the pid
+     * itself. Otherwise pids are numbered in first-seen order through a
+     * hash map that is consulted only here and by addPidSlot().
+     */
+    void buildPidSlots();
+
+    /**
+     * @brief Give an injected row's pid a slot
+     * @param idx Index of the new row (the table's last row)
+     */
+    void addPidSlot(int idx);
+
+    /**
+     * @brief Dense slot of a row's pid (valid after buildPidSlots())
+     */
+    int pidSlot(int idx) const { return pidSlots[idx]; }
+
+    /**
+     * @brief Memory resource for containers that live for one run
+     *
+     * Map nodes and queue blocks come from a pool over a monotonic arena,
+     * so a run costs a few bulk allocations instead of one per node.
+     */
+    std::pmr::memory_resource* runMemory() { return &runPool; }
+
+    /**
+     * @brief Release all per-run container memory in one shot
+     *
+     * Schedulers with containers on runMemory() override this to drop
+     * them first and then call the base version. Called by reset().
+     * Runs in between empty their containers in place instead: the pool
+     * hands the freed blocks to the next run, so reruns neither grow the
+     * arena nor allocate.
+     */
+    virtual void releaseRunMemory();
+
+    /**
+     * @brief Per-process setup for a row injected during a run
+     *
+     * Called after the row is appended and indexed. Schedulers that keep
+     * per-process state sized at the start of run() grow it here.
+     * @param idx Index of the new row
+     */
+    virtual void onProcessInjected(int idx) { (void)idx; }
+
+    /**
+     * @brief Run the processes on config.numCpus CPUs
+     *
+     * The SMP engine shared by the policies that support it. Each CPU has
+     * its own ready queue, kept by the policy through the smp*() hooks.
+     * Arrivals go to the least-loaded CPU with push migration, otherwise to
+     * a home CPU chosen by pid; a slice that ends unfinished is queued on
+     * its CPU again, unless push migration finds a CPU with two fewer
+     * processes. An idle CPU with an empty queue steals the next process
+     * of the longest queue. A dispatch pays contextSwitchTime when the CPU
+     * last ran another process, plus migrationCost when the process last
+     * ran on another CPU.
+     *
+     * Busy CPUs sit in a heap keyed by the end of their slice; idle CPUs
+     * and loads are kept in masks and heaps over CPUs. An event therefore
+     * costs O(log CPUs), and no queue is scanned. Waiting time is
+     * turnaround minus burst. Metrics get per-CPU utilization.
+     */
+    void runSmp();
+
+    /**
+     * @brief Set up the per-CPU queues and policy state of an SMP run
+     *
+     * Called by runSmp() after the arrival index is built, so deadlines
+     * pushed here are kept.
+     * @param cpuCount Number of CPUs
+     */
+    virtual void smpBegin(int cpuCount) { (void)cpuCount; }
+
+    /**
+     * @brief Queue a READY process on a CPU
+     */
+    virtual void smpEnqueue(int cpu, int idx) { (void)cpu; (void)idx; }
+
+    /**
+     * @brief Remove the process a CPU's queue would run next
+     * @return Process index, -1 if the queue is empty
+     */
+    virtual int smpDequeue(int cpu) { (void)cpu; return -1; }
+
+    /**
+     * @brief Length of the slice a dispatched process is given
+     */
+    virtual int smpSliceLength(int idx) const { return processes.getRemainingTime(idx); }
+
+    /**
+     * @brief Policy bookkeeping after a slice, finished or not
+     * @param idx Process index (remaining time already reduced)
+     * @param ran Time the process executed in the slice
+     * @return Kind of the slice's timeline entry if the process did not finish
+     */
+    virtual EventKind smpSliceEnd(int idx, int ran) { (void)idx; (void)ran; return EventKind::PREEMPT; }
+
+    /**
+     * @brief Check if a queued process preempts the one running on its CPU
+     */
+    virtual bool smpPreempts(int idx, int running) const { (void)idx; (void)running; return false; }
+
+    /**
+     * @brief Handle the policy's deadlines due at currentTime
+     *
+     * Deadlines still due afterwards are discarded.
+     */
+    virtual void smpDeadlines() {}
+
+    /**
+     * @brief Preempt a CPU's running process if a queued process outranks it
+     * @param cpu CPU the process is queued on
+     * @param idx Queued process
+     */
+    void smpPreemptFor(int cpu, int idx);
+
+    /**
+     * @brief Re-sift a CPU in the load heaps after its queue or running process changed
+     */
+    void smpUpdateLoad(int cpu);
+
+    /**
+     * @brief Queue a process on a CPU, waking or preempting it
+     */
+    void smpPlace(int idx, int cpu);
+
+    /**
+     * @brief Dispatch the next process of a CPU's queue on a CPU
+     * @param cpu CPU to run it on
+     * @param from CPU whose queue to take it from (another CPU when stealing)
+     */
+    void smpStart(int cpu, int from);
+
+    /**
+     * @brief End a CPU's running slice at a time
+     * @return true if the process finished
+     */
+    bool smpEndSlice(int cpu, int end);
+
+    /**
+     * @brief Start idle CPUs that have work, stealing for those that have none
+     */
+    void smpDispatch();
+
+    /**
+     * @brief Take every not-yet-admitted process arriving up to a time
+     *
+     * Advances the arrival cursor, so successive calls return disjoint
+     * windows and admission costs O(new arrivals).
+     * @param time Latest arrival time to take (inclusive)
+     * @return Process indices in arrival order
+     */
+    ArrivalRange takeArrivals(int time);
+
+    /**
+     * @brief Processes whose arrival time falls in [t0, t1]
+     * Binary search over the arrival index; does not move the cursor.
+     * @param t0 Window start (inclusive)
+     * @param t1 Window end (inclusive)
+     * @return Process indices in arrival order
+     */
+    ArrivalRange arrivalsBetween(int t0, int t1) const;
+
+    /**
+     * @brief Arrival time of the next process not yet taken
+     * @return Arrival time, INT_MAX if every process has arrived
+     */
+    int nextArrivalTime() const;
+
+    /**
+     * @brief Time of the next arrival, pending deadline or I/O completion
+     * @return Event time, INT_MAX if nothing is pending
+     */
+    int nextEventTime() const;
+
+    /**
+     * @brief Admit every process arriving since the last admission
+     * Marks them READY and appends them to readyQueue in arrival order.
+     * @param time Latest arrival time to admit (inclusive)
+     * @return Indices of the processes taken, in arrival order
+     */
+    ArrivalRange admitArrivals(int time);
+
+    /**
+     * @brief Length of a preemptible slice starting at a given time
+     *
+     * The tick loop re-evaluates every time unit. The event engine runs on
+     * until the next arrival or pending deadline, since nothing can change
+     * the decision before then.
+     * @param start Time the slice starts
+     * @param budget Time until the process's own completion or quantum expiry
+     * @return Slice length (1 in tick mode)
+     */
+    int eventSlice(int start, int budget) const;
+
+    /**
+     * @brief Advance the clock while the CPU has nothing to run
+     * Moves to the next pending event, or one tick in tick mode.
+     */
+    void advanceIdleTime();
+
     /**
      * @brief Perform context switch
-     * @param from Previous process (nullptr if none)
-     * @param to Next process
+     * @param from Previous process index (-1 if none)
+     * @param to Next process index
      */
-    virtual void performContextSwitch(Process* from, Process* to);
+    virtual void performContextSwitch(int from, int to);
 
     /**
      * @brief Record an execution event
+     *
+     * The previous event is final at this point and goes to the sink; without
+     * keepTimeline it is then dropped, so timeline.back() stays the newest event.
+     */
+    void recordEvent(int pid, int start, int end, EventKind kind = EventKind::EXECUTE,
+                     int cpu = 0);
+
+    /**
+     * @brief Clear the timeline for a new run
+     *
+     * Reserves capacity from a slice-count estimate when the timeline is
+     * kept: each process is assumed to run in ceil(burst / sliceLength) slices.
+     * @param sliceLength Typical slice length
+     * @param eventsPerSlice Timeline entries recorded per slice
+     */
+    void startTimeline(int sliceLength, int eventsPerSlice = 1);
+
+    /**
+     * @brief Publish the newest event and flush the sink at the end of a run
      */
-    void recordEvent(int pid, int start, int end, bool isSwitch, 
-                     const std::string& desc = "");
+    void finishTimeline();
+
+    /**
+     * @brief Publish a terminated process to the sink
+     * @param idx Process index (completion and turnaround already set)
+     */
+    void recordCompletion(int idx);
 
 public:
     /**
@@ -119,11 +539,56 @@ public:
      */
     virtual void run() = 0;
 
+    /**
+     * @brief Check if runs can be paused, saved and resumed
+     * @return true for the policy-engine schedulers; the rest only run()
+     */
+    virtual bool supportsSnapshots() const { return false; }
+
+    /**
+     * @brief Check if runs block processes on their I/O bursts
+     * @return true for the policy-engine schedulers; the rest ignore I/O bursts
+     */
+    virtual bool supportsIo() const { return false; }
+
+    /**
+     * @brief Start a run and pause it at the first decision at or after a time
+     *
+     * A paused run has no metrics yet. snapshot() saves it, and resume()
+     * goes on with it, in this scheduler or another of the same type.
+     * @param time Simulation time to pause at
+     * @return true if every process finished before the pause
+     * @throws std::logic_error if supportsSnapshots() is false
+     */
+    virtual bool runUntil(int time);
+
+    /**
+     * @brief Save the runtime state of a paused run
+     * @return Snapshot for resume()
+     * @throws std::logic_error if no run is paused, an arrival source is
+     *         attached, or supportsSnapshots() is false
+     */
+    virtual SchedulerSnapshot snapshot() const;
+
+    /**
+     * @brief Go on with a snapshotted run under this scheduler's configuration
+     *
+     * The processes are replaced by the snapshot's. Queued processes keep
+     * their order; state the configuration fixes (levels, quanta, aging
+     * thresholds) follows this scheduler's from here on.
+     * @param snapshot Snapshot of a scheduler of the same type
+     * @param until Simulation time to pause at again
+     * @return true if every process finished (metrics are computed then)
+     * @throws std::invalid_argument if the snapshot is of another type or inconsistent
+     * @throws std::logic_error if supportsSnapshots() is false
+     */
+    virtual bool resume(const SchedulerSnapshot& snapshot, int until = INT_MAX);
+
     /**
      * @brief Get the next process to execute
-     * @return Pointer to next process, nullptr if none ready
+     * @return Index of next process, -1 if none ready
      */
-    virtual Process* getNextProcess() = 0;
+    virtual int getNextProcess() = 0;
 
     /**
      * @brief Get the name of the scheduling algorithm
@@ -152,29 +617,143 @@ public:
      */
     virtual void calculateMetrics();
 
+    /**
+     * @brief Check the event-driven engine against the tick-based loop
+     *
+     * Runs the current processes once in tick mode and once event-driven.
+     * Both runs must produce identical Metrics and, after merging
+     * back-to-back slices of the same process, identical timelines.
+     * The scheduler keeps the event-driven results. Both runs keep their
+     * whole timeline, and only the event-driven run reaches the trace sink.
+     * @param mismatch Optional output describing the first difference
+     * @return true if both engines agree
+     */
+    bool verifyEventEngine(std::string* mismatch = nullptr);
+
     /**
      * @brief Get computed metrics
-     * @return Metrics object
+     * @return Metrics of the last run (valid until the next run or reset)
+     */
+    const Metrics& getMetrics() const { return metrics; }
+
+    /**
+     * @brief Get the hot-path counters of the last run
+     *
+     * Counters are filled only in SCHEDULER_PROFILE builds
+     * (RunStats::enabled); otherwise they are all 0.
+     * @return Counters of the last run (valid until the next run)
      */
-    Metrics getMetrics() const { return metrics; }
+    const RunStats& getRunStats() const { return runStats; }
 
     /**
      * @brief Get execution timeline
-     * @return Vector of execution events
+     * @return Execution events of the last run (valid until the next run or reset)
      */
-    std::vector<ExecutionEvent> getTimeline() const { return timeline; }
+    const std::vector<ExecutionEvent>& getTimeline() const { return timeline; }
+
+    /**
+     * @brief Move the execution timeline out of the scheduler
+     *
+     * Avoids copying large timelines; the scheduler's timeline is left empty.
+     * @return Execution events of the last run
+     */
+    std::vector<ExecutionEvent> takeTimeline();
+
+    /**
+     * @brief Move the metrics out of the scheduler
+     *
+     * For callers that discard the scheduler after a run; the scheduler's
+     * metrics are left reset.
+     * @return Metrics of the last run
+     */
+    Metrics takeMetrics();
 
     /**
      * @brief Get current ready queue state
      * @return Vector of processes in ready queue
      */
-    std::vector<Process> getReadyQueue() const { return readyQueue; }
+    std::vector<Process> getReadyQueue() const;
+
+    /**
+     * @brief Get the ready queue without copying processes
+     * @return Process table indices, front of the queue first
+     */
+    const std::vector<int>& getReadyIndices() const { return readyQueue; }
 
     /**
      * @brief Get all processes
+     *
+     * Builds Process objects from the table; use getProcessTable() to read
+     * the processes without copying.
      * @return Vector of all processes
      */
-    std::vector<Process> getProcesses() const { return processes; }
+    std::vector<Process> getProcesses() const { return processes.toProcesses(); }
+
+    /**
+     * @brief Get the process table
+     * @return Column-wise view of all processes
+     */
+    const ProcessTable& getProcessTable() const { return processes; }
+
+    /**
+     * @brief Replace all processes with a prepared table
+     * @param table Processes to schedule (moved in)
+     */
+    void setProcessTable(ProcessTable table) {
+        processes = std::move(table);
+        injectedCount = 0;
+        workload.reset();
+    }
+
+    /**
+     * @brief Schedule a shared workload
+     *
+     * The workload's rows are copied into this scheduler's table, and
+     * again (in place) at the start of every run and on reset(), so aged
+     * priorities and reordered rows never carry over into the next run and
+     * a run repeats exactly. Once the table has grown to the workload's
+     * size, loading it again allocates nothing. addProcess(),
+     * clearProcesses(), setProcessTable() and resume() detach the workload.
+     * @param shared Workload to schedule (never modified; nullptr to detach)
+     */
+    void setWorkload(std::shared_ptr<const Workload> shared);
+    const std::shared_ptr<const Workload>& getWorkload() const { return workload; }
+
+    /**
+     * @brief Attach a sink that receives events and completions during runs
+     * @param traceSink Sink to use (not owned, nullptr to detach)
+     */
+    void setTraceSink(TraceSink* traceSink) { sink = traceSink; }
+    TraceSink* getTraceSink() const { return sink; }
+
+    /**
+     * @brief Attach a source of processes that arrive during runs
+     *
+     * Each run() rewinds the source and injects its arrivals up to the
+     * horizon in addition to the static processes; processes admitted by
+     * then run to completion. The table keeps the injected processes
+     * until the next run, reset() or process change.
+     * @param source Source to pull from (not owned, nullptr to detach)
+     * @param horizon Latest arrival time to inject
+     */
+    void setArrivalSource(ArrivalSource* source, int horizon = INT_MAX);
+    ArrivalSource* getArrivalSource() const { return arrivalSource; }
+
+    /**
+     * @brief Get the number of processes the last run injected
+     */
+    size_t getInjectedCount() const { return injectedCount; }
+
+    /**
+     * @brief Check if run() honours config.numCpus
+     * @return true for policies with an SMP mode; the rest simulate one CPU
+     */
+    virtual bool supportsSmp() const { return false; }
+
+    /**
+     * @brief Get the number of dispatches that moved a process to another CPU
+     */
+    int getMigrations() const { return migrations; }
 
     /**
      * @brief Get current simulation time
@@ -190,9 +769,9 @@ public:
 
     /**
      * @brief Get current running process
-     * @return Pointer to current process, nullptr if none
+     * @return Index of current process, -1 if none
      */
-    Process* getCurrentProcess() const { return currentProcess; }
+    int getCurrentProcess() const { return currentProcess; }
 
     /**
      * @brief Set scheduler configuration
@@ -204,7 +783,7 @@ public:
      * @brief Get scheduler configuration
      * @return Current configuration
      */
-    SchedulerConfig getConfig() const { return config; }
+    const SchedulerConfig& getConfig() const { return config; }
 
     /**
      * @brief Print Gantt chart of execution
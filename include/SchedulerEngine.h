@@ -0,0 +1,414 @@
+/**
+ * @file SchedulerEngine.h
+ * @brief Scheduling loop composed from compile-time policies
+ * @version 1.0
+ */
+
+#ifndef SCHEDULER_ENGINE_H
+#define SCHEDULER_ENGINE_H
+
+#include "Scheduler.h"
+#include "SchedulingPolicies.h"
+#include "SchedulerSnapshot.h"
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <climits>
+#include <stdexcept>
+
+/**
+ * @class SchedulerEngine
+ * @brief One single-CPU run loop shared by every policy combination
+ *
+ * Each iteration admits arrivals, selects a process, executes a slice and
+ * accounts for it. The policies are template parameters, so the loop calls
+ * them directly and the compiler can inline them; nothing in the loop is
+ * virtual.
+ *
+ * - QueuePolicy holds the READY processes: admit(), push(), wake() for a
+ *   process back from I/O, pop(), front(), the quantum of a process,
+ *   outranks() and yieldKind() for a slice that ends unfinished. Built
+ *   from the config and the engine's table.
+ * - PreemptionPolicy sets the slice length and whether the process yields
+ *   the CPU afterwards (RunToCompletion, QuantumExpiry, OutrankPreemption).
+ * - AgingPolicy handles deadlines around admission (NoAging, PriorityAging,
+ *   PeriodicBoost).
+ * - AccountingPolicy says how switches, waiting and idle time are charged.
+ *   The classic schedulers differ here, and the aliases below pick the one
+ *   each of them uses, so an instantiation reproduces its class exactly.
+ *
+ * Policies reach the engine's state through friendship. The engine
+ * simulates one CPU; supportsSmp() is false. The loop state lives in
+ * members, so a run can stop at a decision point and go on later, from
+ * a snapshot if need be (runUntil(), snapshot(), resume()).
+ *
+ * Processes with I/O bursts block when they reach one: a slice never runs
+ * past the next burst, the process goes to WAITING with a timer in the
+ * base class's wheel, and admission wakes it back to READY when the timer
+ * fires. Blocking and waking are O(1), and the wheel's next timer is one
+ * of the times the event-driven loop jumps to.
+ */
+template <class QueuePolicy, class PreemptionPolicy, class AgingPolicy,
+          class AccountingPolicy = ServiceAccounting>
+class SchedulerEngine : public Scheduler {
+private:
+    friend PreemptionPolicy;
+    friend AgingPolicy;
+
+    std::string name;           ///< Display name
+    SchedulerType type;         ///< Type reported by getType()
+    QueuePolicy queue;          ///< READY processes
+    AgingPolicy aging;          ///< Deadlines and their state
+    int running;                ///< Process index on the CPU, -1 if none
+    int lastPid;                ///< Pid the CPU ran last, -1 if none
+    size_t completed;           ///< Processes terminated this run
+    bool paused;                ///< A run stopped before finishing
+
+    /**
+     * @brief Set up a run of the static workload
+     */
+    void start();
+
+    /**
+     * @brief Run the loop until every process finished or the clock reaches a time
+     * @param until Pause at the first decision at or after this time
+     * @return true if the run finished (metrics are computed then)
+     */
+    bool advance(int until);
+
+    /**
+     * @brief Move every process arriving or back from I/O by now to READY
+     */
+    void admitArrived() {
+        SCHED_PROFILE_PHASE(RunPhase::ADMISSION);
+        ioTimers.expire(currentTime, [this](int idx) {
+            processes.setState(idx, ProcessState::READY);
+            processes.beginWait(idx, serviceClock);
+            queue.wake(idx);
+            aging.onReady(*this, idx);
+        });
+        for (int idx : takeArrivals(currentTime)) {
+            processes.setState(idx, ProcessState::READY);
+            processes.beginWait(idx, serviceClock);
+            queue.admit(idx);
+            aging.onReady(*this, idx);
+        }
+    }
+
+    /**
+     * @brief Return a process that yielded the CPU to its queue
+     */
+    void markReady(int idx) {
+        processes.setState(idx, ProcessState::READY);
+        processes.beginWait(idx, serviceClock);
+        queue.push(idx);
+        aging.onReady(*this, idx);
+    }
+
+    /**
+     * @brief Check if a queued process outranks a running one
+     */
+    bool outranked(int idx) const {
+        const int candidate = queue.front();
+        return candidate != -1 && queue.outranks(candidate, idx);
+    }
+
+    /**
+     * @brief Charge the switch to a process when the CPU last ran another pid
+     */
+    void chargeSwitch(bool switched) {
+        if (!switched) {
+            return;
+        }
+        if (AccountingPolicy::switchEvents) {
+            recordEvent(-1, currentTime, currentTime + config.contextSwitchTime,
+                        EventKind::CONTEXT_SWITCH);
+        }
+        if (AccountingPolicy::countSwitches) {
+            contextSwitches++;
+        }
+        currentTime += config.contextSwitchTime;
+    }
+
+    /**
+     * @brief Give the CPU to a process taken from the queue
+     * @param idx Process index
+     */
+    void dispatch(int idx) {
+        const int pid = processes.getPid(idx);
+        const bool switched = lastPid != -1 && lastPid != pid;
+        processes.setState(idx, ProcessState::RUNNING);
+        processes.endWait(idx, serviceClock);
+        if (AccountingPolicy::responseAfterSwitch) {
+            chargeSwitch(switched);
+        }
+        if (!processes.getHasStarted(idx)) {
+            processes.setResponseTime(idx, currentTime - processes.getArrivalTime(idx));
+            processes.setHasStarted(idx, true);
+        }
+        if (!AccountingPolicy::responseAfterSwitch) {
+            chargeSwitch(switched);
+        }
+        aging.onDispatch(*this, idx);
+        lastPid = pid;
+    }
+
+    /**
+     * @brief Terminate a process whose last slice just ended
+     */
+    void complete(int idx) {
+        const int turnaround = currentTime - processes.getArrivalTime(idx);
+        processes.setState(idx, ProcessState::TERMINATED);
+        processes.setCompletionTime(idx, currentTime);
+        processes.setTurnaroundTime(idx, turnaround);
+        if (AccountingPolicy::waitFromTurnaround) {
+            processes.setWaitingTime(idx, turnaround - processes.getBurstTime(idx) -
+                                          processes.getIoTime(idx));
+        }
+        recordCompletion(idx);
+    }
+
+protected:
+    void onProcessInjected(int idx) override {
+        addPidSlot(idx);
+        queue.grow(idx);
+        aging.grow(*this, idx);
+    }
+
+public:
+    /**
+     * @brief Constructor
+     * @param name Display name
+     * @param type Type reported by getType()
+     * @param config Scheduler configuration (also builds the policies)
+     * @throws std::invalid_argument if a policy rejects the configuration
+     */
+    SchedulerEngine(std::string name, SchedulerType type,
+                    const SchedulerConfig& config = SchedulerConfig())
+        : Scheduler(config)
+        , name(std::move(name))
+        , type(type)
+        , queue(this->config, processes)
+        , aging(this->config)
+        , running(-1)
+        , lastPid(-1)
+        , completed(0)
+        , paused(false)
+    {}
+
+    void run() final {
+        start();
+        advance(INT_MAX);
+    }
+    int getNextProcess() override { return queue.front(); }
+    std::string getName() const override { return name; }
+    SchedulerType getType() const override { return type; }
+
+    bool supportsSnapshots() const override { return true; }
+    bool supportsIo() const override { return true; }
+    bool runUntil(int time) final {
+        start();
+        return advance(time);
+    }
+    SchedulerSnapshot snapshot() const final;
+    bool resume(const SchedulerSnapshot& snapshot, int until = INT_MAX) final;
+
+    void reset() override {
+        Scheduler::reset();
+        queue.clear();
+        paused = false;
+    }
+};
+
+template <class QueuePolicy, class PreemptionPolicy, class AgingPolicy, class AccountingPolicy>
+void SchedulerEngine<QueuePolicy, PreemptionPolicy, AgingPolicy, AccountingPolicy>::start() {
+    rewindArrivals();
+    currentTime = 0;
+    contextSwitches = 0;
+    serviceClock = 0;
+    startTimeline(queue.sliceHint(), AccountingPolicy::switchEvents ? 2 : 1);
+
+    processes.resetAll();
+    queue.begin(processes);
+    buildPidSlots();
+    buildArrivalIndex();
+    aging.begin(*this);
+
+    running = -1;
+    lastPid = -1;
+    completed = 0;
+    paused = false;
+}
+
+template <class QueuePolicy, class PreemptionPolicy, class AgingPolicy, class AccountingPolicy>
+bool SchedulerEngine<QueuePolicy, PreemptionPolicy, AgingPolicy, AccountingPolicy>::advance(
+    int until) {
+    // Injected arrivals grow the table as the run goes
+    while (completed < processes.size()) {
+        if (currentTime >= until) {
+            paused = true;
+            return false;
+        }
+
+        // Admit
+        {
+            SCHED_PROFILE_PHASE(RunPhase::DEADLINES);
+            aging.beforeAdmit(*this);
+        }
+        admitArrived();
+        {
+            SCHED_PROFILE_PHASE(RunPhase::DEADLINES);
+            aging.afterAdmit(*this);
+        }
+
+        // Select
+        if (running == -1) {
+            {
+                SCHED_PROFILE_PHASE(RunPhase::SELECTION);
+                running = queue.pop();
+            }
+            if (running == -1) {
+                if (AccountingPolicy::idleEvents) {
+                    const int next = nextEventTime();
+                    if (next == INT_MAX) {
+                        break;
+                    }
+                    recordEvent(-1, currentTime, next, EventKind::IDLE);
+                    currentTime = next;
+                } else {
+                    advanceIdleTime();
+                }
+                continue;
+            }
+            dispatch(running);
+        }
+
+        // Execute
+        const int current = running;
+        const int start = currentTime;
+        const int slice = std::min(PreemptionPolicy::slice(*this, current),
+                                   processes.cpuBeforeIo(current));
+        const int ran = processes.execute(current, slice);
+        currentTime += ran;
+        recordEvent(processes.getPid(current), start, currentTime);
+        serviceClock += ran;
+        if (AccountingPolicy::admitAtSliceEnd) {
+            admitArrived();
+        }
+
+        // Account
+        if (processes.getRemainingTime(current) == 0) {
+            complete(current);
+            completed++;
+            running = -1;
+        } else if (const int io = processes.takeIoBurst(current)) {
+            queue.yieldKind(current, ran);
+            timeline.back().kind = EventKind::BLOCK;
+            processes.setState(current, ProcessState::WAITING);
+            ioTimers.schedule(current, currentTime + io);
+            running = -1;
+        } else if (PreemptionPolicy::yields(*this, current)) {
+            timeline.back().kind = queue.yieldKind(current, ran);
+            if (AccountingPolicy::countPreemptions) {
+                contextSwitches++;
+            }
+            markReady(current);
+            running = -1;
+        }
+    }
+
+    paused = false;
+    calculateMetrics();
+    return true;
+}
+
+template <class QueuePolicy, class PreemptionPolicy, class AgingPolicy, class AccountingPolicy>
+SchedulerSnapshot
+SchedulerEngine<QueuePolicy, PreemptionPolicy, AgingPolicy, AccountingPolicy>::snapshot() const {
+    if (!paused) {
+        throw std::logic_error("No paused run to snapshot");
+    }
+    if (arrivalSource != nullptr) {
+        throw std::logic_error("Runs with an arrival source cannot be snapshotted");
+    }
+    SchedulerSnapshot saved;
+    saved.type = type;
+    saveRunState(saved);
+    saved.running = running;
+    saved.lastPid = lastPid;
+    queue.save(saved.queued, saved.queueState);
+    aging.save(*this, saved.agingState);
+    return saved;
+}
+
+template <class QueuePolicy, class PreemptionPolicy, class AgingPolicy, class AccountingPolicy>
+bool SchedulerEngine<QueuePolicy, PreemptionPolicy, AgingPolicy, AccountingPolicy>::resume(
+    const SchedulerSnapshot& saved, int until) {
+    if (saved.type != type) {
+        throw std::invalid_argument("Snapshot was taken from another scheduler type");
+    }
+    const int rows = static_cast<int>(saved.processes.size());
+    if (saved.running < -1 || saved.running >= rows) {
+        throw std::invalid_argument("Snapshot runs a process it does not hold");
+    }
+    for (int idx : saved.queued) {
+        if (idx < 0 || idx >= rows) {
+            throw std::invalid_argument("Snapshot queues a process it does not hold");
+        }
+    }
+
+    loadRunState(saved);
+    buildPidSlots();
+    queue.restore(processes, saved.queued, saved.queueState);
+    aging.restore(*this, saved.agingState);
+    running = saved.running;
+    lastPid = saved.lastPid;
+    completed = processes.size() - processes.countUnfinished();
+    return advance(until);
+}
+
+/// The classic algorithms, composed from policies
+using RoundRobinEngine =
+    SchedulerEngine<FifoQueue, QuantumExpiry, NoAging, TurnaroundAccounting>;
+using PriorityEngine =
+    SchedulerEngine<PriorityHeapQueue, RunToCompletion, PriorityAging, PreemptionAccounting>;
+using PreemptivePriorityEngine =
+    SchedulerEngine<PriorityHeapQueue, OutrankPreemption, PriorityAging, PreemptionAccounting>;
+using MultilevelQueueEngine = SchedulerEngine<StaticLevelQueues, QuantumExpiry, NoAging>;
+using FeedbackQueueEngine = SchedulerEngine<FeedbackLevelQueues, QuantumExpiry, PeriodicBoost>;
+
+/// Algorithms that exist only as compositions
+using FairEngine = SchedulerEngine<FairQueue, QuantumExpiry, NoAging, TurnaroundAccounting>;
+using ShortestJobEngine =
+    SchedulerEngine<ShortestJobQueue, RunToCompletion, NoAging, TurnaroundAccounting>;
+using ShortestRemainingEngine =
+    SchedulerEngine<ShortestJobQueue, OutrankPreemption, NoAging, TurnaroundAccounting>;
+
+// Instantiated once, in SchedulerEngine.cpp
+extern template class SchedulerEngine<FifoQueue, QuantumExpiry, NoAging, TurnaroundAccounting>;
+extern template class SchedulerEngine<PriorityHeapQueue, RunToCompletion, PriorityAging,
+                                      PreemptionAccounting>;
+extern template class SchedulerEngine<PriorityHeapQueue, OutrankPreemption, PriorityAging,
+                                      PreemptionAccounting>;
+extern template class SchedulerEngine<StaticLevelQueues, QuantumExpiry, NoAging>;
+extern template class SchedulerEngine<FeedbackLevelQueues, QuantumExpiry, PeriodicBoost>;
+extern template class SchedulerEngine<FairQueue, QuantumExpiry, NoAging, TurnaroundAccounting>;
+extern template class SchedulerEngine<ShortestJobQueue, RunToCompletion, NoAging,
+                                      TurnaroundAccounting>;
+extern template class SchedulerEngine<ShortestJobQueue, OutrankPreemption, NoAging,
+                                      TurnaroundAccounting>;
+
+/**
+ * @brief Create the engine instantiation of a scheduler type
+ *
+ * The five classic types give results identical to their classes on one
+ * CPU; FAIR, SHORTEST_JOB_FIRST and SHORTEST_REMAINING_TIME exist only here.
+ * @param type Scheduler type
+ * @param config Scheduler configuration
+ * @return New scheduler
+ * @throws std::invalid_argument if the configuration is out of range
+ */
+std::unique_ptr<Scheduler> createEngineScheduler(SchedulerType type,
+                                                 const SchedulerConfig& config);
+
+#endif // SCHEDULER_ENGINE_H
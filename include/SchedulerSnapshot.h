@@ -0,0 +1,85 @@
+/**
+ * @file SchedulerSnapshot.h
+ * @brief Saved runtime state of a paused scheduler run
+ * @version 1.0
+ */
+
+#ifndef SCHEDULER_SNAPSHOT_H
+#define SCHEDULER_SNAPSHOT_H
+
+#include "Scheduler.h"
+#include "ProcessTable.h"
+#include "EventQueue.h"
+#include <vector>
+#include <string>
+#include <iosfwd>
+#include <cstdint>
+
+/**
+ * @struct SchedulerSnapshot
+ * @brief Everything a paused run needs to go on, in another scheduler if need be
+ *
+ * Taken by Scheduler::snapshot() and passed to Scheduler::resume(). The
+ * table carries every runtime column (remaining, waiting and response
+ * times, states, queue levels, aged priorities, I/O bursts); the queue and aging
+ * policies add their own state as plain integers, so a snapshot does not
+ * depend on the configuration it was taken under.
+ *
+ * The binary form uses host byte order, like binary workloads; read()
+ * rejects files written with the other byte order.
+ */
+struct SchedulerSnapshot {
+    SchedulerType type = SchedulerType::ROUND_ROBIN; ///< Type of the paused scheduler
+    ProcessTable processes;                  ///< Every row with its runtime columns
+    size_t arrivalCursor = 0;                ///< Arrival index entries already admitted
+    std::vector<SimEvent> deadlines;         ///< Pending aging and boost deadlines
+    std::vector<SimEvent> wakeups;           ///< Pending I/O completions, in firing order (may be due by currentTime)
+    long long nextSequence = 0;              ///< Sequence number of the next deadline
+    std::vector<ExecutionEvent> timeline;    ///< Timeline so far (newest event only without keepTimeline)
+    int currentTime = 0;                     ///< Simulation time of the pause
+    int contextSwitches = 0;                 ///< Switches counted so far
+    int serviceClock = 0;                    ///< CPU time executed so far
+    int idleTime = 0;                        ///< Idle gaps so far
+    int lastExecutionEnd = 0;                ///< End of the latest execution event
+    int running = -1;                        ///< Process index on the CPU, -1 if none
+    int lastPid = -1;                        ///< Pid the CPU ran last, -1 if none
+    std::vector<int> queued;                 ///< READY processes in the queue's order
+    std::vector<std::int64_t> queueState;    ///< Queue policy state (e.g. vruntimes)
+    std::vector<std::int64_t> agingState;    ///< Aging policy state (e.g. aging clocks)
+
+    /**
+     * @brief Write the snapshot in binary form
+     * @param out Binary output stream
+     * @return true if every byte was written
+     */
+    bool write(std::ostream& out) const;
+
+    /**
+     * @brief Read a snapshot written by write()
+     * @param in Binary input stream
+     * @param snapshot Snapshot to fill (replaced)
+     * @param error Optional output describing why reading failed
+     * @return true if a complete snapshot was read
+     */
+    static bool read(std::istream& in, SchedulerSnapshot& snapshot, std::string* error = nullptr);
+
+    /**
+     * @brief Write the snapshot to a file
+     * @param filename Output file path
+     * @param error Optional output describing why writing failed
+     * @return true on success
+     */
+    bool save(const std::string& filename, std::string* error = nullptr) const;
+
+    /**
+     * @brief Read a snapshot from a file
+     * @param filename Snapshot file path
+     * @param snapshot Snapshot to fill (replaced)
+     * @param error Optional output describing why reading failed
+     * @return true on success
+     */
+    static bool load(const std::string& filename, SchedulerSnapshot& snapshot,
+                     std::string* error = nullptr);
+};
+
+#endif // SCHEDULER_SNAPSHOT_H
@@ -0,0 +1,885 @@
+/**
+ * @file SchedulingPolicies.h
+ * @brief Queue, preemption, aging and accounting policies for SchedulerEngine
+ * @version 1.0
+ */
+
+#ifndef SCHEDULING_POLICIES_H
+#define SCHEDULING_POLICIES_H
+
+#include "Scheduler.h"
+#include "ProcessTable.h"
+#include "EventQueue.h"
+#include "IndexedHeap.h"
+#include "LevelMask.h"
+#include "RingQueue.h"
+#include <vector>
+#include <algorithm>
+#include <climits>
+#include <stdexcept>
+#include <cstdint>
+
+// ============================================================================
+// Queue policies: hold the READY processes and pick the next one
+// ============================================================================
+
+/**
+ * @class FifoQueue
+ * @brief One FIFO queue with a fixed quantum (Round Robin)
+ *
+ * The table is sorted by arrival at the start of a run, as
+ * RoundRobinScheduler does, so ties between arrivals come out the same.
+ */
+class FifoQueue {
+private:
+    RingQueue queue;    ///< READY processes, front first
+    int timeQuantum;    ///< Slice of every dispatch
+
+public:
+    FifoQueue(const SchedulerConfig& config, ProcessTable& processes)
+        : timeQuantum(config.timeQuantum)
+    {
+        (void)processes;
+    }
+
+    void begin(ProcessTable& processes) {
+        processes.sortByArrival();
+        queue.clear();
+        queue.reserve(processes.size());
+    }
+    void grow(int idx) { (void)idx; }
+    void clear() { queue.clear(); }
+
+    void admit(int idx) { queue.push(idx); }
+    void push(int idx) { queue.push(idx); }
+    void wake(int idx) { queue.push(idx); }
+    int pop() { return queue.empty() ? -1 : queue.pop(); }
+    int front() const { return queue.empty() ? -1 : queue.front(); }
+
+    void save(std::vector<int>& queued, std::vector<std::int64_t>& state) const {
+        (void)state;
+        for (size_t i = 0; i < queue.size(); ++i) {
+            queued.push_back(queue.at(i));
+        }
+    }
+    void restore(ProcessTable& table, const std::vector<int>& queued,
+                 const std::vector<std::int64_t>& state) {
+        (void)state;
+        queue.clear();
+        queue.reserve(table.size());
+        for (int idx : queued) {
+            queue.push(idx);
+        }
+    }
+
+    int quantum(int idx) const { (void)idx; return timeQuantum; }
+    int sliceHint() const { return timeQuantum; }
+    bool outranks(int a, int b) const { (void)a; (void)b; return false; }
+    EventKind yieldKind(int idx, int ran) { (void)idx; (void)ran; return EventKind::PREEMPT; }
+};
+
+/**
+ * @struct PriorityOrder
+ * @brief Heap ordering: priority, then arrival time, then table order
+ */
+struct PriorityOrder {
+    const ProcessTable* processes;
+
+    bool operator()(int a, int b) const {
+        if (processes->getPriority(a) != processes->getPriority(b)) {
+            return processes->getPriority(a) < processes->getPriority(b);
+        }
+        if (processes->getArrivalTime(a) != processes->getArrivalTime(b)) {
+            return processes->getArrivalTime(a) < processes->getArrivalTime(b);
+        }
+        return a < b;
+    }
+
+    /// a preempts b if its priority is strictly higher
+    bool outranks(int a, int b) const {
+        return processes->getPriority(a) < processes->getPriority(b);
+    }
+};
+
+/**
+ * @struct RemainingOrder
+ * @brief Heap ordering: remaining time, then arrival time, then table order
+ */
+struct RemainingOrder {
+    const ProcessTable* processes;
+
+    bool operator()(int a, int b) const {
+        if (processes->getRemainingTime(a) != processes->getRemainingTime(b)) {
+            return processes->getRemainingTime(a) < processes->getRemainingTime(b);
+        }
+        if (processes->getArrivalTime(a) != processes->getArrivalTime(b)) {
+            return processes->getArrivalTime(a) < processes->getArrivalTime(b);
+        }
+        return a < b;
+    }
+
+    /// a preempts b if it has strictly less work left
+    bool outranks(int a, int b) const {
+        return processes->getRemainingTime(a) < processes->getRemainingTime(b);
+    }
+};
+
+/**
+ * @class HeapQueue
+ * @brief READY processes in an indexed heap under an ordering
+ *
+ * Keys are read from the table, so a queued process whose key changes
+ * (an aged priority) must be passed to update(). Slices are unbounded;
+ * a preemption policy decides when the running process gives way.
+ * @tparam Order Comparator over process indices with an outranks() test
+ */
+template <class Order>
+class HeapQueue {
+private:
+    Order order;                ///< Ordering over the engine's table
+    IndexedHeap<Order> heap;    ///< READY processes
+
+public:
+    HeapQueue(const SchedulerConfig& config, ProcessTable& processes)
+        : order{&processes}
+        , heap(order)
+    {
+        (void)config;
+    }
+
+    void begin(ProcessTable& processes) { heap.reset(processes.size()); }
+    void grow(int idx) { heap.grow(static_cast<size_t>(idx) + 1); }
+    void clear() { heap.reset(0); }
+
+    void admit(int idx) { heap.push(idx); }
+    void push(int idx) { heap.push(idx); }
+    void wake(int idx) { heap.push(idx); }
+    int pop() { return heap.empty() ? -1 : heap.pop(); }
+    int front() const { return heap.empty() ? -1 : heap.top(); }
+
+    /**
+     * @brief Restore the heap after a queued process's key changed
+     */
+    void update(int idx) { heap.update(idx); }
+
+    /// The ordering is total, so pushing in any order restores the pop order
+    void save(std::vector<int>& queued, std::vector<std::int64_t>& state) const {
+        (void)state;
+        queued = heap.items();
+    }
+    void restore(ProcessTable& table, const std::vector<int>& queued,
+                 const std::vector<std::int64_t>& state) {
+        (void)state;
+        heap.reset(table.size());
+        for (int idx : queued) {
+            heap.push(idx);
+        }
+    }
+
+    int quantum(int idx) const { (void)idx; return INT_MAX; }
+    int sliceHint() const { return INT_MAX; }
+    bool outranks(int a, int b) const { return order.outranks(a, b); }
+    EventKind yieldKind(int idx, int ran) { (void)idx; (void)ran; return EventKind::PREEMPT; }
+};
+
+using PriorityHeapQueue = HeapQueue<PriorityOrder>;    ///< Highest priority first
+using ShortestJobQueue = HeapQueue<RemainingOrder>;    ///< Least remaining time first
+
+/**
+ * @class FairQueue
+ * @brief READY processes by virtual runtime, weighted by priority (CFS)
+ *
+ * A process's vruntime grows by its CPU time scaled by NICE_0_WEIGHT over
+ * its weight, so heavier processes age slower and get a larger share.
+ * Priorities map to weights through the Linux nice table (priority p is
+ * nice p, clamped to [-20, 19]). The minimum vruntime sits at the top of
+ * an indexed heap, so selection and reinsertion are O(log n). A dispatch
+ * gets its weight's share of max(targetLatency, runnable x minGranularity),
+ * and at least minGranularity. Arrivals start at the queue's minimum
+ * vruntime, so they neither starve nor monopolise the CPU.
+ */
+class FairQueue {
+private:
+    static constexpr std::int64_t NICE_0_WEIGHT = 1024;     ///< Weight of priority 0
+    static constexpr int VRUNTIME_SHIFT = 10;               ///< Fraction bits of vruntime
+
+    /**
+     * @struct VruntimeOrder
+     * @brief Heap ordering: vruntime, then table order
+     */
+    struct VruntimeOrder {
+        const std::vector<std::int64_t>* vruntime;
+        bool operator()(int a, int b) const {
+            if ((*vruntime)[a] != (*vruntime)[b]) {
+                return (*vruntime)[a] < (*vruntime)[b];
+            }
+            return a < b;
+        }
+    };
+
+    const ProcessTable* processes;      ///< Engine's table (weights come from priorities)
+    int targetLatency;                  ///< Period in which every runnable process runs
+    int minGranularity;                 ///< Shortest slice
+    std::vector<std::int64_t> vruntime; ///< Virtual runtime of each process
+    IndexedHeap<VruntimeOrder> heap;    ///< READY processes by vruntime
+    std::int64_t totalWeight;           ///< Weight of the queued processes
+    std::int64_t minVruntime;           ///< Never decreases; arrivals start here
+
+    std::int64_t weight(int idx) const {
+        static const int weights[40] = {
+            88761, 71755, 56483, 46273, 36291, 29154, 23254, 18705, 14949, 11916,
+            9548, 7620, 6100, 4904, 3906, 3121, 2501, 1991, 1586, 1277,
+            1024, 820, 655, 526, 423, 335, 272, 215, 172, 137,
+            110, 87, 70, 56, 45, 36, 29, 23, 18, 15
+        };
+        return weights[std::min(std::max(processes->getPriority(idx), -20), 19) + 20];
+    }
+
+public:
+    FairQueue(const SchedulerConfig& config, ProcessTable& processes)
+        : processes(&processes)
+        , targetLatency(config.targetLatency)
+        , minGranularity(config.minGranularity)
+        , heap(VruntimeOrder{&vruntime})
+        , totalWeight(0)
+        , minVruntime(0)
+    {
+        if (targetLatency < 1 || minGranularity < 1) {
+            throw std::invalid_argument("Fair scheduling latency and granularity must be positive");
+        }
+    }
+
+    void begin(ProcessTable& table) {
+        vruntime.assign(table.size(), 0);
+        heap.reset(table.size());
+        totalWeight = 0;
+        minVruntime = 0;
+    }
+    void grow(int idx) {
+        vruntime.resize(static_cast<size_t>(idx) + 1, 0);
+        heap.grow(static_cast<size_t>(idx) + 1);
+    }
+    void clear() {
+        heap.reset(0);
+        totalWeight = 0;
+    }
+
+    void admit(int idx) {
+        vruntime[idx] = std::max(vruntime[idx], minVruntime);
+        push(idx);
+    }
+    void push(int idx) {
+        heap.push(idx);
+        totalWeight += weight(idx);
+    }
+    /// A process back from I/O is placed like an arrival, so sleeping earns no credit
+    void wake(int idx) { admit(idx); }
+    int pop() {
+        if (heap.empty()) {
+            return -1;
+        }
+        const int idx = heap.pop();
+        totalWeight -= weight(idx);
+        minVruntime = std::max(minVruntime, vruntime[idx]);
+        return idx;
+    }
+    int front() const { return heap.empty() ? -1 : heap.top(); }
+
+    /**
+     * @brief Virtual runtime of a process, in 1/1024 time units at priority 0
+     */
+    std::int64_t getVruntime(int idx) const { return vruntime[idx]; }
+
+    /// State is every vruntime, then minVruntime
+    void save(std::vector<int>& queued, std::vector<std::int64_t>& state) const {
+        queued = heap.items();
+        state = vruntime;
+        state.push_back(minVruntime);
+    }
+    void restore(ProcessTable& table, const std::vector<int>& queued,
+                 const std::vector<std::int64_t>& state) {
+        if (state.size() != table.size() + 1) {
+            throw std::invalid_argument("Snapshot holds no fair queue state for its processes");
+        }
+        vruntime.assign(state.begin(), state.end() - 1);
+        minVruntime = state.back();
+        heap.reset(table.size());
+        totalWeight = 0;
+        for (int idx : queued) {
+            push(idx);
+        }
+    }
+
+    /// Weighted share of the period for a process just taken from the queue
+    int quantum(int idx) const {
+        const std::int64_t runnable = static_cast<std::int64_t>(heap.size()) + 1;
+        const std::int64_t period = std::max<std::int64_t>(targetLatency,
+                                                           runnable * minGranularity);
+        const std::int64_t slice = period * weight(idx) / (totalWeight + weight(idx));
+        return static_cast<int>(std::min<std::int64_t>(std::max<std::int64_t>(slice,
+                                                                               minGranularity),
+                                                       INT_MAX));
+    }
+    int sliceHint() const { return minGranularity; }
+    bool outranks(int a, int b) const { return vruntime[a] < vruntime[b]; }
+    EventKind yieldKind(int idx, int ran) {
+        vruntime[idx] += (static_cast<std::int64_t>(ran) * NICE_0_WEIGHT << VRUNTIME_SHIFT) /
+                         weight(idx);
+        return EventKind::PREEMPT;
+    }
+};
+
+/**
+ * @class StaticLevelQueues
+ * @brief Fixed FIFO levels chosen by priority (Multilevel Queue)
+ *
+ * Levels and quanta follow MultilevelQueueScheduler: priorities 0-2 go to
+ * the system level (half the quantum), 3-5 to the interactive level, the
+ * rest to the first batch level (twice the quantum). A process stays on
+ * its level for the whole run; the top non-empty level always runs.
+ */
+class StaticLevelQueues {
+private:
+    ProcessTable* processes;        ///< Engine's table (levels live in it)
+    int numQueues;                  ///< Number of levels
+    std::vector<int> quanta;        ///< Quantum of each level
+    std::vector<RingQueue> queues;  ///< READY processes of each level
+    LevelMask nonEmpty;             ///< Levels with queued processes
+
+    int assignLevel(int priority) const {
+        if (priority <= 2) {
+            return 0;
+        } else if (priority <= 5 && numQueues > 1) {
+            return 1;
+        } else {
+            return std::min(numQueues - 1, 2);
+        }
+    }
+
+public:
+    StaticLevelQueues(const SchedulerConfig& config, ProcessTable& processes)
+        : processes(&processes)
+        , numQueues(config.numQueues)
+    {
+        if (numQueues < 1) {
+            throw std::invalid_argument("Multilevel queues need at least one level");
+        }
+        quanta.assign(numQueues, config.timeQuantum * 2);
+        quanta[0] = std::max(1, config.timeQuantum / 2);
+        if (numQueues > 1) {
+            quanta[1] = config.timeQuantum;
+        }
+        queues.resize(numQueues);
+        nonEmpty.reset(numQueues);
+    }
+
+    void begin(ProcessTable& table) {
+        for (size_t i = 0; i < table.size(); ++i) {
+            table.setQueueLevel(i, assignLevel(table.getPriority(i)));
+        }
+        clear();
+    }
+    void grow(int idx) { processes->setQueueLevel(idx, assignLevel(processes->getPriority(idx))); }
+    void clear() {
+        for (RingQueue& queue : queues) {
+            queue.clear();
+        }
+        nonEmpty.reset(numQueues);
+    }
+
+    void admit(int idx) { push(idx); }
+    void wake(int idx) { push(idx); }
+    void push(int idx) {
+        const int level = processes->getQueueLevel(idx);
+        queues[level].push(idx);
+        nonEmpty.set(level);
+    }
+    int pop() {
+        const int level = nonEmpty.first();
+        if (level == -1) {
+            return -1;
+        }
+        const int idx = queues[level].pop();
+        if (queues[level].empty()) {
+            nonEmpty.clear(level);
+        }
+        return idx;
+    }
+    int front() const {
+        const int level = nonEmpty.first();
+        return level == -1 ? -1 : queues[level].front();
+    }
+
+    void save(std::vector<int>& queued, std::vector<std::int64_t>& state) const {
+        (void)state;
+        for (const RingQueue& queue : queues) {
+            for (size_t i = 0; i < queue.size(); ++i) {
+                queued.push_back(queue.at(i));
+            }
+        }
+    }
+    /// Levels follow this configuration; each level keeps the saved order
+    void restore(ProcessTable& table, const std::vector<int>& queued,
+                 const std::vector<std::int64_t>& state) {
+        (void)state;
+        begin(table);
+        for (int idx : queued) {
+            push(idx);
+        }
+    }
+
+    int quantum(int idx) const { return quanta[processes->getQueueLevel(idx)]; }
+    int sliceHint() const { return quanta[std::min(numQueues - 1, 1)]; }
+    bool outranks(int a, int b) const { (void)a; (void)b; return false; }
+    EventKind yieldKind(int idx, int ran) { (void)idx; (void)ran; return EventKind::EXECUTE; }
+};
+
+/**
+ * @class FeedbackLevelQueues
+ * @brief FIFO levels with demotion on a full quantum (MLFQ)
+ *
+ * Arrivals start on level 0; a slice that uses its whole quantum moves the
+ * process one level down. Quanta double per level (saturating) unless
+ * config.quantums overrides them. boost() moves every READY process back
+ * to level 0 in table order, as MultilevelFeedbackQueueScheduler does.
+ */
+class FeedbackLevelQueues {
+private:
+    ProcessTable* processes;        ///< Engine's table (levels live in it)
+    int numQueues;                  ///< Number of levels
+    std::vector<int> quanta;        ///< Quantum of each level
+    std::vector<RingQueue> queues;  ///< READY processes of each level
+    LevelMask nonEmpty;             ///< Levels with queued processes
+    std::vector<int> boosted;       ///< Scratch list of processes a boost moves
+
+public:
+    FeedbackLevelQueues(const SchedulerConfig& config, ProcessTable& processes)
+        : processes(&processes)
+        , numQueues(config.numQueues)
+    {
+        if (numQueues < 1) {
+            throw std::invalid_argument("Multilevel queues need at least one level");
+        }
+        quanta.resize(numQueues);
+        quanta[0] = config.timeQuantum;
+        for (int i = 1; i < numQueues; ++i) {
+            quanta[i] = quanta[i - 1] > INT_MAX / 2 ? INT_MAX : quanta[i - 1] * 2;
+        }
+        for (size_t i = 0; i < config.quantums.size() && i < quanta.size(); ++i) {
+            quanta[i] = config.quantums[i];
+        }
+        queues.resize(numQueues);
+        nonEmpty.reset(numQueues);
+    }
+
+    void begin(ProcessTable& table) { (void)table; clear(); }
+    void grow(int idx) { (void)idx; }
+    void clear() {
+        for (RingQueue& queue : queues) {
+            queue.clear();
+        }
+        nonEmpty.reset(numQueues);
+    }
+
+    void admit(int idx) {
+        processes->setQueueLevel(idx, 0);
+        push(idx);
+    }
+    /// A process back from I/O keeps its level
+    void wake(int idx) { push(idx); }
+    void push(int idx) {
+        const int level = processes->getQueueLevel(idx);
+        queues[level].push(idx);
+        nonEmpty.set(level);
+    }
+    int pop() {
+        const int level = nonEmpty.first();
+        if (level == -1) {
+            return -1;
+        }
+        const int idx = queues[level].pop();
+        if (queues[level].empty()) {
+            nonEmpty.clear(level);
+        }
+        return idx;
+    }
+    int front() const {
+        const int level = nonEmpty.first();
+        return level == -1 ? -1 : queues[level].front();
+    }
+
+    /**
+     * @brief Move every queued READY process to level 0, in table order
+     */
+    void boost() {
+        boosted.clear();
+        for (int level = nonEmpty.first(); level != -1; level = nonEmpty.first()) {
+            RingQueue& queue = queues[level];
+            while (!queue.empty()) {
+                const int idx = queue.pop();
+                if (processes->getState(idx) == ProcessState::READY) {
+                    boosted.push_back(idx);
+                }
+            }
+            nonEmpty.clear(level);
+        }
+        std::sort(boosted.begin(), boosted.end());
+        for (int idx : boosted) {
+            processes->setQueueLevel(idx, 0);
+            push(idx);
+        }
+    }
+
+    void save(std::vector<int>& queued, std::vector<std::int64_t>& state) const {
+        (void)state;
+        for (const RingQueue& queue : queues) {
+            for (size_t i = 0; i < queue.size(); ++i) {
+                queued.push_back(queue.at(i));
+            }
+        }
+    }
+    /// Levels below this configuration's lowest move up to it
+    void restore(ProcessTable& table, const std::vector<int>& queued,
+                 const std::vector<std::int64_t>& state) {
+        (void)state;
+        for (size_t i = 0; i < table.size(); ++i) {
+            table.setQueueLevel(i, std::min(table.getQueueLevel(i), numQueues - 1));
+        }
+        clear();
+        for (int idx : queued) {
+            push(idx);
+        }
+    }
+
+    int quantum(int idx) const { return quanta[processes->getQueueLevel(idx)]; }
+    int sliceHint() const { return quanta[numQueues - 1]; }
+    bool outranks(int a, int b) const { (void)a; (void)b; return false; }
+    EventKind yieldKind(int idx, int ran) {
+        if (ran < quantum(idx)) {
+            return EventKind::EXECUTE;
+        }
+        const int level = processes->getQueueLevel(idx);
+        if (level < numQueues - 1) {
+            processes->setQueueLevel(idx, level + 1);
+        }
+        return EventKind::DEMOTE;
+    }
+};
+
+// ============================================================================
+// Preemption policies: how long a slice runs and whether the process yields
+// ============================================================================
+
+/**
+ * @struct RunToCompletion
+ * @brief A dispatched process keeps the CPU until it finishes
+ */
+struct RunToCompletion {
+    template <class Engine>
+    static int slice(const Engine& engine, int idx) {
+        return engine.processes.getRemainingTime(idx);
+    }
+
+    template <class Engine>
+    static bool yields(const Engine& engine, int idx) {
+        (void)engine;
+        (void)idx;
+        return false;
+    }
+};
+
+/**
+ * @struct QuantumExpiry
+ * @brief A slice lasts one quantum of the process's queue, then it yields
+ */
+struct QuantumExpiry {
+    template <class Engine>
+    static int slice(const Engine& engine, int idx) {
+        return std::min(engine.queue.quantum(idx), engine.processes.getRemainingTime(idx));
+    }
+
+    template <class Engine>
+    static bool yields(const Engine& engine, int idx) {
+        (void)engine;
+        (void)idx;
+        return true;
+    }
+};
+
+/**
+ * @struct OutrankPreemption
+ * @brief The running process yields as soon as a queued one outranks it
+ *
+ * Slices run until the next arrival or deadline (one tick in tick mode),
+ * or a single tick if an outranking process is already waiting.
+ */
+struct OutrankPreemption {
+    template <class Engine>
+    static int slice(const Engine& engine, int idx) {
+        const int remaining = engine.processes.getRemainingTime(idx);
+        return engine.outranked(idx) ? 1 : engine.eventSlice(engine.currentTime, remaining);
+    }
+
+    template <class Engine>
+    static bool yields(const Engine& engine, int idx) {
+        return engine.outranked(idx);
+    }
+};
+
+// ============================================================================
+// Aging policies: deadlines that change the order of waiting processes
+// ============================================================================
+
+/**
+ * @struct NoAging
+ * @brief Queue order depends only on the queue policy
+ */
+struct NoAging {
+    explicit NoAging(const SchedulerConfig& config) { (void)config; }
+
+    template <class Engine> void begin(Engine& engine) { (void)engine; }
+    template <class Engine> void grow(Engine& engine, int idx) { (void)engine; (void)idx; }
+    template <class Engine> void beforeAdmit(Engine& engine) { (void)engine; }
+    template <class Engine> void afterAdmit(Engine& engine) { (void)engine; }
+    template <class Engine> void onReady(Engine& engine, int idx) { (void)engine; (void)idx; }
+    template <class Engine> void onDispatch(Engine& engine, int idx) { (void)engine; (void)idx; }
+
+    template <class Engine>
+    void save(const Engine& engine, std::vector<std::int64_t>& state) const {
+        (void)engine;
+        (void)state;
+    }
+    template <class Engine>
+    void restore(Engine& engine, const std::vector<std::int64_t>& state) {
+        (void)engine;
+        (void)state;
+    }
+};
+
+/**
+ * @class PriorityAging
+ * @brief Raise a waiting process's priority every agingThreshold time units
+ *
+ * Each wait pushes a deadline; deadlines left over from an earlier wait
+ * are skipped when they come due. Needs a queue with update(). The aging
+ * clock is kept per pid slot, as in PriorityScheduler.
+ */
+class PriorityAging {
+private:
+    static constexpr int NOT_WAITING = -1;  ///< waitingSince entry of a pid not waiting
+
+    bool enabled;                   ///< config.agingEnabled
+    int threshold;                  ///< Time units before each boost
+    std::vector<int> waitingSince;  ///< Aging clock start per pid slot
+    std::vector<SimEvent> due;      ///< Scratch list of due deadlines
+
+public:
+    explicit PriorityAging(const SchedulerConfig& config)
+        : enabled(config.agingEnabled)
+        , threshold(config.agingThreshold)
+    {}
+
+    template <class Engine>
+    void begin(Engine& engine) {
+        waitingSince.assign(engine.pidSlotCount, NOT_WAITING);
+    }
+
+    template <class Engine>
+    void grow(Engine& engine, int idx) {
+        (void)idx;
+        waitingSince.resize(engine.pidSlotCount, NOT_WAITING);
+    }
+
+    template <class Engine>
+    void beforeAdmit(Engine& engine) { (void)engine; }
+
+    template <class Engine>
+    void afterAdmit(Engine& engine) {
+        // Collect due deadlines first so each process ages at most once per decision
+        due.clear();
+        while (!engine.events.empty() && engine.events.top().time <= engine.currentTime) {
+            due.push_back(engine.events.top());
+            engine.events.pop();
+        }
+        for (const SimEvent& event : due) {
+            const int idx = event.processIdx;
+            int& since = waitingSince[engine.pidSlot(idx)];
+            if (engine.processes.getState(idx) != ProcessState::READY || since == NOT_WAITING ||
+                since + threshold != event.time) {
+                continue;
+            }
+            const int priority = engine.processes.getPriority(idx);
+            if (priority > 0) {
+                engine.processes.setPriority(idx, priority - 1);
+                engine.queue.update(idx);
+                since = engine.currentTime;
+                engine.events.push(engine.currentTime + threshold, SimEventType::AGING, idx);
+            }
+        }
+    }
+
+    template <class Engine>
+    void onReady(Engine& engine, int idx) {
+        if (enabled) {
+            waitingSince[engine.pidSlot(idx)] = engine.currentTime;
+            engine.events.push(engine.currentTime + threshold, SimEventType::AGING, idx);
+        }
+    }
+
+    template <class Engine>
+    void onDispatch(Engine& engine, int idx) {
+        waitingSince[engine.pidSlot(idx)] = NOT_WAITING;
+    }
+
+    /// State is enabled, threshold, then the aging clock of each pid slot
+    template <class Engine>
+    void save(const Engine& engine, std::vector<std::int64_t>& state) const {
+        (void)engine;
+        state.push_back(enabled);
+        state.push_back(threshold);
+        state.insert(state.end(), waitingSince.begin(), waitingSince.end());
+    }
+
+    /**
+     * @brief Take over the aging clocks of a snapshot
+     *
+     * Pending deadlines only match the threshold they were pushed with, so
+     * under another threshold each waiting process gets a new one. With
+     * aging now disabled, the clocks stop.
+     */
+    template <class Engine>
+    void restore(Engine& engine, const std::vector<std::int64_t>& state) {
+        if (state.size() != engine.pidSlotCount + 2) {
+            throw std::invalid_argument("Snapshot holds no aging state for its processes");
+        }
+        waitingSince.assign(state.begin() + 2, state.end());
+        if (!enabled) {
+            waitingSince.assign(engine.pidSlotCount, NOT_WAITING);
+        } else if (state[0] == 0 || state[1] != threshold) {
+            for (size_t i = 0; i < engine.processes.size(); ++i) {
+                const int since = waitingSince[engine.pidSlot(i)];
+                if (engine.processes.getState(i) == ProcessState::READY && since != NOT_WAITING) {
+                    engine.events.push(since + threshold, SimEventType::AGING, static_cast<int>(i));
+                }
+            }
+        }
+    }
+};
+
+/**
+ * @class PeriodicBoost
+ * @brief Boost every queued process to the top level every 5 x agingThreshold
+ *
+ * Needs a queue with boost(). The next boost is kept as a deadline so the
+ * idle clock stops at it.
+ */
+class PeriodicBoost {
+private:
+    bool enabled;       ///< config.agingEnabled
+    int interval;       ///< Time between boosts
+    int lastBoost;      ///< Time of the latest boost
+
+public:
+    explicit PeriodicBoost(const SchedulerConfig& config)
+        : enabled(config.agingEnabled)
+        , interval(config.agingThreshold * 5)
+        , lastBoost(0)
+    {}
+
+    template <class Engine>
+    void begin(Engine& engine) {
+        lastBoost = 0;
+        if (enabled) {
+            engine.events.push(lastBoost + interval, SimEventType::PRIORITY_BOOST);
+        }
+    }
+
+    template <class Engine> void grow(Engine& engine, int idx) { (void)engine; (void)idx; }
+
+    template <class Engine>
+    void beforeAdmit(Engine& engine) {
+        if (enabled && engine.currentTime - lastBoost >= interval) {
+            engine.queue.boost();
+            lastBoost = engine.currentTime;
+            engine.events.push(lastBoost + interval, SimEventType::PRIORITY_BOOST);
+        }
+    }
+
+    template <class Engine>
+    void afterAdmit(Engine& engine) { engine.events.discardUntil(engine.currentTime); }
+
+    template <class Engine> void onReady(Engine& engine, int idx) { (void)engine; (void)idx; }
+    template <class Engine> void onDispatch(Engine& engine, int idx) { (void)engine; (void)idx; }
+
+    /// State is enabled, interval and the time of the latest boost
+    template <class Engine>
+    void save(const Engine& engine, std::vector<std::int64_t>& state) const {
+        (void)engine;
+        state.push_back(enabled);
+        state.push_back(interval);
+        state.push_back(lastBoost);
+    }
+
+    /// A new interval needs its own deadline; the old one passes unused
+    template <class Engine>
+    void restore(Engine& engine, const std::vector<std::int64_t>& state) {
+        if (state.size() != 3) {
+            throw std::invalid_argument("Snapshot holds no boost state");
+        }
+        lastBoost = static_cast<int>(state[2]);
+        if (enabled && (state[0] == 0 || state[1] != interval)) {
+            engine.events.push(lastBoost + interval, SimEventType::PRIORITY_BOOST);
+        }
+    }
+};
+
+// ============================================================================
+// Accounting policies: how switches, waiting and idle time are charged
+// ============================================================================
+
+/**
+ * @struct ServiceAccounting
+ * @brief Count each dispatch of another pid as a switch; wait by service clock
+ *
+ * As in the multilevel schedulers: switch time is added to the clock but
+ * not recorded on the timeline, and response time excludes it.
+ */
+struct ServiceAccounting {
+    static constexpr bool switchEvents = false;         ///< Record switches on the timeline
+    static constexpr bool countSwitches = true;         ///< Count dispatch switches
+    static constexpr bool countPreemptions = false;     ///< Count each preemption as a switch
+    static constexpr bool responseAfterSwitch = false;  ///< Response time includes the switch
+    static constexpr bool waitFromTurnaround = false;   ///< Waiting is turnaround minus burst
+    static constexpr bool idleEvents = false;           ///< Record idle gaps on the timeline
+    static constexpr bool admitAtSliceEnd = false;      ///< Admit arrivals before the yield test
+};
+
+/**
+ * @struct PreemptionAccounting
+ * @brief Charge switch time on dispatch but count only preemptions
+ *
+ * As in PriorityScheduler.
+ */
+struct PreemptionAccounting : ServiceAccounting {
+    static constexpr bool countSwitches = false;
+    static constexpr bool countPreemptions = true;
+};
+
+/**
+ * @struct TurnaroundAccounting
+ * @brief Record switches and idle gaps; waiting is turnaround minus burst
+ *
+ * As in RoundRobinScheduler: switch time counts as waiting and precedes
+ * the first response. Arrivals during a slice are admitted when it ends,
+ * so they queue ahead of the process that ran it, and can preempt it then
+ * rather than one tick later.
+ */
+struct TurnaroundAccounting : ServiceAccounting {
+    static constexpr bool switchEvents = true;
+    static constexpr bool responseAfterSwitch = true;
+    static constexpr bool waitFromTurnaround = true;
+    static constexpr bool idleEvents = true;
+    static constexpr bool admitAtSliceEnd = true;
+};
+
+#endif // SCHEDULING_POLICIES_H
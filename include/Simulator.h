@@ -13,6 +13,8 @@
 #include "MultilevelQueueScheduler.h"
 #include "MultilevelFeedbackQueueScheduler.h"
 #include "Visualizer.h"
+#include "WorkloadGenerator.h"
+#include "Workload.h"
 #include "Process.h"
 #include "Metrics.h"
 #include <memory>
@@ -21,6 +23,11 @@
 #include <functional>
 #include <random>
 
+struct SweepSpace;
+struct SweepOptions;
+struct BenchmarkOptions;
+struct ReplicaOptions;
+
 /**
  * @struct SimulationConfig
  * @brief Configuration for simulation runs
@@ -31,8 +38,27 @@ struct SimulationConfig {
     bool showMetrics = true;                ///< Display metrics
     bool compareAlgorithms = false;         ///< Run comparison mode
     int visualizationDelay = 100;           ///< Delay between frames (ms)
-    bool dynamicArrivals = false;           ///< Enable dynamic process arrivals
-    int maxSimulationTime = 1000;           ///< Maximum simulation time
+    bool dynamicArrivals = false;           ///< Inject arrivals from arrivalSpec during runs
+    int maxSimulationTime = 1000;           ///< Latest dynamic arrival time
+    WorkloadSpec arrivalSpec;               ///< Dynamic arrival distributions (count unused)
+    bool verifyEventEngine = false;         ///< Cross-check against tick-based run
+    bool parallelComparison = false;        ///< Run schedulers on a thread pool
+    int workerThreads = 0;                  ///< Pool size (0 = hardware threads)
+    int loadThreads = 1;                    ///< Trace parser threads (0 = hardware threads)
+    std::string tracePrefix;                ///< Stream each run to CSV files (empty = off)
+    bool headless = false;                  ///< No Visualizer output: results are only returned or exported
+    int ganttStart = 0;                     ///< First time unit of the Gantt chart
+    int ganttEnd = -1;                      ///< End of the Gantt chart (-1 = end of run)
+};
+
+/**
+ * @struct RunResult
+ * @brief Outcome of one scheduler run, returned by Simulator::runBatch()
+ */
+struct RunResult {
+    std::string schedulerName;      ///< Display name of the scheduler
+    Metrics metrics;                ///< Metrics of the run
+    std::string messages;           ///< Status and warning lines of the run (empty = none)
 };
 
 /**
@@ -46,6 +72,7 @@ class Simulator {
 private:
     std::vector<std::unique_ptr<Scheduler>> schedulers;
     std::vector<Process> baseProcesses;
+    std::shared_ptr<const Workload> workload; ///< baseProcesses shared with the schedulers (built on demand)
     std::unique_ptr<Visualizer> visualizer;
     SimulationConfig simConfig;
     SchedulerConfig schedConfig;
@@ -53,22 +80,78 @@ private:
     std::mt19937 rng;
 
     /**
-     * @brief Generate random processes
-     * @param count Number of processes
-     * @param maxBurst Maximum burst time
-     * @param maxArrival Maximum arrival time
-     * @param maxPriority Maximum priority value
-     * @return Vector of generated processes
+     * @brief Run one scheduler, verifying the event engine if configured
+     *
+     * With SimulationConfig::tracePrefix set, the run is streamed to
+     * <prefix>_<scheduler>_events.csv and <prefix>_<scheduler>_completions.csv.
+     * With SimulationConfig::dynamicArrivals set, the run gets its own
+     * GeneratedArrivalSource (uniform arrivals are drawn as poisson), with
+     * pids after the static ones and arrivals up to maxSimulationTime, so
+     * every scheduler sees the same arrivals.
+     * @param scheduler Scheduler loaded with processes
+     * @param out Stream for status messages
+     * @param err Stream for warnings
+     */
+    void runScheduler(Scheduler& scheduler, std::ostream& out, std::ostream& err);
+
+    /**
+     * @brief Scheduler configuration for the base processes
+     * @return schedConfig, with policyEngine set if some process has I/O bursts
+     *         (only the policy engine blocks processes on them)
+     */
+    SchedulerConfig workloadConfig() const;
+
+    /**
+     * @brief Load the base processes into a scheduler, run it and report
+     * @param scheduler Scheduler to run
+     * @param view Visualizer writing the report
+     * @param err Stream for warnings
+     * @return Metrics of the run
      */
-    std::vector<Process> generateRandomProcesses(int count, int maxBurst,
-                                                  int maxArrival, int maxPriority);
+    Metrics simulateAndReport(Scheduler& scheduler, const Visualizer& view,
+                              std::ostream& err);
 
     /**
-     * @brief Callback for dynamic process arrival
-     * @param currentTime Current simulation time
-     * @return New process if one arrives, nullptr otherwise
+     * @brief Build the shared workload from the base processes if needed
+     *
+     * Called before the schedulers run, so parallel runs only read it.
      */
-    Process* dynamicArrivalCallback(int currentTime);
+    void shareWorkload();
+
+    /**
+     * @brief Load the base processes into a scheduler and run it
+     * @param scheduler Scheduler to run
+     * @param out Stream for status messages
+     * @param err Stream for warnings
+     */
+    void loadAndRun(Scheduler& scheduler, std::ostream& out, std::ostream& err);
+
+    /**
+     * @brief Call a task for every scheduler index
+     *
+     * With SimulationConfig::parallelComparison the tasks run on a thread
+     * pool; each must touch only its own scheduler and output slots.
+     * @param task Task taking a scheduler index
+     */
+    void forEachScheduler(const std::function<void(size_t)>& task);
+
+    /**
+     * @brief Store the metrics of the newest scheduler's run
+     */
+    void recordLastResult();
+
+    /**
+     * @brief Display the Gantt chart and metrics of a finished run
+     * @param scheduler Scheduler that has run
+     */
+    void displayRun(const Scheduler& scheduler) const;
+
+    /**
+     * @brief Display the configured Gantt window of a finished run
+     * @param scheduler Scheduler that has run
+     * @param view Visualizer drawing the chart
+     */
+    void displayGantt(const Scheduler& scheduler, const Visualizer& view) const;
 
 public:
     /**
@@ -89,6 +172,28 @@ public:
     void initialize(const SimulationConfig& simCfg = SimulationConfig(),
                     const SchedulerConfig& schedCfg = SchedulerConfig());
 
+    /**
+     * @brief Create a scheduler of a given type
+     *
+     * Builds the classic class of the type, or its SchedulerEngine
+     * instantiation when config.policyEngine is set (or the type exists
+     * only as one).
+     * @param type Scheduler type
+     * @param config Scheduler configuration
+     * @return New scheduler, nullptr for an unknown type
+     */
+    static std::unique_ptr<Scheduler> createScheduler(SchedulerType type,
+                                                      const SchedulerConfig& config);
+
+    /**
+     * @brief Algorithms compared when none are requested
+     *
+     * Every algorithm the classic classes implement, plus the fair
+     * scheduler; SJF and SRTF must be asked for by name.
+     * @return Scheduler types in report order
+     */
+    static std::vector<SchedulerType> defaultAlgorithms();
+
     /**
      * @brief Add a scheduler to the simulation
      * @param type Type of scheduler to add
@@ -107,14 +212,36 @@ public:
      */
     void setProcesses(const std::vector<Process>& processes);
 
+    /**
+     * @brief Set processes for simulation from a shared workload
+     *
+     * The schedulers schedule the workload itself rather than a copy, so
+     * one workload can feed several simulators.
+     * @param shared Workload to simulate (never modified)
+     */
+    void setWorkload(std::shared_ptr<const Workload> shared);
+
     /**
      * @brief Generate random test processes
+     *
+     * Uniform bursts 1-20, arrivals 0-10 and priorities 0-10, from a fresh
+     * random seed.
      * @param count Number of processes
      */
     void generateProcesses(int count);
 
+    /**
+     * @brief Generate a seeded synthetic workload
+     * @param spec Size, seed and distributions
+     * @return false if the spec is invalid
+     */
+    bool generateProcesses(const WorkloadSpec& spec);
+
     /**
      * @brief Load processes from file
+     *
+     * Reads text or binary workloads with WorkloadLoader; text is parsed
+     * on SimulationConfig::loadThreads threads.
      * @param filename Input file path
      * @return true if successful
      */
@@ -123,31 +250,112 @@ public:
     /**
      * @brief Save processes to file
      * @param filename Output file path
+     * @param binary Write the binary columnar format instead of text
      * @return true if successful
      */
-    bool saveProcessesToFile(const std::string& filename) const;
+    bool saveProcessesToFile(const std::string& filename, bool binary = false) const;
 
     /**
      * @brief Run simulation for all schedulers
+     *
+     * With SimulationConfig::parallelComparison each scheduler runs on a
+     * worker thread. Output is buffered per scheduler and printed in
+     * scheduler order once all runs finish, so it matches a sequential run.
+     * With SimulationConfig::headless nothing is rendered; the runs'
+     * messages go to standard error.
      */
     void runAll();
 
+    /**
+     * @brief Run every scheduler on the base processes without rendering
+     *
+     * The library entry point for batch use: the Visualizer is never
+     * called and nothing is written to standard output. Runs use the
+     * thread pool with SimulationConfig::parallelComparison. getResults()
+     * holds the same metrics afterwards, so exportResults() and
+     * writeResults() work as after runAll().
+     * @return One result per scheduler, in scheduler order (empty if there
+     *         are no processes)
+     */
+    std::vector<RunResult> runBatch();
+
     /**
      * @brief Run simulation for specific scheduler
      * @param type Scheduler type to run
      */
     void run(SchedulerType type);
 
+    /**
+     * @brief Run one scheduler straight from a trace file
+     *
+     * Text processes are read from the file into the scheduler one at a
+     * time, and binary workloads go straight into its process table,
+     * without building the base process list first.
+     * @param type Scheduler type to run
+     * @param filename Trace file path
+     * @return true if the file was read and contained processes
+     */
+    bool runStreaming(SchedulerType type, const std::string& filename);
+
+    /**
+     * @brief Run one scheduler until a time and save a snapshot of the run
+     *
+     * Runs the policy-engine instantiation of the type, the only one with
+     * snapshots, on the current processes. A run that finishes before the
+     * pause is recorded as by run(), and no snapshot is written.
+     * @param type Scheduler type to run
+     * @param pauseAt Simulation time to pause at
+     * @param filename Snapshot file to write
+     * @return true if the snapshot was saved or the run finished
+     */
+    bool runToSnapshot(SchedulerType type, int pauseAt, const std::string& filename);
+
+    /**
+     * @brief Finish a snapshotted run under the current configuration
+     *
+     * The scheduler type and processes come from the snapshot; quantum,
+     * queues, aging and the other settings are this simulator's, so a run
+     * can go on under another configuration than it started with.
+     * @param filename Snapshot file to read
+     * @return true if the snapshot was read and the run finished
+     */
+    bool resumeSnapshot(const std::string& filename);
+
     /**
      * @brief Run comparison between all schedulers
      */
     void runComparison();
 
+    /**
+     * @brief Run a parameter sweep over the current processes
+     *
+     * Uses the scheduler configuration as the base for fields not swept.
+     * @param space Candidate values per configuration field
+     * @param options Point selection, algorithms and thread count
+     * @param filename CSV output file (empty = standard output)
+     * @return true if the sweep ran and the table was written
+     */
+    bool runSweep(const SweepSpace& space, const SweepOptions& options,
+                  const std::string& filename = "");
+
+    /**
+     * @brief Run Monte Carlo replicas of a seeded workload
+     *
+     * Uses the scheduler configuration; prints progress and the means with
+     * their confidence intervals, and writes the CSV table if a file is given.
+     * @param spec Workload of replica 0 (replica r uses seed + r)
+     * @param options Replica counts, stopping rule, algorithms and threads
+     * @param filename CSV output file (empty = no table)
+     * @return true if the replicas ran and the table was written
+     */
+    bool runReplicas(const WorkloadSpec& spec, const ReplicaOptions& options,
+                     const std::string& filename = "");
+
     /**
      * @brief Get results from all schedulers
      * @return Vector of metrics
      */
-    std::vector<Metrics> getResults() const { return results; }
+    const std::vector<Metrics>& getResults() const { return results; }
 
     /**
      * @brief Export results to CSV
@@ -155,16 +363,27 @@ public:
      */
     void exportResults(const std::string& filename) const;
 
+    /**
+     * @brief Write the results table as CSV
+     * @param out Destination stream
+     */
+    void writeResults(std::ostream& out) const;
+
     /**
      * @brief Display interactive menu
      */
     void interactiveMenu();
 
     /**
-     * @brief Run benchmark with various workloads
-     * @param iterations Number of iterations per test
+     * @brief Benchmark the schedulers on seeded synthetic workloads
+     *
+     * Uses the scheduler configuration; prints a line per result and
+     * writes the results as JSON.
+     * @param options Sizes, repetitions, seed and algorithms
+     * @param filename JSON output file (empty = standard output)
+     * @return true if the benchmark ran and the results were written
      */
-    void runBenchmark(int iterations = 5);
+    bool runBenchmark(const BenchmarkOptions& options, const std::string& filename = "");
 
     /**
      * @brief Set simulation configuration
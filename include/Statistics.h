@@ -0,0 +1,195 @@
+/**
+ * @file Statistics.h
+ * @brief Constant-memory summaries of integer time samples
+ * @version 1.0
+ */
+
+#ifndef STATISTICS_H
+#define STATISTICS_H
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+/**
+ * @class RunningStats
+ * @brief Count, sum, min, max, mean and variance of a stream of values
+ *
+ * Mean and variance use Welford's update, and two summaries combine with
+ * Chan's formula, so partial results from separate runs merge exactly as
+ * if every value had been added to one summary.
+ */
+class RunningStats {
+private:
+    long long count;    ///< Number of values added
+    long long sum;      ///< Exact sum of the values
+    int minValue;       ///< Smallest value added
+    int maxValue;       ///< Largest value added
+    double mean;        ///< Running mean
+    double m2;          ///< Running sum of squared deviations from the mean
+
+public:
+    /**
+     * @brief Default constructor - an empty summary
+     */
+    RunningStats();
+
+    /**
+     * @brief Forget every value
+     */
+    void clear();
+
+    /**
+     * @brief Add one value
+     * @param value Value to add
+     */
+    void add(int value);
+
+    /**
+     * @brief Fold another summary into this one
+     * @param other Summary of a disjoint set of values
+     */
+    void merge(const RunningStats& other);
+
+    long long getCount() const { return count; }
+    long long getSum() const { return sum; }
+    int getMin() const { return minValue; }     ///< 0 when empty
+    int getMax() const { return maxValue; }     ///< 0 when empty
+    double getMean() const { return mean; }
+
+    /**
+     * @brief Sample variance (n - 1 denominator)
+     * @return Variance, or 0 with fewer than two values
+     */
+    double getVariance() const;
+};
+
+/**
+ * @class SampleStats
+ * @brief Mean, variance and confidence interval of real-valued samples
+ *
+ * RunningStats for per-run results such as one replica's average waiting
+ * time: Welford's update, Chan's merge, and a Student-t interval for the
+ * mean.
+ */
+class SampleStats {
+private:
+    long long count;    ///< Number of samples added
+    double mean;        ///< Running mean
+    double m2;          ///< Running sum of squared deviations from the mean
+
+public:
+    /**
+     * @brief Default constructor - no samples
+     */
+    SampleStats();
+
+    /**
+     * @brief Add one sample
+     * @param value Sample to add
+     */
+    void add(double value);
+
+    /**
+     * @brief Fold another summary into this one
+     * @param other Summary of a disjoint set of samples
+     */
+    void merge(const SampleStats& other);
+
+    long long getCount() const { return count; }
+    double getMean() const { return mean; }
+
+    /**
+     * @brief Sample variance (n - 1 denominator)
+     * @return Variance, or 0 with fewer than two samples
+     */
+    double getVariance() const;
+
+    /**
+     * @brief Half-width of the two-sided Student-t interval for the mean
+     * @param confidence Confidence level in (0, 1), e.g. 0.95
+     * @return Half-width, or infinity with fewer than two samples
+     */
+    double halfWidth(double confidence) const;
+
+    /**
+     * @brief Quantile of Student's t distribution
+     * @param probability Cumulative probability in (0, 1)
+     * @param degrees Degrees of freedom, at least 1
+     * @return t such that P(T <= t) = probability
+     */
+    static double tQuantile(double probability, long long degrees);
+};
+
+/**
+ * @class QuantileSketch
+ * @brief Mergeable histogram for approximate percentiles of non-negative times
+ *
+ * Log-linear buckets in the style of an HDR histogram: values below
+ * SUB_BUCKETS are counted exactly, and each larger power-of-two range is
+ * split into SUB_BUCKETS / 2 buckets, so a reported percentile is within
+ * 2 / SUB_BUCKETS (about 1.6%) of the true value. Buckets are allocated
+ * only up to the largest value seen (at most about 1700 for any int).
+ * Negative values are counted in the first bucket.
+ */
+class QuantileSketch {
+public:
+    static constexpr int SUB_BUCKETS = 128;     ///< Exact range and precision
+
+private:
+    std::vector<std::uint64_t> counts;  ///< Values per bucket
+    std::uint64_t total;                ///< Values added
+
+    /**
+     * @brief Bucket holding a value
+     */
+    static size_t bucketOf(int value);
+
+    /**
+     * @brief Smallest value in a bucket
+     */
+    static int bucketLowerBound(size_t bucket);
+
+public:
+    /**
+     * @brief Default constructor - an empty sketch
+     */
+    QuantileSketch();
+
+    /**
+     * @brief Forget every value
+     */
+    void clear();
+
+    /**
+     * @brief Add one value
+     * @param value Value to add
+     */
+    void add(int value);
+
+    /**
+     * @brief Fold another sketch into this one
+     * @param other Sketch of a disjoint set of values
+     */
+    void merge(const QuantileSketch& other);
+
+    /**
+     * @brief Get the number of values added
+     */
+    std::uint64_t getCount() const { return total; }
+
+    /**
+     * @brief Nearest-rank percentile
+     * @param fraction Quantile in [0, 1] (0.99 = p99)
+     * @return Lower bound of the bucket holding that rank, or 0 when empty
+     */
+    int quantile(double fraction) const;
+
+    /**
+     * @brief Exact equality of every bucket
+     */
+    bool operator==(const QuantileSketch& other) const;
+    bool operator!=(const QuantileSketch& other) const { return !(*this == other); }
+};
+
+#endif // STATISTICS_H
@@ -0,0 +1,75 @@
+/**
+ * @file ThreadPool.h
+ * @brief Fixed-size worker pool for running independent simulations
+ * @version 1.0
+ */
+
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <vector>
+#include <queue>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <cstddef>
+
+/**
+ * @class ThreadPool
+ * @brief Runs submitted tasks on a fixed set of worker threads
+ *
+ * Tasks run in submission order as workers free up. Each submit() returns a
+ * future; an exception thrown by the task is rethrown from future::get().
+ * The destructor finishes every queued task before joining the workers.
+ */
+class ThreadPool {
+private:
+    std::vector<std::thread> workers;           ///< Worker threads
+    std::queue<std::function<void()>> tasks;    ///< Pending tasks
+    std::mutex mutex;                           ///< Guards tasks and stopping
+    std::condition_variable available;          ///< Signals new tasks or shutdown
+    bool stopping;                              ///< Set when the pool shuts down
+
+    /**
+     * @brief Worker loop: run tasks until the pool stops and the queue drains
+     */
+    void workerLoop();
+
+public:
+    /**
+     * @brief Constructor
+     * @param threads Number of workers (0 = one per hardware thread)
+     */
+    explicit ThreadPool(size_t threads = 0);
+
+    /**
+     * @brief Destructor - drains the queue and joins all workers
+     */
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /**
+     * @brief Queue a task
+     * @param task Task to run
+     * @return Future completed when the task finishes
+     */
+    std::future<void> submit(std::function<void()> task);
+
+    /**
+     * @brief Number of worker threads
+     * @return Worker count
+     */
+    size_t size() const { return workers.size(); }
+
+    /**
+     * @brief Worker count used when none is requested
+     * @return Hardware thread count, at least 1
+     */
+    static size_t defaultThreadCount();
+};
+
+#endif // THREAD_POOL_H
@@ -0,0 +1,198 @@
+/**
+ * @file TimerWheel.h
+ * @brief Hashed timer wheel for I/O completions
+ * @version 1.0
+ */
+
+#ifndef TIMER_WHEEL_H
+#define TIMER_WHEEL_H
+
+#include "LevelMask.h"
+#include <vector>
+#include <algorithm>
+#include <climits>
+#include <cstddef>
+
+/**
+ * @class TimerWheel
+ * @brief One-shot timers keyed by process index, O(1) to schedule and fire
+ *
+ * A power-of-two ring of slots, one per time value: every pending timer
+ * lies within one turn of the wheel ([base, latest], shorter than the
+ * number of slots), so a slot only
+ * ever holds timers for a single time and firing needs no sorting. Timers
+ * of the same time fire in the order they were scheduled. A timer further
+ * out than one turn doubles the wheel; I/O lengths are short next to a
+ * run, so that stops after the first few bursts. A LevelMask over the
+ * slots finds the next due slot without scanning empty ones.
+ *
+ * Each process index has at most one pending timer, which fits blocked
+ * processes: a process in I/O cannot block again until it wakes.
+ */
+class TimerWheel {
+private:
+    std::vector<int> heads;     ///< First timer of each slot, -1 if empty
+    std::vector<int> tails;     ///< Last timer of each slot, -1 if empty
+    std::vector<int> links;     ///< Next timer in the same slot, by id
+    std::vector<int> due;       ///< Fire time of each pending id
+    LevelMask occupied;         ///< Slots holding at least one timer
+    int base;                   ///< Earliest time a pending timer can have
+    int latest;                 ///< Latest time a pending timer can have
+    size_t pending;             ///< Timers scheduled and not yet fired
+
+    size_t slotOf(int time) const {
+        return static_cast<size_t>(static_cast<unsigned>(time)) & (heads.size() - 1);
+    }
+
+    void append(int id, int time) {
+        const size_t slot = slotOf(time);
+        links[id] = -1;
+        due[id] = time;
+        if (heads[slot] == -1) {
+            heads[slot] = id;
+            occupied.set(static_cast<int>(slot));
+        } else {
+            links[tails[slot]] = id;
+        }
+        tails[slot] = id;
+    }
+
+    /**
+     * @brief Double the wheel, keeping the firing order
+     */
+    void grow() {
+        std::vector<int> order;
+        order.reserve(pending);
+        forEach([&order](int id, int) { order.push_back(id); });
+        const size_t slots = heads.size() * 2;
+        heads.assign(slots, -1);
+        tails.assign(slots, -1);
+        occupied.reset(slots);
+        for (int id : order) {
+            append(id, due[id]);
+        }
+    }
+
+public:
+    /**
+     * @brief Constructor
+     * @param slots Initial number of slots (rounded up to a power of two)
+     */
+    explicit TimerWheel(size_t slots = 64)
+        : base(0)
+        , latest(0)
+        , pending(0)
+    {
+        size_t size = 1;
+        while (size < slots) {
+            size *= 2;
+        }
+        heads.assign(size, -1);
+        tails.assign(size, -1);
+        occupied.reset(size);
+    }
+
+    /**
+     * @brief Drop every pending timer
+     */
+    void reset() {
+        if (pending > 0) {
+            std::fill(heads.begin(), heads.end(), -1);
+            std::fill(tails.begin(), tails.end(), -1);
+            occupied.reset(heads.size());
+        }
+        base = 0;
+        latest = 0;
+        pending = 0;
+    }
+
+    /**
+     * @brief Schedule a timer
+     * @param id Non-negative id without a pending timer (a process index)
+     * @param time Fire time, after the latest expire() time (any time since reset())
+     */
+    void schedule(int id, int time) {
+        if (static_cast<size_t>(id) >= links.size()) {
+            links.resize(static_cast<size_t>(id) + 1, -1);
+            due.resize(links.size(), 0);
+        }
+        const int first = pending == 0 ? time : std::min(base, time);
+        const int last = pending == 0 ? time : std::max(latest, time);
+        while (static_cast<long long>(last) - first >= static_cast<long long>(heads.size())) {
+            grow();
+        }
+        base = first;
+        latest = last;
+        append(id, time);
+        pending++;
+    }
+
+    /**
+     * @brief Time of the earliest pending timer
+     * @return Fire time, INT_MAX if none is pending
+     */
+    int nextTime() const {
+        if (pending == 0) {
+            return INT_MAX;
+        }
+        const int start = static_cast<int>(slotOf(base));
+        int slot = occupied.next(start);
+        if (slot == -1) {
+            slot = occupied.first();
+        }
+        return base + static_cast<int>(static_cast<size_t>(slot - start) & (heads.size() - 1));
+    }
+
+    /**
+     * @brief Fire every timer due at or before a time, earliest first
+     * @param now Current time
+     * @param fire Called with each id; may schedule timers later than now
+     */
+    template <typename Fire>
+    void expire(int now, Fire&& fire) {
+        while (pending > 0) {
+            const int time = nextTime();
+            if (time > now) {
+                break;
+            }
+            const size_t slot = slotOf(time);
+            int id = heads[slot];
+            heads[slot] = -1;
+            tails[slot] = -1;
+            occupied.clear(static_cast<int>(slot));
+            base = time;
+            while (id != -1) {
+                const int next = links[id];
+                pending--;
+                fire(id);
+                id = next;
+            }
+        }
+        if (now > base) {
+            base = now;
+        }
+    }
+
+    /**
+     * @brief Visit the pending timers in firing order
+     * @param visit Called with each id and its fire time
+     */
+    template <typename Visit>
+    void forEach(Visit&& visit) const {
+        if (pending == 0) {
+            return;
+        }
+        const size_t start = slotOf(base);
+        for (size_t k = 0; k < heads.size(); ++k) {
+            const size_t slot = (start + k) & (heads.size() - 1);
+            for (int id = heads[slot]; id != -1; id = links[id]) {
+                visit(id, due[id]);
+            }
+        }
+    }
+
+    bool empty() const { return pending == 0; }
+    size_t size() const { return pending; }
+};
+
+#endif // TIMER_WHEEL_H
@@ -0,0 +1,173 @@
+/**
+ * @file TraceSink.h
+ * @brief Destinations that receive timeline events and completions as a run goes
+ * @version 1.0
+ */
+
+#ifndef TRACE_SINK_H
+#define TRACE_SINK_H
+
+#include "Scheduler.h"
+#include <iostream>
+#include <string>
+#include <vector>
+#include <functional>
+#include <cstddef>
+
+/**
+ * @struct CompletionRecord
+ * @brief Final times of a process, published when it terminates
+ */
+struct CompletionRecord {
+    int processId;          ///< Process ID
+    int arrivalTime;        ///< Arrival time
+    int burstTime;          ///< Total CPU burst time
+    int completionTime;     ///< Completion time
+    int turnaroundTime;     ///< Arrival to completion
+    int waitingTime;        ///< Time spent waiting
+    int responseTime;       ///< Arrival to first execution
+};
+
+/**
+ * @class TraceSink
+ * @brief Receives a scheduler's output while it runs
+ *
+ * Each timeline event is published once it is final (when the next one is
+ * recorded, or when the run ends), so a kind set after the slice (preempt,
+ * demote) is included. Combined with SchedulerConfig::keepTimeline = false
+ * the scheduler keeps only the newest event in memory.
+ */
+class TraceSink {
+public:
+    virtual ~TraceSink() = default;
+
+    /**
+     * @brief Receive a finished timeline event
+     * @param event Event in timeline order
+     */
+    virtual void onEvent(const ExecutionEvent& event) = 0;
+
+    /**
+     * @brief Receive a terminated process
+     * @param record Final times of the process
+     */
+    virtual void onCompletion(const CompletionRecord& record) = 0;
+
+    /**
+     * @brief Write out anything buffered; called at the end of each run
+     */
+    virtual void flush() {}
+};
+
+/**
+ * @class CsvTraceSink
+ * @brief Writes events and completions as CSV rows
+ *
+ * Rows are formatted into memory and written in batches of about
+ * bufferBytes, so the streams see few large writes.
+ */
+class CsvTraceSink : public TraceSink {
+private:
+    std::ostream& eventsOut;        ///< Destination of event rows
+    std::ostream& completionsOut;   ///< Destination of completion rows
+    size_t bufferBytes;             ///< Batch size before writing
+    std::string eventBuffer;        ///< Pending event rows
+    std::string completionBuffer;   ///< Pending completion rows
+
+public:
+    /**
+     * @brief Constructor - writes the CSV headers
+     * @param eventsOut Stream for "PID,Start,End,Kind" rows
+     * @param completionsOut Stream for per-process completion rows
+     * @param bufferBytes Batch size before writing
+     */
+    CsvTraceSink(std::ostream& eventsOut, std::ostream& completionsOut,
+                 size_t bufferBytes = 1 << 16);
+
+    /**
+     * @brief Destructor - flushes pending rows
+     */
+    ~CsvTraceSink() override;
+
+    void onEvent(const ExecutionEvent& event) override;
+    void onCompletion(const CompletionRecord& record) override;
+    void flush() override;
+};
+
+/**
+ * @class BinaryTraceSink
+ * @brief Writes events and completions as packed fixed-size records
+ *
+ * Events are ExecutionEvent records and completions CompletionRecord
+ * records, in host byte order, buffered batchSize at a time.
+ */
+class BinaryTraceSink : public TraceSink {
+private:
+    std::ostream& eventsOut;                    ///< Destination of event records
+    std::ostream& completionsOut;               ///< Destination of completion records
+    size_t batchSize;                           ///< Records buffered before writing
+    std::vector<ExecutionEvent> eventBatch;     ///< Pending events
+    std::vector<CompletionRecord> completionBatch; ///< Pending completions
+
+public:
+    /**
+     * @brief Constructor
+     * @param eventsOut Stream for event records (open in binary mode)
+     * @param completionsOut Stream for completion records (open in binary mode)
+     * @param batchSize Records buffered before writing
+     */
+    BinaryTraceSink(std::ostream& eventsOut, std::ostream& completionsOut,
+                    size_t batchSize = 4096);
+
+    /**
+     * @brief Destructor - flushes pending records
+     */
+    ~BinaryTraceSink() override;
+
+    void onEvent(const ExecutionEvent& event) override;
+    void onCompletion(const CompletionRecord& record) override;
+    void flush() override;
+};
+
+/**
+ * @class CallbackTraceSink
+ * @brief Forwards events and completions to functions
+ */
+class CallbackTraceSink : public TraceSink {
+private:
+    std::function<void(const ExecutionEvent&)> eventCallback;          ///< Event handler
+    std::function<void(const CompletionRecord&)> completionCallback;   ///< Completion handler
+
+public:
+    /**
+     * @brief Constructor
+     * @param onEvent Called for each event (may be empty)
+     * @param onCompletion Called for each completion (may be empty)
+     */
+    CallbackTraceSink(std::function<void(const ExecutionEvent&)> onEvent,
+                      std::function<void(const CompletionRecord&)> onCompletion = nullptr);
+
+    void onEvent(const ExecutionEvent& event) override;
+    void onCompletion(const CompletionRecord& record) override;
+};
+
+/**
+ * @class CountingTraceSink
+ * @brief Counts events and completions without storing them
+ */
+class CountingTraceSink : public TraceSink {
+private:
+    long long events;       ///< Events received
+    long long completions;  ///< Completions received
+
+public:
+    CountingTraceSink() : events(0), completions(0) {}
+
+    void onEvent(const ExecutionEvent&) override { events++; }
+    void onCompletion(const CompletionRecord&) override { completions++; }
+
+    long long getEventCount() const { return events; }
+    long long getCompletionCount() const { return completions; }
+};
+
+#endif // TRACE_SINK_H
@@ -14,6 +14,18 @@
 #include <iostream>
 #include <map>
 
+/**
+ * @struct GanttBucket
+ * @brief One column of a downsampled Gantt chart
+ */
+struct GanttBucket {
+    static constexpr int IDLE = -1;     ///< processId of a mostly idle column
+    static constexpr int SWITCH = -2;   ///< processId of a mostly context-switch column
+
+    int processId;          ///< Pid holding the column longest, or IDLE / SWITCH
+    double busyFraction;    ///< Share of the column spent executing processes
+};
+
 /**
  * @class Visualizer
  * @brief Provides text-based real-time visualization of scheduling
@@ -27,6 +39,7 @@ private:
     bool colorEnabled;                  ///< Use ANSI colors
     bool animationEnabled;              ///< Enable animation delays
     int animationDelay;                 ///< Delay between frames (ms)
+    std::ostream* out;                  ///< Destination of all output (std::cout by default)
 
     // ANSI color codes
     static const std::string RESET;
@@ -72,6 +85,34 @@ private:
      */
     void drawProgressBar(double progress, int width) const;
 
+    /**
+     * @brief Print one row of the process table
+     */
+    void drawProcessRow(int pid, int priority, int burstTime, int arrivalTime,
+                        ProcessState state, int queueLevel) const;
+
+    /**
+     * @brief Print the process table title rows
+     */
+    void drawProcessTableHeader() const;
+
+    /**
+     * @brief Print the process table closing border
+     */
+    void drawProcessTableFooter() const;
+
+    /**
+     * @brief Print one CPU's row of a Gantt chart
+     *
+     * Adjacent columns of the same pid merge into one labelled run.
+     * @param buckets Columns from bucketTimeline()
+     * @param label Lane label, padded to the lane margin
+     * @param showLoad Add a row of utilization glyphs under the pids
+     * @param runStarts Receives the column of each run start (nullptr = ignore)
+     */
+    void drawGanttLane(const std::vector<GanttBucket>& buckets, const std::string& label,
+                       bool showLoad, std::vector<int>* runStarts) const;
+
 public:
     /**
      * @brief Constructor
@@ -86,19 +127,57 @@ public:
     ~Visualizer() = default;
 
     /**
-     * @brief Display Gantt chart
+     * @brief Display Gantt chart of a whole run
      * @param timeline Execution events
+     * @param cpuCount CPUs of the run; above 1 draws one lane per CPU
      */
-    void displayGanttChart(const std::vector<ExecutionEvent>& timeline) const;
+    void displayGanttChart(const std::vector<ExecutionEvent>& timeline,
+                           int cpuCount = 1) const;
 
     /**
-     * @brief Display compact Gantt chart
+     * @brief Display Gantt chart of the time window [startTime, endTime)
+     *
+     * The window is fitted to the display width. A short window gets a
+     * whole number of columns per time unit. A long one gets several time
+     * units per column, each shown as its dominant pid with a utilization
+     * glyph below it. The cost depends on the chart width, not on the
+     * length of the run or, on one CPU, the number of events. Only SMP
+     * runs make one pass over the timeline, to split it into lanes.
      * @param timeline Execution events
+     * @param startTime First time unit shown
+     * @param endTime End of the window (-1 = end of the run)
+     * @param cpuCount CPUs of the run; above 1 draws one lane per CPU
+     */
+    void displayGanttWindow(const std::vector<ExecutionEvent>& timeline, int startTime,
+                            int endTime, int cpuCount = 1) const;
+
+    /**
+     * @brief Display compact Gantt chart
+     * @param timeline Execution events of one CPU
      * @param maxWidth Maximum width
      */
     void displayCompactGanttChart(const std::vector<ExecutionEvent>& timeline, 
                                    int maxWidth = 60) const;
 
+    /**
+     * @brief Downsample one CPU's timeline into chart columns
+     *
+     * Column i covers [startTime + i * w, startTime + (i + 1) * w), with
+     * w = (endTime - startTime) / columns. It finds its first event by
+     * binary search. It sums the exact overlap of up to 32 events, and
+     * beyond that it samples 32 evenly spaced points. Each column
+     * therefore costs O(log events), however many events it covers. A
+     * column shows whichever of execution, context switching and idling
+     * takes longest; for execution, the pid that ran longest.
+     * @param lane Events of one CPU, sorted by start time, not overlapping
+     * @param startTime Start of the window
+     * @param endTime End of the window
+     * @param columns Number of columns
+     * @return One bucket per column (all IDLE for an empty window)
+     */
+    static std::vector<GanttBucket> bucketTimeline(const std::vector<ExecutionEvent>& lane,
+                                                   int startTime, int endTime, int columns);
+
     /**
      * @brief Display ready queue status
      * @param readyQueue Processes in ready queue
@@ -124,6 +203,12 @@ public:
      */
     void displayProcessTable(const std::vector<Process>& processes) const;
 
+    /**
+     * @brief Display all process states straight from a process table
+     * @param processes Process table of a scheduler
+     */
+    void displayProcessTable(const ProcessTable& processes) const;
+
     /**
      * @brief Display process state transition
      * @param process Process that changed state
@@ -186,6 +271,18 @@ public:
      */
     void setAnimationDelay(int ms) { animationDelay = ms; }
 
+    /**
+     * @brief Redirect output to another stream
+     * @param stream Stream to write to (must outlive its use here)
+     */
+    void setOutputStream(std::ostream& stream) { out = &stream; }
+
+    /**
+     * @brief Get the stream output is written to
+     * @return Output stream
+     */
+    std::ostream& getOutputStream() const { return *out; }
+
     /**
      * @brief Print a separator line
      */
@@ -0,0 +1,62 @@
+/**
+ * @file Workload.h
+ * @brief Immutable process set shared by schedulers and runs
+ * @version 1.0
+ */
+
+#ifndef WORKLOAD_H
+#define WORKLOAD_H
+
+#include "Process.h"
+#include "ProcessTable.h"
+#include <vector>
+#include <cstddef>
+
+/**
+ * @class Workload
+ * @brief Processes in their initial state, built once and never modified
+ *
+ * Held through std::shared_ptr<const Workload> so any number of
+ * schedulers, threads and runs can schedule the same processes without a
+ * copy each. A scheduler given a workload (Scheduler::setWorkload())
+ * loads the rows into its own table before every run and only ever
+ * writes that table, so the workload stays as it was built.
+ */
+class Workload {
+private:
+    ProcessTable table;  ///< Every process, in the NEW state
+
+public:
+    /**
+     * @brief Build a workload from a prepared table
+     *
+     * Runtime columns are reset, so a table taken from a finished
+     * scheduler can be reused as is.
+     * @param processes Processes to share (moved in)
+     */
+    explicit Workload(ProcessTable processes);
+
+    /**
+     * @brief Build a workload from processes
+     * @param processes Processes to share (copied, then reset)
+     */
+    explicit Workload(const std::vector<Process>& processes);
+
+    /**
+     * @brief Get the processes
+     * @return Table in the NEW state
+     */
+    const ProcessTable& getTable() const { return table; }
+
+    /**
+     * @brief Build Process objects for every process
+     * @return Processes in row order
+     */
+    std::vector<Process> toProcesses() const { return table.toProcesses(); }
+
+    size_t size() const { return table.size(); }
+    bool empty() const { return table.empty(); }
+    bool hasIo() const { return table.hasIo(); }
+};
+
+#endif // WORKLOAD_H
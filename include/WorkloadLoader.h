@@ -0,0 +1,155 @@
+/**
+ * @file WorkloadLoader.h
+ * @brief Fast loading and saving of process workload files
+ * @version 1.0
+ */
+
+#ifndef WORKLOAD_LOADER_H
+#define WORKLOAD_LOADER_H
+
+#include "Process.h"
+#include "ProcessTable.h"
+#include <vector>
+#include <string>
+#include <cstddef>
+
+/**
+ * @class MappedFile
+ * @brief Read-only view of a whole file's contents
+ *
+ * Memory-maps the file where the platform supports it, otherwise reads
+ * it into a buffer. The view stays valid for the object's lifetime.
+ */
+class MappedFile {
+private:
+    const char* contents;       ///< First byte of the file
+    size_t length;              ///< File size in bytes
+    bool mapped;                ///< contents is a mapping (not buffer)
+    bool opened;                ///< File was opened successfully
+    std::vector<char> buffer;   ///< Fallback storage when not mapped
+
+public:
+    /**
+     * @brief Constructor
+     * @param filename File to open
+     */
+    explicit MappedFile(const std::string& filename);
+
+    /**
+     * @brief Destructor - unmaps the file
+     */
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    bool isOpen() const { return opened; }
+    const char* data() const { return contents; }
+    size_t size() const { return length; }
+};
+
+/**
+ * @class WorkloadReader
+ * @brief Streams processes from a trace file one at a time
+ *
+ * Accepts the format written by Simulator::saveProcessesToFile: one
+ * "PID Priority BurstTime ArrivalTime" record per line, separated by
+ * whitespace or commas, optionally followed by I/O bursts as
+ * "after:length" pairs (CPU time before the burst, time blocked; see
+ * Process::addIoBurst()). A first line containing "PID" is a header; other
+ * lines that do not start with four integers (comments, blank lines) are
+ * skipped. Processes come back in file order without being collected.
+ */
+class WorkloadReader {
+private:
+    MappedFile file;        ///< Trace contents
+    const char* cursor;     ///< Start of the next unread line
+    const char* last;       ///< End of the contents
+
+public:
+    /**
+     * @brief Constructor
+     * @param filename Trace file to read
+     */
+    explicit WorkloadReader(const std::string& filename);
+
+    /**
+     * @brief Check if the file could be opened
+     */
+    bool isOpen() const { return file.isOpen(); }
+
+    /**
+     * @brief Read the next process
+     * @param process Output process
+     * @return false once the file is exhausted
+     */
+    bool next(Process& process);
+};
+
+/**
+ * @class WorkloadLoader
+ * @brief Loads a whole trace file into memory
+ *
+ * Text traces use the same format as WorkloadReader. Large files can be
+ * split at line boundaries and parsed on several threads; the result is in
+ * file order whatever the thread count.
+ *
+ * Binary workloads are columnar: a 24-byte header ("CPUW", version,
+ * byte-order mark, flags, row count), then the pid, priority, burst and
+ * arrival columns as 32-bit integers, then, if the names flag is set,
+ * count + 1 64-bit name offsets and the concatenated names, then, if the
+ * I/O flag is set, count + 1 64-bit burst offsets and the bursts as pairs
+ * of 32-bit integers (after, length), unaligned. Values are in
+ * host byte order; a file written on a host of the other order is rejected.
+ */
+class WorkloadLoader {
+public:
+    /**
+     * @brief Load every process from a text or binary workload file
+     * @param filename Workload file to read
+     * @param processes Output processes (replaced)
+     * @param threads Text parser threads (0 = one per hardware thread)
+     * @param error Optional output describing why loading failed
+     * @return false if the file cannot be opened or is malformed
+     */
+    static bool load(const std::string& filename, std::vector<Process>& processes,
+                     size_t threads = 1, std::string* error = nullptr);
+
+    /**
+     * @brief Check if a file is a binary workload
+     * @param filename File to inspect
+     * @return true if the file starts with the binary magic
+     */
+    static bool isBinary(const std::string& filename);
+
+    /**
+     * @brief Load a binary workload straight into a process table
+     * @param filename Binary workload file
+     * @param table Output table (rows are appended)
+     * @param error Optional output describing why loading failed
+     * @return false if the file cannot be opened or is malformed
+     */
+    static bool loadBinary(const std::string& filename, ProcessTable& table,
+                           std::string* error = nullptr);
+
+    /**
+     * @brief Write processes as a binary workload
+     *
+     * Names are stored only if some process has a name other than "P<pid>",
+ * I/O bursts only if some process has one.
+     * @param filename Output file
+     * @param processes Processes to write
+     * @return false if the file cannot be written
+     */
+    static bool saveBinary(const std::string& filename, const std::vector<Process>& processes);
+
+    /**
+     * @brief Parse trace text
+     * @param first Start of the text
+     * @param last End of the text
+     * @param processes Parsed processes are appended here
+     */
+    static void parse(const char* first, const char* last, std::vector<Process>& processes);
+};
+
+#endif // WORKLOAD_LOADER_H
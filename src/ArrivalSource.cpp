@@ -0,0 +1,90 @@
+/**
+ * @file ArrivalSource.cpp
+ * @brief Implementation of the arrival sources
+ * @version 1.0
+ */
+
+#include "ArrivalSource.h"
+#include <algorithm>
+#include <climits>
+#include <numeric>
+#include <stdexcept>
+
+TableArrivalSource::TableArrivalSource(ProcessTable table)
+    : table(std::move(table))
+    , order(this->table.size())
+    , cursor(0)
+{
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [this](int a, int b) {
+        return this->table.getArrivalTime(a) < this->table.getArrivalTime(b);
+    });
+}
+
+bool TableArrivalSource::next(Arrival& arrival) {
+    if (cursor >= order.size()) {
+        return false;
+    }
+    const int row = order[cursor++];
+    arrival = {table.getPid(row), table.getPriority(row), table.getBurstTime(row),
+               table.getArrivalTime(row)};
+    return true;
+}
+
+/**
+ * @brief Check that a spec can drive an open arrival stream
+ */
+static const WorkloadSpec& checkOpenSpec(const WorkloadSpec& spec) {
+    if (spec.arrivals == ArrivalPattern::UNIFORM) {
+        throw std::invalid_argument("Dynamic arrivals need a poisson or diurnal arrival pattern");
+    }
+    return spec;
+}
+
+GeneratedArrivalSource::GeneratedArrivalSource(const WorkloadSpec& spec, int firstPid)
+    : generator(checkOpenSpec(spec))
+    , chunkSize(spec.chunkSize)
+    , firstPid(firstPid)
+    , priorities(spec.chunkSize)
+    , bursts(spec.chunkSize)
+    , arrivals(spec.chunkSize)
+    , chunk(0)
+    , rows(0)
+    , cursor(0)
+    , timeOffset(0.0)
+{
+    if (firstPid < 0) {
+        throw std::invalid_argument("Dynamic arrival pids must not be negative");
+    }
+    rewind();
+}
+
+void GeneratedArrivalSource::rewind() {
+    chunk = 0;
+    cursor = 0;
+    timeOffset = 0.0;
+    rows = generator.getChunkCount() > 0 ?
+           generator.generateChunk(0, timeOffset, priorities.data(), bursts.data(),
+                                   arrivals.data()) : 0;
+}
+
+bool GeneratedArrivalSource::next(Arrival& arrival) {
+    if (cursor >= rows) {
+        if (rows == 0 || chunk + 1 >= generator.getChunkCount()) {
+            return false;
+        }
+        // Same offsets as generate(), so the stream matches the batch workload
+        timeOffset += generator.chunkDuration(chunk);
+        chunk++;
+        cursor = 0;
+        rows = generator.generateChunk(chunk, timeOffset, priorities.data(), bursts.data(),
+                                       arrivals.data());
+    }
+    const long long pid = firstPid + static_cast<long long>(chunk * chunkSize + cursor);
+    if (pid > INT_MAX) {
+        return false;
+    }
+    arrival = {static_cast<int>(pid), priorities[cursor], bursts[cursor], arrivals[cursor]};
+    cursor++;
+    return true;
+}
@@ -0,0 +1,255 @@
+/**
+ * @file Benchmark.cpp
+ * @brief Implementation of the scheduler benchmark suite
+ * @version 1.0
+ */
+
+#include "Benchmark.h"
+#include "Simulator.h"
+#include "TraceSink.h"
+#include "WorkloadGenerator.h"
+#include <algorithm>
+#include <chrono>
+#include <climits>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+#ifndef _WIN32
+#include <sys/resource.h>
+#endif
+
+/**
+ * @brief Nearest-rank percentile of sorted values
+ */
+static double percentile(const std::vector<double>& sorted, double fraction) {
+    if (sorted.empty()) {
+        return 0.0;
+    }
+    size_t rank = static_cast<size_t>(std::ceil(fraction * sorted.size()));
+    return sorted[std::min(std::max<size_t>(rank, 1), sorted.size()) - 1];
+}
+
+/**
+ * @brief Quote a string for JSON output
+ */
+static std::string jsonString(const std::string& text) {
+    std::string quoted = "\"";
+    for (char ch : text) {
+        if (ch == '"' || ch == '\\') {
+            quoted += '\\';
+        }
+        quoted += ch;
+    }
+    return quoted + "\"";
+}
+
+Benchmark::Benchmark(const SchedulerConfig& config, const BenchmarkOptions& options)
+    : config(config)
+    , options(options)
+{
+    if (options.sizes.empty()) {
+        throw std::invalid_argument("Benchmark needs at least one workload size");
+    }
+    for (int size : options.sizes) {
+        if (size < 1) {
+            throw std::invalid_argument("Benchmark size out of range: " + std::to_string(size));
+        }
+    }
+    if (options.iterations < 1 || options.warmupRuns < 0) {
+        throw std::invalid_argument("Benchmark needs at least one timed iteration");
+    }
+    this->config.keepTimeline = options.keepHistory;
+    this->config.keepProcessMetrics = options.keepHistory;
+}
+
+std::vector<SchedulerType> Benchmark::getAlgorithms() const {
+    if (!options.algorithms.empty()) {
+        return options.algorithms;
+    }
+    return Simulator::defaultAlgorithms();
+}
+
+ProcessTable Benchmark::generateWorkload(int count, unsigned int seed) {
+    WorkloadSpec spec;
+    spec.count = count;
+    spec.seed = seed;
+    spec.maxPriority = 9;
+    // Mean burst is 10.5, so arrivals over count * 10 keep the CPU saturated
+    spec.maxArrival = static_cast<int>(std::min<long long>(static_cast<long long>(count) * 10,
+                                                           INT_MAX));
+    spec.threads = 0;
+    return WorkloadGenerator(spec).generate();
+}
+
+long long Benchmark::peakRssKb() {
+#ifdef __linux__
+    // VmHWM is the high-water mark resetPeakRss() restarts; ru_maxrss is not
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line)) {
+        if (line.rfind("VmHWM:", 0) == 0) {
+            long long kb = 0;
+            std::istringstream(line.substr(6)) >> kb;
+            return kb;
+        }
+    }
+#endif
+#ifndef _WIN32
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0) {
+        return 0;
+    }
+#ifdef __APPLE__
+    return static_cast<long long>(usage.ru_maxrss) / 1024;
+#else
+    return static_cast<long long>(usage.ru_maxrss);
+#endif
+#else
+    return 0;
+#endif
+}
+
+bool Benchmark::resetPeakRss() {
+#ifdef __linux__
+    std::ofstream clearRefs("/proc/self/clear_refs");
+    clearRefs << "5";
+    clearRefs.flush();
+    return static_cast<bool>(clearRefs);
+#else
+    return false;
+#endif
+}
+
+std::vector<BenchmarkResult> Benchmark::run(std::ostream* progress) const {
+    const std::vector<SchedulerType> algorithms = getAlgorithms();
+    std::vector<BenchmarkResult> results;
+    results.reserve(options.sizes.size() * algorithms.size());
+
+    for (int size : options.sizes) {
+        const ProcessTable workload = generateWorkload(size, options.seed);
+
+        for (SchedulerType type : algorithms) {
+            BenchmarkResult result;
+            result.algorithm = type;
+            result.processes = size;
+            result.events = 0;
+            result.peakRssPerAlgorithm = resetPeakRss();
+
+            for (int n = 0; n < options.warmupRuns + options.iterations; ++n) {
+                std::unique_ptr<Scheduler> scheduler = Simulator::createScheduler(type, config);
+                CountingTraceSink counter;
+                scheduler->setProcessTable(workload);
+                scheduler->setTraceSink(&counter);
+
+                auto start = std::chrono::steady_clock::now();
+                scheduler->run();
+                auto end = std::chrono::steady_clock::now();
+
+                if (n >= options.warmupRuns) {
+                    result.wallMs.push_back(
+                        std::chrono::duration<double, std::milli>(end - start).count());
+                    result.profile.merge(scheduler->getRunStats());
+                }
+                result.schedulerName = scheduler->getName();
+                result.events = counter.getEventCount();
+            }
+
+            std::vector<double> sorted = result.wallMs;
+            std::sort(sorted.begin(), sorted.end());
+            result.minMs = sorted.front();
+            result.medianMs = percentile(sorted, 0.5);
+            result.p90Ms = percentile(sorted, 0.9);
+            result.p99Ms = percentile(sorted, 0.99);
+            result.maxMs = sorted.back();
+            result.eventsPerSecond = result.medianMs > 0.0 ?
+                result.events / (result.medianMs / 1000.0) : 0.0;
+            result.peakRssKb = peakRssKb();
+
+            if (progress) {
+                *progress << std::left << std::setw(32) << result.schedulerName.substr(0, 32)
+                          << std::right << std::setw(10) << size << " procs  median "
+                          << std::fixed << std::setprecision(3) << std::setw(10)
+                          << result.medianMs << " ms  " << std::setprecision(0)
+                          << std::setw(12) << result.eventsPerSecond << " events/s  "
+                          << std::setw(8) << result.peakRssKb << " KiB\n";
+                if (RunStats::enabled) {
+                    *progress << "    " << std::setprecision(1);
+                    for (size_t p = 0; p < RUN_PHASE_COUNT; ++p) {
+                        const RunPhase phase = static_cast<RunPhase>(p);
+                        *progress << RunStats::phaseName(phase) << " "
+                                  << result.profile.share(phase) * 100 << "%  ";
+                    }
+                    *progress << "peak runnable " << result.profile.peakRunnable
+                              << ", deadlines " << result.profile.peakDeadlines << "\n";
+                }
+                *progress << std::flush;
+            }
+            results.push_back(result);
+        }
+    }
+    return results;
+}
+
+/**
+ * @brief Write a result's phase counters as a "profile" member
+ */
+static void writeProfileJson(std::ostream& out, const RunStats& profile) {
+    out << ", \"profile\": {\"runNs\": " << profile.runNanoseconds
+        << ", \"phases\": {";
+    for (size_t p = 0; p < RUN_PHASE_COUNT; ++p) {
+        const RunPhase phase = static_cast<RunPhase>(p);
+        out << (p > 0 ? ", " : "") << jsonString(RunStats::phaseName(phase))
+            << ": {\"calls\": " << profile.counter(phase).calls
+            << ", \"ns\": " << profile.counter(phase).nanoseconds << "}";
+    }
+    out << "}, \"peakRunnable\": " << profile.peakRunnable
+        << ", \"peakDeadlines\": " << profile.peakDeadlines
+        << ", \"eventsPerSecond\": " << std::fixed << std::setprecision(0)
+        << profile.eventsPerSecond() << std::setprecision(6) << std::defaultfloat << "}";
+}
+
+void Benchmark::writeJson(std::ostream& out, const std::vector<BenchmarkResult>& results) const {
+    out << std::setprecision(6) << std::defaultfloat;
+    out << "{\n";
+    out << "  \"seed\": " << options.seed << ",\n";
+    out << "  \"warmupRuns\": " << options.warmupRuns << ",\n";
+    out << "  \"iterations\": " << options.iterations << ",\n";
+    out << "  \"keepHistory\": " << (options.keepHistory ? "true" : "false") << ",\n";
+    out << "  \"profiled\": " << (RunStats::enabled ? "true" : "false") << ",\n";
+    out << "  \"config\": {\"timeQuantum\": " << config.timeQuantum
+        << ", \"contextSwitchTime\": " << config.contextSwitchTime
+        << ", \"numQueues\": " << config.numQueues
+        << ", \"agingThreshold\": " << config.agingThreshold << "},\n";
+    out << "  \"results\": [";
+
+    for (size_t i = 0; i < results.size(); ++i) {
+        const BenchmarkResult& result = results[i];
+        out << (i > 0 ? ",\n" : "\n");
+        out << "    {\"algorithm\": " << jsonString(result.schedulerName)
+            << ", \"processes\": " << result.processes
+            << ", \"events\": " << result.events
+            << ", \"wallMs\": {\"min\": " << result.minMs
+            << ", \"median\": " << result.medianMs
+            << ", \"p90\": " << result.p90Ms
+            << ", \"p99\": " << result.p99Ms
+            << ", \"max\": " << result.maxMs
+            << ", \"runs\": [";
+        for (size_t r = 0; r < result.wallMs.size(); ++r) {
+            out << (r > 0 ? ", " : "") << result.wallMs[r];
+        }
+        out << "]}"
+            << ", \"eventsPerSecond\": " << std::fixed << std::setprecision(0)
+            << result.eventsPerSecond << std::setprecision(6) << std::defaultfloat
+            << ", \"peakRssKb\": " << result.peakRssKb
+            << ", \"peakRssPerAlgorithm\": " << (result.peakRssPerAlgorithm ? "true" : "false");
+        if (RunStats::enabled) {
+            writeProfileJson(out, result.profile);
+        }
+        out << "}";
+    }
+    out << "\n  ]\n}\n";
+}
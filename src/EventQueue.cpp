@@ -0,0 +1,46 @@
+/**
+ * @file EventQueue.cpp
+ * @brief Implementation of the simulation event queue
+ * @version 1.0
+ */
+
+#include "EventQueue.h"
+#include <algorithm>
+
+EventQueue::EventQueue()
+    : nextSequence(0)
+{}
+
+bool EventQueue::later(const SimEvent& a, const SimEvent& b) {
+    if (a.time != b.time) {
+        return a.time > b.time;
+    }
+    return a.sequence > b.sequence;
+}
+
+void EventQueue::push(int time, SimEventType type, int processIdx) {
+    heap.push_back({time, type, processIdx, nextSequence++});
+    std::push_heap(heap.begin(), heap.end(), later);
+}
+
+void EventQueue::pop() {
+    std::pop_heap(heap.begin(), heap.end(), later);
+    heap.pop_back();
+}
+
+void EventQueue::discardUntil(int time) {
+    while (!heap.empty() && heap.front().time <= time) {
+        pop();
+    }
+}
+
+void EventQueue::clear() {
+    heap.clear();
+    nextSequence = 0;
+}
+
+void EventQueue::restore(const std::vector<SimEvent>& saved, long long sequence) {
+    heap = saved;
+    std::make_heap(heap.begin(), heap.end(), later);
+    nextSequence = sequence;
+}
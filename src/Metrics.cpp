@@ -6,7 +6,6 @@
 
 #include "Metrics.h"
 #include <algorithm>
-#include <numeric>
 #include <cmath>
 #include <fstream>
 
@@ -21,7 +20,11 @@ Metrics::Metrics()
     , totalContextSwitches(0)
     , contextSwitchOverhead(0)
     , processCount(0)
-{}
+    , totalMigrations(0)
+    , keepSamples(true)
+{
+    reset();
+}
 
 void Metrics::reset() {
     avgWaitingTime = 0.0;
@@ -34,37 +37,48 @@ void Metrics::reset() {
     totalContextSwitches = 0;
     contextSwitchOverhead = 0;
     processCount = 0;
+    totalMigrations = 0;
+    cpuBusyTimes.clear();
     waitingTimes.clear();
     turnaroundTimes.clear();
     responseTimes.clear();
+    waitingStats.clear();
+    turnaroundStats.clear();
+    responseStats.clear();
+    waitingSketch.clear();
+    responseSketch.clear();
 }
 
 void Metrics::addWaitingTime(int time) {
-    waitingTimes.push_back(time);
+    if (keepSamples) {
+        waitingTimes.push_back(time);
+    }
+    waitingStats.add(time);
+    waitingSketch.add(time);
 }
 
 void Metrics::addTurnaroundTime(int time) {
-    turnaroundTimes.push_back(time);
+    if (keepSamples) {
+        turnaroundTimes.push_back(time);
+    }
+    turnaroundStats.add(time);
 }
 
 void Metrics::addResponseTime(int time) {
-    responseTimes.push_back(time);
+    if (keepSamples) {
+        responseTimes.push_back(time);
+    }
+    responseStats.add(time);
+    responseSketch.add(time);
 }
 
 void Metrics::calculateAverages() {
-    processCount = static_cast<int>(waitingTimes.size());
+    processCount = static_cast<int>(waitingStats.getCount());
     
     if (processCount > 0) {
-        double sumWaiting = std::accumulate(waitingTimes.begin(), 
-                                            waitingTimes.end(), 0.0);
-        double sumTurnaround = std::accumulate(turnaroundTimes.begin(), 
-                                               turnaroundTimes.end(), 0.0);
-        double sumResponse = std::accumulate(responseTimes.begin(), 
-                                             responseTimes.end(), 0.0);
-        
-        avgWaitingTime = sumWaiting / processCount;
-        avgTurnaroundTime = sumTurnaround / processCount;
-        avgResponseTime = sumResponse / processCount;
+        avgWaitingTime = static_cast<double>(waitingStats.getSum()) / processCount;
+        avgTurnaroundTime = static_cast<double>(turnaroundStats.getSum()) / processCount;
+        avgResponseTime = static_cast<double>(responseStats.getSum()) / processCount;
     }
 }
 
@@ -79,6 +93,29 @@ void Metrics::calculateUtilization(int totalTime, int idleTime, int switchOverhe
     }
 }
 
+void Metrics::calculateCpuUtilization(const std::vector<int>& busyTimes, int switchOverhead) {
+    cpuBusyTimes = busyTimes;
+    contextSwitchOverhead = switchOverhead;
+    
+    long long busy = 0;
+    for (int time : cpuBusyTimes) {
+        busy += time;
+    }
+    const long long capacity = static_cast<long long>(totalExecutionTime) * cpuBusyTimes.size();
+    totalIdleTime = static_cast<int>(capacity - busy - switchOverhead);
+    cpuUtilization = capacity > 0 ? (static_cast<double>(busy) / capacity) * 100.0 : 0.0;
+}
+
+double Metrics::getCpuUtilization(size_t cpu) const {
+    if (cpuBusyTimes.empty()) {
+        return cpuUtilization;
+    }
+    if (cpu >= cpuBusyTimes.size() || totalExecutionTime <= 0) {
+        return 0.0;
+    }
+    return (static_cast<double>(cpuBusyTimes[cpu]) / totalExecutionTime) * 100.0;
+}
+
 void Metrics::calculateThroughput(int totalTime) {
     if (totalTime > 0) {
         throughput = static_cast<double>(processCount) / totalTime;
@@ -86,39 +123,71 @@ void Metrics::calculateThroughput(int totalTime) {
 }
 
 double Metrics::getWaitingTimeVariance() const {
-    if (waitingTimes.size() < 2) return 0.0;
-    
-    double mean = avgWaitingTime;
-    double variance = 0.0;
-    
-    for (int time : waitingTimes) {
-        variance += (time - mean) * (time - mean);
-    }
-    
-    return variance / (waitingTimes.size() - 1);
+    return waitingStats.getVariance();
 }
 
 double Metrics::getTurnaroundTimeVariance() const {
-    if (turnaroundTimes.size() < 2) return 0.0;
-    
-    double mean = avgTurnaroundTime;
-    double variance = 0.0;
-    
-    for (int time : turnaroundTimes) {
-        variance += (time - mean) * (time - mean);
-    }
-    
-    return variance / (turnaroundTimes.size() - 1);
+    return turnaroundStats.getVariance();
 }
 
 int Metrics::getMinWaitingTime() const {
-    if (waitingTimes.empty()) return 0;
-    return *std::min_element(waitingTimes.begin(), waitingTimes.end());
+    return waitingStats.getMin();
 }
 
 int Metrics::getMaxWaitingTime() const {
-    if (waitingTimes.empty()) return 0;
-    return *std::max_element(waitingTimes.begin(), waitingTimes.end());
+    return waitingStats.getMax();
+}
+
+int Metrics::getWaitingTimePercentile(double fraction) const {
+    // Clamp to the exact extremes so p0 and p100 are never approximated
+    return std::min(std::max(waitingSketch.quantile(fraction), waitingStats.getMin()),
+                    waitingStats.getMax());
+}
+
+int Metrics::getResponseTimePercentile(double fraction) const {
+    return std::min(std::max(responseSketch.quantile(fraction), responseStats.getMin()),
+                    responseStats.getMax());
+}
+
+void Metrics::merge(const Metrics& other) {
+    if (keepSamples && other.keepSamples) {
+        waitingTimes.insert(waitingTimes.end(), other.waitingTimes.begin(),
+                            other.waitingTimes.end());
+        turnaroundTimes.insert(turnaroundTimes.end(), other.turnaroundTimes.begin(),
+                               other.turnaroundTimes.end());
+        responseTimes.insert(responseTimes.end(), other.responseTimes.begin(),
+                             other.responseTimes.end());
+    } else {
+        keepSamples = false;
+        waitingTimes.clear();
+        turnaroundTimes.clear();
+        responseTimes.clear();
+    }
+    waitingStats.merge(other.waitingStats);
+    turnaroundStats.merge(other.turnaroundStats);
+    responseStats.merge(other.responseStats);
+    waitingSketch.merge(other.waitingSketch);
+    responseSketch.merge(other.responseSketch);
+    
+    totalContextSwitches += other.totalContextSwitches;
+    totalMigrations += other.totalMigrations;
+    calculateAverages();
+    
+    std::vector<int> busyTimes;
+    if (!cpuBusyTimes.empty() && cpuBusyTimes.size() == other.cpuBusyTimes.size()) {
+        busyTimes = cpuBusyTimes;
+        for (size_t cpu = 0; cpu < busyTimes.size(); ++cpu) {
+            busyTimes[cpu] += other.cpuBusyTimes[cpu];
+        }
+    }
+    const int switchOverhead = contextSwitchOverhead + other.contextSwitchOverhead;
+    calculateUtilization(totalExecutionTime + other.totalExecutionTime,
+                         totalIdleTime + other.totalIdleTime, switchOverhead);
+    cpuBusyTimes.clear();
+    if (!busyTimes.empty()) {
+        calculateCpuUtilization(busyTimes, switchOverhead);
+    }
+    calculateThroughput(totalExecutionTime);
 }
 
 void Metrics::printReport() const {
@@ -146,13 +215,25 @@ void Metrics::printReport() const {
               << "                     ║\n";
     std::cout << "║ Context Switch Overhead:    " << std::setw(10) << contextSwitchOverhead 
               << " time units          ║\n";
+    if (!cpuBusyTimes.empty()) {
+        auto range = std::minmax_element(cpuBusyTimes.begin(), cpuBusyTimes.end());
+        std::cout << "║ CPUs:                       " << std::setw(10) << cpuBusyTimes.size()
+                  << "                     ║\n";
+        std::cout << "║ Per-CPU Utilization:   " << std::setw(7) << std::fixed
+                  << std::setprecision(2) << getCpuUtilization(range.first - cpuBusyTimes.begin())
+                  << " % to " << std::setw(7)
+                  << getCpuUtilization(range.second - cpuBusyTimes.begin())
+                  << " %              ║\n";
+        std::cout << "║ Migrations:                 " << std::setw(10) << totalMigrations
+                  << "                     ║\n";
+    }
     std::cout << "╚══════════════════════════════════════════════════════════════╝\n";
 }
 
 void Metrics::printDetailedReport() const {
     printReport();
     
-    if (!waitingTimes.empty()) {
+    if (processCount > 0) {
         std::cout << "\n╔══════════════════════════════════════════════════════════════╗\n";
         std::cout << "║               DETAILED STATISTICS                            ║\n";
         std::cout << "╠══════════════════════════════════════════════════════════════╣\n";
@@ -163,6 +244,25 @@ void Metrics::printDetailedReport() const {
                   << std::setprecision(2) << getWaitingTimeVariance() << "         ║\n";
         std::cout << "║ Turnaround Time Variance: " << std::setw(12) << std::fixed 
                   << std::setprecision(2) << getTurnaroundTimeVariance() << "                 ║\n";
+        std::cout << "║ Waiting Time   p95: " << std::setw(7) << getWaitingTimePercentile(0.95)
+                  << "  p99: " << std::setw(7) << getWaitingTimePercentile(0.99)
+                  << "  p99.9: " << std::setw(7) << getWaitingTimePercentile(0.999)
+                  << "    ║\n";
+        std::cout << "║ Response Time  p95: " << std::setw(7) << getResponseTimePercentile(0.95)
+                  << "  p99: " << std::setw(7) << getResponseTimePercentile(0.99)
+                  << "  p99.9: " << std::setw(7) << getResponseTimePercentile(0.999)
+                  << "    ║\n";
+        for (size_t cpu = 0; cpu < cpuBusyTimes.size(); ++cpu) {
+            std::cout << "║ CPU " << std::setw(5) << cpu << " Utilization: " << std::setw(10)
+                      << std::fixed << std::setprecision(2) << getCpuUtilization(cpu)
+                      << " %                         ║\n";
+        }
+        if (waitingTimes.empty()) {
+            std::cout << "╚══════════════════════════════════════════════════════════════╝\n";
+        }
+    }
+    
+    if (!waitingTimes.empty()) {
         std::cout << "╠══════════════════════════════════════════════════════════════╣\n";
         std::cout << "║ Per-Process Metrics:                                         ║\n";
         std::cout << "║ Process | Wait Time | Turnaround | Response                  ║\n";
@@ -194,6 +294,19 @@ bool Metrics::exportToCSV(const std::string& filename) const {
     file << "Throughput (proc/time)," << throughput << "\n";
     file << "Context Switches," << totalContextSwitches << "\n";
     file << "Context Switch Overhead," << contextSwitchOverhead << "\n";
+    file << "P95 Waiting Time," << getWaitingTimePercentile(0.95) << "\n";
+    file << "P99 Waiting Time," << getWaitingTimePercentile(0.99) << "\n";
+    file << "P99.9 Waiting Time," << getWaitingTimePercentile(0.999) << "\n";
+    file << "P95 Response Time," << getResponseTimePercentile(0.95) << "\n";
+    file << "P99 Response Time," << getResponseTimePercentile(0.99) << "\n";
+    file << "P99.9 Response Time," << getResponseTimePercentile(0.999) << "\n";
+    if (!cpuBusyTimes.empty()) {
+        file << "CPUs," << cpuBusyTimes.size() << "\n";
+        file << "Migrations," << totalMigrations << "\n";
+        for (size_t cpu = 0; cpu < cpuBusyTimes.size(); ++cpu) {
+            file << "CPU " << cpu << " Utilization (%)," << getCpuUtilization(cpu) << "\n";
+        }
+    }
     
     if (!waitingTimes.empty()) {
         file << "\nProcess,Waiting Time,Turnaround Time,Response Time\n";
@@ -208,3 +321,23 @@ bool Metrics::exportToCSV(const std::string& filename) const {
     file.close();
     return true;
 }
+
+bool Metrics::operator==(const Metrics& other) const {
+    return avgWaitingTime == other.avgWaitingTime &&
+           avgTurnaroundTime == other.avgTurnaroundTime &&
+           avgResponseTime == other.avgResponseTime &&
+           cpuUtilization == other.cpuUtilization &&
+           throughput == other.throughput &&
+           totalExecutionTime == other.totalExecutionTime &&
+           totalIdleTime == other.totalIdleTime &&
+           totalContextSwitches == other.totalContextSwitches &&
+           contextSwitchOverhead == other.contextSwitchOverhead &&
+           processCount == other.processCount &&
+           totalMigrations == other.totalMigrations &&
+           cpuBusyTimes == other.cpuBusyTimes &&
+           waitingTimes == other.waitingTimes &&
+           turnaroundTimes == other.turnaroundTimes &&
+           responseTimes == other.responseTimes &&
+           waitingSketch == other.waitingSketch &&
+           responseSketch == other.responseSketch;
+}
@@ -6,6 +6,7 @@
 
 #include "MultilevelFeedbackQueueScheduler.h"
 #include <algorithm>
+#include <climits>
 
 MultilevelFeedbackQueueScheduler::MultilevelFeedbackQueueScheduler(
     int numQueues, const SchedulerConfig& config)
@@ -15,13 +16,14 @@ MultilevelFeedbackQueueScheduler::MultilevelFeedbackQueueScheduler(
     , agingInterval(config.agingThreshold * 5)
     , lastBoostTime(0)
 {
-    queues.resize(numQueues);
+    buildQueues();
     
     // Setup quantums - exponentially increasing
     quantums.resize(numQueues);
     quantums[0] = config.timeQuantum;
     for (int i = 1; i < numQueues; ++i) {
-        quantums[i] = quantums[i-1] * 2;
+        // Deep hierarchies saturate instead of overflowing
+        quantums[i] = quantums[i-1] > INT_MAX / 2 ? INT_MAX : quantums[i-1] * 2;
     }
     
     // If custom quantums provided, use them
@@ -32,60 +34,128 @@ MultilevelFeedbackQueueScheduler::MultilevelFeedbackQueueScheduler(
     }
 }
 
+MultilevelFeedbackQueueScheduler::LevelQueues::LevelQueues(int numQueues,
+                                                           std::pmr::memory_resource* memory)
+    : boosted(memory)
+{
+    queues.reserve(numQueues);
+    for (int i = 0; i < numQueues; ++i) {
+        queues.emplace_back(std::pmr::polymorphic_allocator<int>(memory));
+    }
+    nonEmpty.reset(numQueues);
+}
+
+void MultilevelFeedbackQueueScheduler::buildQueues(int cpuCount) {
+    cpuQueues.clear();
+    cpuQueues.reserve(cpuCount);
+    for (int cpu = 0; cpu < cpuCount; ++cpu) {
+        cpuQueues.emplace_back(numQueues, runMemory());
+    }
+}
+
+void MultilevelFeedbackQueueScheduler::clearQueues(int cpuCount) {
+    if (cpuQueues.size() != static_cast<size_t>(cpuCount)) {
+        buildQueues(cpuCount);
+        return;
+    }
+    for (LevelQueues& queues : cpuQueues) {
+        queues.clear();
+    }
+}
+
+void MultilevelFeedbackQueueScheduler::LevelQueues::clear() {
+    for (LevelQueue& queue : queues) {
+        while (!queue.empty()) {
+            queue.pop();
+        }
+    }
+    boosted.clear();
+    nonEmpty.reset(queues.size());
+}
+
+void MultilevelFeedbackQueueScheduler::LevelQueues::enqueue(int level, int processIdx) {
+    queues[level].push(processIdx);
+    nonEmpty.set(level);
+}
+
+int MultilevelFeedbackQueueScheduler::LevelQueues::front(int level) const {
+    if (level == 0 && !boosted.empty()) {
+        return *boosted.begin();
+    }
+    return queues[level].front();
+}
+
+int MultilevelFeedbackQueueScheduler::LevelQueues::dequeue(int level) {
+    int processIdx;
+    if (level == 0 && !boosted.empty()) {
+        processIdx = *boosted.begin();
+        boosted.erase(boosted.begin());
+    } else {
+        processIdx = queues[level].front();
+        queues[level].pop();
+    }
+    if (queues[level].empty() && (level != 0 || boosted.empty())) {
+        nonEmpty.clear(level);
+    }
+    return processIdx;
+}
+
+void MultilevelFeedbackQueueScheduler::releaseRunMemory() {
+    // Containers go first: their memory is released underneath them
+    cpuQueues.clear();
+    Scheduler::releaseRunMemory();
+    buildQueues();
+}
+
 void MultilevelFeedbackQueueScheduler::demoteProcess(int processIdx) {
-    Process& p = processes[processIdx];
-    int currentQueue = p.getQueueLevel();
+    int currentQueue = processes.getQueueLevel(processIdx);
     
     if (currentQueue < numQueues - 1) {
-        p.setQueueLevel(currentQueue + 1);
-        processQueueMap[p.getPid()] = currentQueue + 1;
+        processes.setQueueLevel(processIdx, currentQueue + 1);
     }
 }
 
 void MultilevelFeedbackQueueScheduler::promoteProcess(int processIdx) {
-    Process& p = processes[processIdx];
-    int currentQueue = p.getQueueLevel();
+    int currentQueue = processes.getQueueLevel(processIdx);
     
     if (currentQueue > 0) {
-        p.setQueueLevel(currentQueue - 1);
-        processQueueMap[p.getPid()] = currentQueue - 1;
+        processes.setQueueLevel(processIdx, currentQueue - 1);
     }
 }
 
-void MultilevelFeedbackQueueScheduler::priorityBoost() {
-    // Move all processes to the highest priority queue
-    for (size_t i = 0; i < processes.size(); ++i) {
-        Process& p = processes[i];
-        if (p.getState() != ProcessState::TERMINATED) {
-            p.setQueueLevel(0);
-            processQueueMap[p.getPid()] = 0;
+void MultilevelFeedbackQueueScheduler::LevelQueues::boost(ProcessTable& processes) {
+    // Every ready process is queued, so draining the FIFO queues of the
+    // non-empty levels finds all those not boosted already; processes not
+    // yet arrived start at the top level anyway
+    for (int level = nonEmpty.first(); level != -1; level = nonEmpty.first()) {
+        LevelQueue& queue = queues[level];
+        while (!queue.empty()) {
+            const int idx = queue.front();
+            queue.pop();
+            if (processes.getState(idx) == ProcessState::READY) {
+                processes.setQueueLevel(idx, 0);
+                boosted.insert(idx);
+            }
         }
+        nonEmpty.clear(level);
     }
     
-    // Rebuild queues
-    for (int i = 0; i < numQueues; ++i) {
-        while (!queues[i].empty()) {
-            queues[i].pop();
-        }
+    // The top queue now holds every ready process in table order
+    if (!boosted.empty()) {
+        nonEmpty.set(0);
     }
-    
-    for (size_t i = 0; i < processes.size(); ++i) {
-        Process& p = processes[i];
-        if (p.getState() == ProcessState::READY) {
-            queues[0].push(static_cast<int>(i));
-        }
+}
+
+void MultilevelFeedbackQueueScheduler::priorityBoost() {
+    for (LevelQueues& queues : cpuQueues) {
+        queues.boost(processes);
     }
-    
     lastBoostTime = currentTime;
+    events.push(lastBoostTime + agingInterval, SimEventType::PRIORITY_BOOST);
 }
 
 int MultilevelFeedbackQueueScheduler::getHighestPriorityQueue() {
-    for (int i = 0; i < numQueues; ++i) {
-        if (!queues[i].empty()) {
-            return i;
-        }
-    }
-    return -1;
+    return cpuQueues[0].nonEmpty.first();
 }
 
 int MultilevelFeedbackQueueScheduler::getQuantumForQueue(int queueLevel) const {
@@ -97,85 +167,131 @@ int MultilevelFeedbackQueueScheduler::getQuantumForQueue(int queueLevel) const {
 
 void MultilevelFeedbackQueueScheduler::addProcess(const Process& process) {
     Scheduler::addProcess(process);
-    int processIdx = static_cast<int>(processes.size()) - 1;
-    processes[processIdx].setQueueLevel(0);  // Start at highest priority
-    processQueueMap[process.getPid()] = 0;
-    timeInQueue[process.getPid()] = 0;
+    processes.setQueueLevel(processes.size() - 1, 0);  // Start at highest priority
+}
+
+void MultilevelFeedbackQueueScheduler::onProcessInjected(int idx) {
+    addPidSlot(idx);
+    timeInQueue.resize(pidSlotCount, 0);
+}
+
+void MultilevelFeedbackQueueScheduler::smpBegin(int cpuCount) {
+    clearQueues(cpuCount);
+    timeInQueue.assign(pidSlotCount, 0);
+    lastBoostTime = 0;
+    if (agingEnabled) {
+        events.push(lastBoostTime + agingInterval, SimEventType::PRIORITY_BOOST);
+    }
+}
+
+void MultilevelFeedbackQueueScheduler::smpEnqueue(int cpu, int idx) {
+    cpuQueues[cpu].enqueue(processes.getQueueLevel(idx), idx);
+}
+
+int MultilevelFeedbackQueueScheduler::smpDequeue(int cpu) {
+    const int level = cpuQueues[cpu].nonEmpty.first();
+    return level == -1 ? -1 : cpuQueues[cpu].dequeue(level);
+}
+
+int MultilevelFeedbackQueueScheduler::smpSliceLength(int idx) const {
+    return std::min(getQuantumForQueue(processes.getQueueLevel(idx)),
+                    processes.getRemainingTime(idx));
+}
+
+EventKind MultilevelFeedbackQueueScheduler::smpSliceEnd(int idx, int ran) {
+    timeInQueue[pidSlot(idx)] += ran;
+    if (processes.getRemainingTime(idx) > 0 &&
+        ran >= getQuantumForQueue(processes.getQueueLevel(idx))) {
+        demoteProcess(idx);
+        return EventKind::DEMOTE;
+    }
+    return EventKind::EXECUTE;
+}
+
+void MultilevelFeedbackQueueScheduler::smpDeadlines() {
+    if (agingEnabled && (currentTime - lastBoostTime) >= agingInterval) {
+        priorityBoost();
+    }
 }
 
 void MultilevelFeedbackQueueScheduler::run() {
+    rewindArrivals();
+    if (config.numCpus > 1) {
+        // The engine sets up one set of level queues per CPU
+        runSmp();
+        return;
+    }
     currentTime = 0;
-    timeline.clear();
+    contextSwitches = 0;
+    serviceClock = 0;
+    // Long bursts sink to the last level, so its quantum sets the slice count
+    startTimeline(getQuantumForQueue(numQueues - 1));
     lastBoostTime = 0;
     
-    // Initialize queues
-    for (int i = 0; i < numQueues; ++i) {
-        while (!queues[i].empty()) {
-            queues[i].pop();
-        }
-    }
-    
-    processQueueMap.clear();
-    timeInQueue.clear();
+    // Start from empty queues, reusing the pooled blocks of the last run
+    clearQueues();
     
-    // Set initial process states
-    for (size_t i = 0; i < processes.size(); ++i) {
-        Process& p = processes[i];
-        p.reset();
-        p.setQueueLevel(0);
-        processQueueMap[p.getPid()] = 0;
-        timeInQueue[p.getPid()] = 0;
-        
-        if (p.getArrivalTime() == 0) {
-            p.setState(ProcessState::READY);
-            queues[0].push(static_cast<int>(i));
-        } else {
-            p.setState(ProcessState::NEW);
-        }
+    // Set initial process states; every level starts at 0
+    processes.resetAll();
+    buildPidSlots();
+    timeInQueue.assign(pidSlotCount, 0);
+    buildArrivalIndex();
+    if (agingEnabled) {
+        events.push(lastBoostTime + agingInterval, SimEventType::PRIORITY_BOOST);
     }
     
-    int completedProcesses = 0;
-    int totalProcesses = static_cast<int>(processes.size());
+    // Injected arrivals grow the table as the run goes
+    LevelQueues& queues = cpuQueues[0];
+    size_t completedProcesses = 0;
     
-    while (completedProcesses < totalProcesses) {
+    while (completedProcesses < processes.size()) {
         // Priority boost to prevent starvation
         if (agingEnabled && (currentTime - lastBoostTime) >= agingInterval) {
+            SCHED_PROFILE_PHASE(RunPhase::DEADLINES);
             priorityBoost();
         }
         
         // Handle new arrivals - always start at highest priority queue
-        for (size_t i = 0; i < processes.size(); ++i) {
-            Process& p = processes[i];
-            if (p.getState() == ProcessState::NEW && 
-                p.getArrivalTime() <= currentTime) {
-                p.setState(ProcessState::READY);
-                p.setQueueLevel(0);
-                processQueueMap[p.getPid()] = 0;
-                queues[0].push(static_cast<int>(i));
+        {
+            SCHED_PROFILE_PHASE(RunPhase::ADMISSION);
+            for (int idx : takeArrivals(currentTime)) {
+                processes.setState(idx, ProcessState::READY);
+                processes.beginWait(idx, serviceClock);
+                processes.setQueueLevel(idx, 0);
+                queues.enqueue(0, idx);
             }
+            events.discardUntil(currentTime);
         }
         
         // Get highest priority non-empty queue
-        int activeQueue = getHighestPriorityQueue();
+        int activeQueue;
+        int processIdx = -1;
+        {
+            SCHED_PROFILE_PHASE(RunPhase::SELECTION);
+            activeQueue = getHighestPriorityQueue();
+            if (activeQueue != -1) {
+                processIdx = queues.dequeue(activeQueue);
+            }
+        }
         
-        if (activeQueue != -1 && !queues[activeQueue].empty()) {
-            int processIdx = queues[activeQueue].front();
-            queues[activeQueue].pop();
+        if (activeQueue != -1) {
             
-            Process& p = processes[processIdx];
+            const int pid = processes.getPid(processIdx);
             
-            if (p.getState() == ProcessState::READY) {
-                p.setState(ProcessState::RUNNING);
+            if (processes.getState(processIdx) == ProcessState::READY) {
+                processes.setState(processIdx, ProcessState::RUNNING);
+                processes.endWait(processIdx, serviceClock);
                 
                 // Record response time on first execution
-                if (!p.getHasStarted()) {
-                    p.setResponseTime(currentTime - p.getArrivalTime());
-                    p.setHasStarted(true);
+                if (!processes.getHasStarted(processIdx)) {
+                    processes.setResponseTime(processIdx, 
+                                              currentTime - processes.getArrivalTime(processIdx));
+                    processes.setHasStarted(processIdx, true);
                 }
                 
                 // Context switch overhead
                 if (!timeline.empty() && 
-                    timeline.back().processId != p.getPid()) {
+                    timeline.back().processId != pid) {
                     currentTime += config.contextSwitchTime;
                     contextSwitches++;
                 }
@@ -183,45 +299,42 @@ void MultilevelFeedbackQueueScheduler::run() {
                 // Execute for time quantum
                 int quantum = getQuantumForQueue(activeQueue);
                 int executionStart = currentTime;
-                int actualTime = p.execute(quantum);
+                int actualTime = processes.execute(processIdx, quantum);
                 currentTime += actualTime;
                 
                 // Record execution event
-                timeline.push_back({p.getPid(), executionStart, currentTime});
+                recordEvent(pid, executionStart, currentTime);
                 
-                // Update waiting time for other ready processes
-                for (auto& proc : processes) {
-                    if (proc.getState() == ProcessState::READY && 
-                        proc.getArrivalTime() <= currentTime &&
-                        proc.getPid() != p.getPid()) {
-                        proc.setWaitingTime(proc.getWaitingTime() + actualTime);
-                    }
-                }
+                // Ready processes accrue this slice as waiting time
+                serviceClock += actualTime;
                 
                 // Update time in queue
-                timeInQueue[p.getPid()] += actualTime;
+                timeInQueue[pidSlot(processIdx)] += actualTime;
                 
                 // Check if process completed
-                if (p.getRemainingTime() == 0) {
-                    p.setState(ProcessState::TERMINATED);
-                    p.setCompletionTime(currentTime);
-                    p.setTurnaroundTime(currentTime - p.getArrivalTime());
+                if (processes.getRemainingTime(processIdx) == 0) {
+                    processes.setState(processIdx, ProcessState::TERMINATED);
+                    processes.setCompletionTime(processIdx, currentTime);
+                    processes.setTurnaroundTime(processIdx, 
+                                                currentTime - processes.getArrivalTime(processIdx));
+                    recordCompletion(processIdx);
                     completedProcesses++;
                 } else {
                     // Process used its entire quantum - demote
                     if (actualTime >= quantum) {
+                        timeline.back().kind = EventKind::DEMOTE;
                         demoteProcess(processIdx);
                     }
                     
                     // Return to appropriate queue
-                    p.setState(ProcessState::READY);
-                    int newQueue = p.getQueueLevel();
-                    queues[newQueue].push(processIdx);
+                    processes.setState(processIdx, ProcessState::READY);
+                    processes.beginWait(processIdx, serviceClock);
+                    queues.enqueue(processes.getQueueLevel(processIdx), processIdx);
                 }
             }
         } else {
-            // CPU idle
-            currentTime++;
+            // CPU idle until the next arrival or boost
+            advanceIdleTime();
         }
     }
     
@@ -229,24 +342,13 @@ void MultilevelFeedbackQueueScheduler::run() {
     calculateMetrics();
 }
 
-Process* MultilevelFeedbackQueueScheduler::getNextProcess() {
+int MultilevelFeedbackQueueScheduler::getNextProcess() {
     int activeQueue = getHighestPriorityQueue();
-    if (activeQueue == -1 || queues[activeQueue].empty()) {
-        return nullptr;
-    }
-    
-    int processIdx = queues[activeQueue].front();
-    return &processes[processIdx];
+    return activeQueue == -1 ? -1 : cpuQueues[0].front(activeQueue);
 }
 
 void MultilevelFeedbackQueueScheduler::reset() {
     Scheduler::reset();
-    for (auto& queue : queues) {
-        while (!queue.empty()) {
-            queue.pop();
-        }
-    }
-    processQueueMap.clear();
     timeInQueue.clear();
     lastBoostTime = 0;
 }
@@ -12,8 +12,11 @@ MultilevelQueueScheduler::MultilevelQueueScheduler(int numQueues,
     : Scheduler(config)
     , numQueues(numQueues)
     , currentQueue(0)
+    , lastCompletionTime(-1)
+    , completionsAtLast(0)
 {
     queues.resize(numQueues);
+    nonEmpty.reset(numQueues);
     
     // Setup default queue configurations
     queueConfigs.resize(numQueues);
@@ -22,7 +25,7 @@ MultilevelQueueScheduler::MultilevelQueueScheduler(int numQueues,
     queueConfigs[0] = {
         QueueType::SYSTEM,
         0,
-        config.timeQuantum / 2,  // Smaller quantum for system tasks
+        std::max(1, config.timeQuantum / 2),  // Smaller quantum for system tasks
         true,
         "System"
     };
@@ -50,14 +53,12 @@ MultilevelQueueScheduler::MultilevelQueueScheduler(int numQueues,
     }
 }
 
-int MultilevelQueueScheduler::assignToQueue(const Process& process) {
+int MultilevelQueueScheduler::assignToQueue(int priority) const {
     // Assign based on priority
     // Priority 0-2: System queue (0)
     // Priority 3-5: Interactive queue (1)
     // Priority 6+: Batch queue (2+)
     
-    int priority = process.getPriority();
-    
     if (priority <= 2) {
         return 0;  // System queue
     } else if (priority <= 5 && numQueues > 1) {
@@ -67,14 +68,14 @@ int MultilevelQueueScheduler::assignToQueue(const Process& process) {
     }
 }
 
+void MultilevelQueueScheduler::enqueue(int level, int processIdx) {
+    queues[level].push(processIdx);
+    nonEmpty.set(level);
+}
+
 int MultilevelQueueScheduler::getActiveQueue() {
     // Return highest priority non-empty queue
-    for (int i = 0; i < numQueues; ++i) {
-        if (!queues[i].empty()) {
-            return i;
-        }
-    }
-    return -1;
+    return nonEmpty.first();
 }
 
 bool MultilevelQueueScheduler::executeQueue(int queueIdx) {
@@ -82,27 +83,31 @@ bool MultilevelQueueScheduler::executeQueue(int queueIdx) {
         return false;
     }
     
-    int processIdx = queues[queueIdx].front();
-    queues[queueIdx].erase(queues[queueIdx].begin());
+    int processIdx = queues[queueIdx].pop();
+    if (queues[queueIdx].empty()) {
+        nonEmpty.clear(queueIdx);
+    }
     
-    Process& p = processes[processIdx];
+    const int pid = processes.getPid(processIdx);
     
-    if (p.getState() != ProcessState::READY || 
-        p.getArrivalTime() > currentTime) {
+    if (processes.getState(processIdx) != ProcessState::READY || 
+        processes.getArrivalTime(processIdx) > currentTime) {
         return false;
     }
     
-    p.setState(ProcessState::RUNNING);
+    processes.setState(processIdx, ProcessState::RUNNING);
+    processes.endWait(processIdx, serviceClock);
     
     // Record response time on first execution
-    if (!p.getHasStarted()) {
-        p.setResponseTime(currentTime - p.getArrivalTime());
-        p.setHasStarted(true);
+    if (!processes.getHasStarted(processIdx)) {
+        processes.setResponseTime(processIdx, 
+                                  currentTime - processes.getArrivalTime(processIdx));
+        processes.setHasStarted(processIdx, true);
     }
     
     // Context switch overhead
     if (!timeline.empty() && 
-        timeline.back().processId != p.getPid()) {
+        timeline.back().processId != pid) {
         currentTime += config.contextSwitchTime;
         contextSwitches++;
     }
@@ -110,30 +115,32 @@ bool MultilevelQueueScheduler::executeQueue(int queueIdx) {
     // Execute for time quantum
     int quantum = queueConfigs[queueIdx].timeQuantum;
     int executionStart = currentTime;
-    int actualTime = p.execute(quantum);
+    int actualTime = processes.execute(processIdx, quantum);
     currentTime += actualTime;
     
     // Record execution event
-    timeline.push_back({p.getPid(), executionStart, currentTime});
-    
-    // Update waiting time for other ready processes
-    for (auto& proc : processes) {
-        if (proc.getState() == ProcessState::READY && 
-            proc.getArrivalTime() <= currentTime &&
-            proc.getPid() != p.getPid()) {
-            proc.setWaitingTime(proc.getWaitingTime() + actualTime);
-        }
-    }
+    recordEvent(pid, executionStart, currentTime);
+    
+    // Ready processes accrue this slice as waiting time
+    serviceClock += actualTime;
     
     // Check if process completed
-    if (p.getRemainingTime() == 0) {
-        p.setState(ProcessState::TERMINATED);
-        p.setCompletionTime(currentTime);
-        p.setTurnaroundTime(currentTime - p.getArrivalTime());
+    if (processes.getRemainingTime(processIdx) == 0) {
+        processes.setState(processIdx, ProcessState::TERMINATED);
+        processes.setCompletionTime(processIdx, currentTime);
+        processes.setTurnaroundTime(processIdx, 
+                                    currentTime - processes.getArrivalTime(processIdx));
+        recordCompletion(processIdx);
+        if (currentTime != lastCompletionTime) {
+            lastCompletionTime = currentTime;
+            completionsAtLast = 0;
+        }
+        completionsAtLast++;
     } else {
         // Return to same queue
-        p.setState(ProcessState::READY);
-        queues[queueIdx].push_back(processIdx);
+        processes.setState(processIdx, ProcessState::READY);
+        processes.beginWait(processIdx, serviceClock);
+        enqueue(queueIdx, processIdx);
     }
     
     return true;
@@ -141,65 +148,69 @@ bool MultilevelQueueScheduler::executeQueue(int queueIdx) {
 
 void MultilevelQueueScheduler::addProcess(const Process& process) {
     Scheduler::addProcess(process);
-    int queueIdx = assignToQueue(process);
-    int processIdx = static_cast<int>(processes.size()) - 1;
-    processes[processIdx].setQueueLevel(queueIdx);
+    int queueIdx = assignToQueue(process.getPriority());
+    processes.setQueueLevel(processes.size() - 1, queueIdx);
+}
+
+void MultilevelQueueScheduler::onProcessInjected(int idx) {
+    processes.setQueueLevel(idx, assignToQueue(processes.getPriority(idx)));
 }
 
 void MultilevelQueueScheduler::run() {
+    rewindArrivals();
     currentTime = 0;
-    timeline.clear();
+    contextSwitches = 0;
+    serviceClock = 0;
+    startTimeline(config.timeQuantum);
     
     // Initialize queues and process states
     for (int i = 0; i < numQueues; ++i) {
         queues[i].clear();
     }
+    nonEmpty.reset(numQueues);
+    lastCompletionTime = -1;
+    completionsAtLast = 0;
     
+    // Reset before assigning: reset() clears the queue level
+    processes.resetAll();
     for (size_t i = 0; i < processes.size(); ++i) {
-        Process& p = processes[i];
-        int queueIdx = assignToQueue(p);
-        p.setQueueLevel(queueIdx);
-        p.reset();
-        
-        if (p.getArrivalTime() == 0) {
-            p.setState(ProcessState::READY);
-            queues[queueIdx].push_back(static_cast<int>(i));
-        } else {
-            p.setState(ProcessState::NEW);
-        }
+        processes.setQueueLevel(i, assignToQueue(processes.getPriority(i)));
     }
+    buildArrivalIndex();
     
-    int completedProcesses = 0;
-    int totalProcesses = static_cast<int>(processes.size());
+    // Injected arrivals grow the table as the run goes
+    size_t completedProcesses = 0;
     
-    while (completedProcesses < totalProcesses) {
+    while (completedProcesses < processes.size()) {
         // Handle new arrivals
-        for (size_t i = 0; i < processes.size(); ++i) {
-            Process& p = processes[i];
-            if (p.getState() == ProcessState::NEW && 
-                p.getArrivalTime() <= currentTime) {
-                p.setState(ProcessState::READY);
-                int queueIdx = p.getQueueLevel();
-                queues[queueIdx].push_back(static_cast<int>(i));
+        {
+            SCHED_PROFILE_PHASE(RunPhase::ADMISSION);
+            for (int idx : takeArrivals(currentTime)) {
+                processes.setState(idx, ProcessState::READY);
+                processes.beginWait(idx, serviceClock);
+                enqueue(processes.getQueueLevel(idx), idx);
             }
+            events.discardUntil(currentTime);
         }
         
         // Get highest priority non-empty queue
-        int activeQueue = getActiveQueue();
+        int activeQueue;
+        {
+            SCHED_PROFILE_PHASE(RunPhase::SELECTION);
+            activeQueue = getActiveQueue();
+        }
         
         if (activeQueue != -1) {
             executeQueue(activeQueue);
             
-            // Check for completed processes
-            for (const auto& p : processes) {
-                if (p.getState() == ProcessState::TERMINATED && 
-                    p.getCompletionTime() == currentTime) {
-                    completedProcesses++;
-                }
+            // Count the processes that terminated at the current time; completion
+            // times never decrease, so they are the latest completions
+            if (lastCompletionTime == currentTime) {
+                completedProcesses += completionsAtLast;
             }
         } else {
-            // CPU idle
-            currentTime++;
+            // CPU idle until the next arrival
+            advanceIdleTime();
         }
     }
     
@@ -207,14 +218,13 @@ void MultilevelQueueScheduler::run() {
     calculateMetrics();
 }
 
-Process* MultilevelQueueScheduler::getNextProcess() {
+int MultilevelQueueScheduler::getNextProcess() {
     int activeQueue = getActiveQueue();
     if (activeQueue == -1 || queues[activeQueue].empty()) {
-        return nullptr;
+        return -1;
     }
     
-    int processIdx = queues[activeQueue].front();
-    return &processes[processIdx];
+    return queues[activeQueue].front();
 }
 
 void MultilevelQueueScheduler::reset() {
@@ -222,5 +232,6 @@ void MultilevelQueueScheduler::reset() {
     for (auto& queue : queues) {
         queue.clear();
     }
+    nonEmpty.reset(numQueues);
     currentQueue = 0;
 }
@@ -0,0 +1,230 @@
+/**
+ * @file ParameterSweep.cpp
+ * @brief Implementation of the parameter-sweep engine
+ * @version 1.0
+ */
+
+#include "ParameterSweep.h"
+#include "Simulator.h"
+#include "ThreadPool.h"
+#include <future>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+
+/**
+ * @brief Reject candidate values below a minimum
+ */
+static void requireAtLeast(const std::vector<int>& values, int minimum, const char* field) {
+    for (int value : values) {
+        if (value < minimum) {
+            throw std::invalid_argument(std::string("Sweep value out of range for ") +
+                                        field + ": " + std::to_string(value));
+        }
+    }
+}
+
+/**
+ * @brief Format a quantum set for the results table ("4:8:16")
+ */
+static std::string joinQuantums(const std::vector<int>& quantums) {
+    std::string text;
+    for (size_t i = 0; i < quantums.size(); ++i) {
+        if (i > 0) {
+            text += ":";
+        }
+        text += std::to_string(quantums[i]);
+    }
+    return text;
+}
+
+/**
+ * @brief Apply the index-th candidate of every swept field to a config
+ */
+static SchedulerConfig applyChoice(SchedulerConfig config, const SweepSpace& space,
+                                   const std::vector<size_t>& choice) {
+    if (!space.timeQuantums.empty()) {
+        config.timeQuantum = space.timeQuantums[choice[0]];
+    }
+    if (!space.contextSwitchTimes.empty()) {
+        config.contextSwitchTime = space.contextSwitchTimes[choice[1]];
+    }
+    if (!space.numQueues.empty()) {
+        config.numQueues = space.numQueues[choice[2]];
+    }
+    if (!space.quantums.empty()) {
+        config.quantums = space.quantums[choice[3]];
+    }
+    if (!space.agingThresholds.empty()) {
+        config.agingThreshold = space.agingThresholds[choice[4]];
+    }
+    return config;
+}
+
+ParameterSweep::ParameterSweep(const std::vector<Process>& workload,
+                               const SchedulerConfig& baseConfig,
+                               const SweepSpace& space,
+                               const SweepOptions& options)
+    : workload(workload)
+    , baseConfig(baseConfig)
+    , space(space)
+    , options(options)
+{
+    requireAtLeast(space.timeQuantums, 1, "timeQuantum");
+    requireAtLeast(space.contextSwitchTimes, 0, "contextSwitchTime");
+    requireAtLeast(space.numQueues, 1, "numQueues");
+    requireAtLeast(space.agingThresholds, 1, "agingThreshold");
+    for (const auto& set : space.quantums) {
+        requireAtLeast(set, 1, "quantums");
+    }
+    if (options.mode == SweepMode::RANDOM && options.samples < 1) {
+        throw std::invalid_argument("Random sweep needs at least one sample");
+    }
+}
+
+std::vector<SchedulerConfig> ParameterSweep::generatePoints() const {
+    // Candidate count per field, in applyChoice order (0 = not swept)
+    const size_t sizes[5] = {
+        space.timeQuantums.size(), space.contextSwitchTimes.size(),
+        space.numQueues.size(), space.quantums.size(), space.agingThresholds.size()
+    };
+    std::vector<SchedulerConfig> points;
+    std::vector<size_t> choice(5, 0);
+
+    if (options.mode == SweepMode::RANDOM) {
+        std::mt19937 rng(options.seed);
+        points.reserve(static_cast<size_t>(options.samples));
+        for (int n = 0; n < options.samples; ++n) {
+            for (size_t f = 0; f < 5; ++f) {
+                if (sizes[f] > 0) {
+                    std::uniform_int_distribution<size_t> pick(0, sizes[f] - 1);
+                    choice[f] = pick(rng);
+                }
+            }
+            points.push_back(applyChoice(baseConfig, space, choice));
+        }
+        return points;
+    }
+
+    // Grid: odometer over the swept fields, last field varying fastest
+    while (true) {
+        points.push_back(applyChoice(baseConfig, space, choice));
+        int f = 4;
+        while (f >= 0) {
+            if (sizes[f] > 0 && ++choice[f] < sizes[f]) {
+                break;
+            }
+            choice[f] = 0;
+            f--;
+        }
+        if (f < 0) {
+            break;
+        }
+    }
+    return points;
+}
+
+std::vector<SchedulerType> ParameterSweep::getAlgorithms() const {
+    if (!options.algorithms.empty()) {
+        return options.algorithms;
+    }
+    return Simulator::defaultAlgorithms();
+}
+
+std::vector<SweepResult> ParameterSweep::run() const {
+    const std::vector<SchedulerConfig> points = generatePoints();
+    const std::vector<SchedulerType> algorithms = getAlgorithms();
+    std::vector<SweepResult> results(points.size() * algorithms.size());
+
+    // Each task fills its own slot, so no locking is needed
+    auto runTask = [&](size_t slot) {
+        size_t point = slot / algorithms.size();
+        SweepResult& result = results[slot];
+        result.point = point;
+        result.algorithm = algorithms[slot % algorithms.size()];
+        result.config = points[point];
+
+        std::unique_ptr<Scheduler> scheduler =
+            Simulator::createScheduler(result.algorithm, result.config);
+        scheduler->addProcesses(workload);
+        scheduler->run();
+        result.schedulerName = scheduler->getName();
+        result.metrics = scheduler->takeMetrics();
+    };
+
+    ThreadPool pool(options.workerThreads > 0 ?
+                    static_cast<size_t>(options.workerThreads) : 0);
+    std::vector<std::future<void>> pending;
+    pending.reserve(results.size());
+    for (size_t slot = 0; slot < results.size(); ++slot) {
+        pending.push_back(pool.submit([&runTask, slot]() { runTask(slot); }));
+    }
+    for (auto& task : pending) {
+        task.get();
+    }
+    return results;
+}
+
+void ParameterSweep::writeTable(std::ostream& out, const std::vector<SweepResult>& results) {
+    out << "Point,Algorithm,TimeQuantum,ContextSwitchTime,NumQueues,Quantums,"
+        << "AgingThreshold,AvgWaitTime,AvgTurnaroundTime,AvgResponseTime,"
+        << "CPUUtilization,Throughput,ContextSwitches,TotalTime,"
+        << "P99WaitTime,P99ResponseTime\n";
+
+    for (const auto& result : results) {
+        const SchedulerConfig& config = result.config;
+        const Metrics& metrics = result.metrics;
+        out << result.point << ","
+            << result.schedulerName << ","
+            << config.timeQuantum << ","
+            << config.contextSwitchTime << ","
+            << config.numQueues << ","
+            << joinQuantums(config.quantums) << ","
+            << config.agingThreshold << ","
+            << metrics.getAvgWaitingTime() << ","
+            << metrics.getAvgTurnaroundTime() << ","
+            << metrics.getAvgResponseTime() << ","
+            << metrics.getCpuUtilization() << ","
+            << metrics.getThroughput() << ","
+            << metrics.getTotalContextSwitches() << ","
+            << metrics.getTotalExecutionTime() << ","
+            << metrics.getWaitingTimePercentile(0.99) << ","
+            << metrics.getResponseTimePercentile(0.99) << "\n";
+    }
+}
+
+std::vector<int> ParameterSweep::parseList(const std::string& text) {
+    std::vector<int> values;
+    std::stringstream stream(text);
+    std::string item;
+    while (std::getline(stream, item, ',')) {
+        size_t used = 0;
+        int value = 0;
+        try {
+            value = std::stoi(item, &used);
+        } catch (const std::exception&) {
+            used = 0;
+        }
+        if (used == 0 || used != item.size()) {
+            throw std::invalid_argument("Invalid sweep value '" + item + "' in '" + text + "'");
+        }
+        values.push_back(value);
+    }
+    return values;
+}
+
+std::vector<std::vector<int>> ParameterSweep::parseQuantumSets(const std::string& text) {
+    std::vector<std::vector<int>> sets;
+    std::stringstream stream(text);
+    std::string item;
+    while (std::getline(stream, item, ',')) {
+        std::string listed = item;
+        for (char& ch : listed) {
+            if (ch == ':') {
+                ch = ',';
+            }
+        }
+        sets.push_back(parseList(listed));
+    }
+    return sets;
+}
@@ -8,98 +8,225 @@
 #include <algorithm>
 #include <limits>
 
+bool PriorityScheduler::ReadyOrder::operator()(int a, int b) const {
+    int priorityA = processes->getPriority(a);
+    int priorityB = processes->getPriority(b);
+    if (priorityA != priorityB) {
+        return priorityA < priorityB;
+    }
+    // Tie-breakers: earlier arrival time, then table order
+    int arrivalA = processes->getArrivalTime(a);
+    int arrivalB = processes->getArrivalTime(b);
+    if (arrivalA != arrivalB) {
+        return arrivalA < arrivalB;
+    }
+    return a < b;
+}
+
 PriorityScheduler::PriorityScheduler(bool preemptive, const SchedulerConfig& config)
     : Scheduler(config)
     , preemptive(preemptive)
     , agingEnabled(config.agingEnabled)
     , agingThreshold(config.agingThreshold)
+    , readyHeap(ReadyOrder{&processes})
 {
 }
 
+void PriorityScheduler::markReady(int processIdx) {
+    processes.setState(processIdx, ProcessState::READY);
+    processes.beginWait(processIdx, serviceClock);
+    readyHeap.push(processIdx);
+    
+    if (agingEnabled) {
+        // Aging is measured from the moment the process starts waiting
+        waitingSince[pidSlot(processIdx)] = currentTime;
+        events.push(currentTime + agingThreshold, SimEventType::AGING, processIdx);
+    }
+}
+
 void PriorityScheduler::applyAging() {
-    if (!agingEnabled) return;
+    SCHED_PROFILE_PHASE(RunPhase::DEADLINES);
+    // Collect due deadlines first so each process ages at most once per decision
+    dueAging.clear();
+    while (!events.empty() && events.top().time <= currentTime) {
+        dueAging.push_back(events.top());
+        events.pop();
+    }
     
-    for (size_t i = 0; i < processes.size(); ++i) {
-        Process& p = processes[i];
-        if (p.getState() == ProcessState::READY) {
-            // Check how long the process has been waiting
-            if (waitingSince.find(p.getPid()) == waitingSince.end()) {
-                waitingSince[p.getPid()] = currentTime;
-            }
-            
-            int waitingTime = currentTime - waitingSince[p.getPid()];
-            if (waitingTime >= agingThreshold) {
-                // Boost priority (decrease priority value)
-                int currentPriority = p.getPriority();
-                if (currentPriority > 0) {
-                    p.setPriority(currentPriority - 1);
-                    waitingSince[p.getPid()] = currentTime;
-                }
-            }
+    for (const SimEvent& event : dueAging) {
+        const int idx = event.processIdx;
+        int& since = waitingSince[pidSlot(idx)];
+        
+        // Skip deadlines left over from an earlier wait
+        if (processes.getState(idx) != ProcessState::READY || since == NOT_WAITING ||
+            since + agingThreshold != event.time) {
+            continue;
+        }
+        
+        // Boost priority (decrease priority value)
+        int currentPriority = processes.getPriority(idx);
+        if (currentPriority > 0) {
+            processes.setPriority(idx, currentPriority - 1);
+            readyHeap.update(event.processIdx);
+            since = currentTime;
+            events.push(currentTime + agingThreshold, SimEventType::AGING,
+                        event.processIdx);
         }
     }
 }
 
 int PriorityScheduler::findHighestPriority() {
-    int highestPriorityIdx = -1;
-    int highestPriority = std::numeric_limits<int>::max();
+    return readyHeap.empty() ? -1 : readyHeap.top();
+}
+
+bool PriorityScheduler::hasPreemptor(int runningIdx) {
+    int candidateIdx = findHighestPriority();
+    return candidateIdx != -1 && candidateIdx != runningIdx &&
+           processes.getPriority(candidateIdx) < processes.getPriority(runningIdx);
+}
+
+bool PriorityScheduler::shouldPreempt(int arrivingIdx) {
+    if (!preemptive || currentProcess == -1) {
+        return false;
+    }
     
-    for (size_t i = 0; i < processes.size(); ++i) {
-        const Process& p = processes[i];
-        if (p.getState() == ProcessState::READY && 
-            p.getArrivalTime() <= currentTime) {
-            if (p.getPriority() < highestPriority) {
-                highestPriority = p.getPriority();
-                highestPriorityIdx = static_cast<int>(i);
-            } else if (p.getPriority() == highestPriority) {
-                // Tie-breaker: choose process with earlier arrival time
-                if (highestPriorityIdx == -1 || 
-                    p.getArrivalTime() < processes[highestPriorityIdx].getArrivalTime()) {
-                    highestPriorityIdx = static_cast<int>(i);
-                }
-            }
+    return processes.getPriority(arrivingIdx) < processes.getPriority(currentProcess);
+}
+
+void PriorityScheduler::onProcessInjected(int idx) {
+    readyHeap.grow(static_cast<size_t>(idx) + 1);
+    addPidSlot(idx);
+    waitingSince.resize(pidSlotCount, NOT_WAITING);
+}
+
+bool PriorityScheduler::QueuedAfter::operator()(const QueuedProcess& a,
+                                               const QueuedProcess& b) const {
+    if (a.priority != b.priority) {
+        return a.priority > b.priority;
+    }
+    if (a.arrivalTime != b.arrivalTime) {
+        return a.arrivalTime > b.arrivalTime;
+    }
+    return a.processIdx > b.processIdx;
+}
+
+void PriorityScheduler::smpBegin(int cpuCount) {
+    cpuQueues.resize(cpuCount);
+    for (std::vector<QueuedProcess>& queue : cpuQueues) {
+        queue.clear();
+    }
+    queueEpochs.assign(processes.size(), 0);
+    waitingSince.assign(pidSlotCount, NOT_WAITING);
+}
+
+void PriorityScheduler::pushQueued(int cpu, int idx) {
+    if (static_cast<size_t>(idx) >= queueEpochs.size()) {
+        queueEpochs.resize(processes.size(), 0);
+    }
+    std::vector<QueuedProcess>& queue = cpuQueues[cpu];
+    queue.push_back({processes.getPriority(idx), processes.getArrivalTime(idx), idx,
+                     ++queueEpochs[idx]});
+    std::push_heap(queue.begin(), queue.end(), QueuedAfter());
+}
+
+void PriorityScheduler::smpEnqueue(int cpu, int idx) {
+    pushQueued(cpu, idx);
+    if (agingEnabled) {
+        waitingSince[pidSlot(idx)] = currentTime;
+        events.push(currentTime + agingThreshold, SimEventType::AGING, idx);
+    }
+}
+
+int PriorityScheduler::smpDequeue(int cpu) {
+    std::vector<QueuedProcess>& queue = cpuQueues[cpu];
+    while (!queue.empty()) {
+        std::pop_heap(queue.begin(), queue.end(), QueuedAfter());
+        const QueuedProcess entry = queue.back();
+        queue.pop_back();
+        
+        // Entries pushed before the process last aged or left the queue are stale
+        if (entry.epoch == queueEpochs[entry.processIdx]) {
+            ++queueEpochs[entry.processIdx];
+            waitingSince[pidSlot(entry.processIdx)] = NOT_WAITING;
+            return entry.processIdx;
         }
     }
-    
-    return highestPriorityIdx;
+    return -1;
 }
 
-bool PriorityScheduler::shouldPreempt(const Process& arriving) {
-    if (!preemptive || currentProcess == nullptr) {
-        return false;
+bool PriorityScheduler::smpPreempts(int idx, int running) const {
+    return preemptive && processes.getPriority(idx) < processes.getPriority(running);
+}
+
+void PriorityScheduler::smpDeadlines() {
+    // Collect due deadlines first so each process ages at most once per instant
+    dueAging.clear();
+    while (!events.empty() && events.top().time <= currentTime) {
+        dueAging.push_back(events.top());
+        events.pop();
     }
     
-    return arriving.getPriority() < currentProcess->getPriority();
+    for (const SimEvent& event : dueAging) {
+        const int idx = event.processIdx;
+        int& since = waitingSince[pidSlot(idx)];
+        
+        // Skip deadlines left over from an earlier wait
+        if (processes.getState(idx) != ProcessState::READY || since == NOT_WAITING ||
+            since + agingThreshold != event.time || processes.getPriority(idx) == 0) {
+            continue;
+        }
+        
+        // Re-queue under the boosted priority
+        const int cpu = queuedCpu[idx];
+        processes.setPriority(idx, processes.getPriority(idx) - 1);
+        pushQueued(cpu, idx);
+        since = currentTime;
+        events.push(currentTime + agingThreshold, SimEventType::AGING, idx);
+        smpPreemptFor(cpu, idx);
+    }
 }
 
 void PriorityScheduler::run() {
+    rewindArrivals();
+    if (config.numCpus > 1) {
+        runSmp();
+        return;
+    }
     currentTime = 0;
     int currentProcessIdx = -1;
-    timeline.clear();
+    // Event-driven preemptive runs split a burst at arrivals; ticking splits every unit
+    if (!preemptive) {
+        startTimeline(std::numeric_limits<int>::max());
+    } else if (config.eventDriven) {
+        startTimeline(std::numeric_limits<int>::max(), 2);
+    } else {
+        startTimeline(1);
+    }
     contextSwitches = 0;
+    serviceClock = 0;
     
-    // Reset all processes first, then set initial states
-    for (auto& p : processes) {
-        p.reset();
-        if (p.getArrivalTime() == 0) {
-            p.setState(ProcessState::READY);
-        }
-    }
+    // Reset all processes; arrivals are admitted from the arrival index
+    processes.resetAll();
+    buildPidSlots();
+    waitingSince.assign(pidSlotCount, NOT_WAITING);
+    buildArrivalIndex();
+    readyHeap.reset(processes.size());
     
-    int completedProcesses = 0;
-    int totalProcesses = static_cast<int>(processes.size());
+    // Injected arrivals grow the table as the run goes
+    size_t completedProcesses = 0;
     
-    while (completedProcesses < totalProcesses) {
+    while (completedProcesses < processes.size()) {
         // Handle new arrivals
-        for (auto& p : processes) {
-            if (p.getState() == ProcessState::NEW && 
-                p.getArrivalTime() <= currentTime) {
-                p.setState(ProcessState::READY);
+        {
+            SCHED_PROFILE_PHASE(RunPhase::ADMISSION);
+            for (int idx : takeArrivals(currentTime)) {
+                markReady(idx);
                 
                 // Check for preemption
-                if (preemptive && shouldPreempt(p)) {
+                if (preemptive && shouldPreempt(idx)) {
                     if (currentProcessIdx != -1) {
-                        processes[currentProcessIdx].setState(ProcessState::READY);
+                        timeline.back().kind = EventKind::PREEMPT;
+                        markReady(currentProcessIdx);
                         contextSwitches++;
                         currentProcessIdx = -1;
                     }
@@ -112,68 +239,72 @@ void PriorityScheduler::run() {
         
         // If no current process, find highest priority process
         if (currentProcessIdx == -1) {
+            SCHED_PROFILE_PHASE(RunPhase::SELECTION);
             currentProcessIdx = findHighestPriority();
             
             if (currentProcessIdx != -1) {
-                Process& selected = processes[currentProcessIdx];
-                selected.setState(ProcessState::RUNNING);
+                readyHeap.erase(currentProcessIdx);
+                const int selected = currentProcessIdx;
+                const int pid = processes.getPid(selected);
+                processes.setState(selected, ProcessState::RUNNING);
+                processes.endWait(selected, serviceClock);
                 
                 // Record response time on first execution
-                if (!selected.getHasStarted()) {
-                    selected.setResponseTime(currentTime - selected.getArrivalTime());
-                    selected.setHasStarted(true);
+                if (!processes.getHasStarted(selected)) {
+                    processes.setResponseTime(selected, 
+                                              currentTime - processes.getArrivalTime(selected));
+                    processes.setHasStarted(selected, true);
                 }
                 
                 // Context switch overhead
-                if (!timeline.empty() && timeline.back().processId != selected.getPid()) {
+                if (!timeline.empty() && timeline.back().processId != pid) {
                     currentTime += config.contextSwitchTime;
                 }
                 
-                waitingSince.erase(selected.getPid());
+                waitingSince[pidSlot(selected)] = NOT_WAITING;
             } else {
                 // CPU idle - no ready processes
-                currentTime++;
+                advanceIdleTime();
                 continue;
             }
         }
         
         // Execute current process
-        Process& current = processes[currentProcessIdx];
+        const int current = currentProcessIdx;
         int executionStart = currentTime;
         
-        // In non-preemptive mode, execute until completion
-        int executionTime = preemptive ? 1 : current.getRemainingTime();
-        int actualTime = current.execute(executionTime);
+        // In non-preemptive mode, execute until completion. In preemptive mode
+        // the decision is revisited after one tick if a higher priority process
+        // is already waiting, otherwise at the next arrival or aging deadline.
+        int executionTime = processes.getRemainingTime(current);
+        if (preemptive) {
+            executionTime = hasPreemptor(current) ? 1 :
+                            eventSlice(executionStart, processes.getRemainingTime(current));
+        }
+        int actualTime = processes.execute(current, executionTime);
         currentTime += actualTime;
         
         // Record execution event
-        timeline.push_back({current.getPid(), executionStart, currentTime});
+        recordEvent(processes.getPid(current), executionStart, currentTime);
         
-        // Update waiting time for other ready processes
-        for (auto& p : processes) {
-            if (p.getState() == ProcessState::READY && 
-                p.getArrivalTime() <= currentTime) {
-                p.setWaitingTime(p.getWaitingTime() + actualTime);
-            }
-        }
+        // Ready processes accrue this slice as waiting time
+        serviceClock += actualTime;
         
         // Check if process completed
-        if (current.getRemainingTime() == 0) {
-            current.setState(ProcessState::TERMINATED);
-            current.setCompletionTime(currentTime);
-            current.setTurnaroundTime(currentTime - current.getArrivalTime());
+        if (processes.getRemainingTime(current) == 0) {
+            processes.setState(current, ProcessState::TERMINATED);
+            processes.setCompletionTime(current, currentTime);
+            processes.setTurnaroundTime(current, currentTime - processes.getArrivalTime(current));
+            recordCompletion(current);
             completedProcesses++;
             currentProcessIdx = -1;
         } else if (preemptive) {
             // Check if a higher priority process has arrived
-            int higherPriorityIdx = findHighestPriority();
-            if (higherPriorityIdx != -1 && higherPriorityIdx != currentProcessIdx) {
-                const Process& higherPriority = processes[higherPriorityIdx];
-                if (higherPriority.getPriority() < current.getPriority()) {
-                    current.setState(ProcessState::READY);
-                    contextSwitches++;
-                    currentProcessIdx = -1;
-                }
+            if (hasPreemptor(currentProcessIdx)) {
+                timeline.back().kind = EventKind::PREEMPT;
+                markReady(currentProcessIdx);
+                contextSwitches++;
+                currentProcessIdx = -1;
             }
         }
     }
@@ -182,9 +313,8 @@ void PriorityScheduler::run() {
     calculateMetrics();
 }
 
-Process* PriorityScheduler::getNextProcess() {
-    int idx = findHighestPriority();
-    return (idx != -1) ? &processes[idx] : nullptr;
+int PriorityScheduler::getNextProcess() {
+    return findHighestPriority();
 }
 
 std::string PriorityScheduler::getName() const {
@@ -199,4 +329,5 @@ SchedulerType PriorityScheduler::getType() const {
 void PriorityScheduler::reset() {
     Scheduler::reset();
     waitingSince.clear();
+    readyHeap.reset(0);
 }
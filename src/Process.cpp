@@ -66,6 +66,23 @@ int Process::execute(int timeSlice) {
     return executedTime;
 }
 
+bool Process::addIoBurst(int after, int length) {
+    const int earliest = ioBursts.empty() ? 1 : ioBursts.back().after + 1;
+    if (after < earliest || after >= burstTime || length < 1) {
+        return false;
+    }
+    ioBursts.push_back({after, length});
+    return true;
+}
+
+int Process::getIoTime() const {
+    int total = 0;
+    for (const IoBurst& burst : ioBursts) {
+        total += burst.length;
+    }
+    return total;
+}
+
 void Process::reset() {
     remainingTime = burstTime;
     waitingTime = 0;
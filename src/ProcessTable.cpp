@@ -0,0 +1,324 @@
+/**
+ * @file ProcessTable.cpp
+ * @brief Implementation of the structure-of-arrays process table
+ * @version 1.0
+ */
+
+#include "ProcessTable.h"
+#include <algorithm>
+
+void ProcessTable::add(const Process& process) {
+    pids.push_back(process.getPid());
+    priorities.push_back(process.getPriority());
+    burstTimes.push_back(process.getBurstTime());
+    remainingTimes.push_back(process.getRemainingTime());
+    arrivalTimes.push_back(process.getArrivalTime());
+    waitingTimes.push_back(process.getWaitingTime());
+    turnaroundTimes.push_back(process.getTurnaroundTime());
+    responseTimes.push_back(process.getResponseTime());
+    completionTimes.push_back(process.getCompletionTime());
+    queueLevels.push_back(process.getQueueLevel());
+    waitStarts.push_back(0);
+    started.push_back(process.getHasStarted() ? 1 : 0);
+    states.push_back(process.getState());
+
+    nameIds.push_back(internName(process.getName()));
+    if (!ioFirst.empty()) {
+        ioFirst.push_back(0);
+        ioCounts.push_back(0);
+        ioNext.push_back(0);
+        ioTimes.push_back(0);
+    }
+    for (const IoBurst& burst : process.getIoBursts()) {
+        addIoBurst(pids.size() - 1, burst.after, burst.length);
+    }
+}
+
+void ProcessTable::add(int pid, int priority, int burstTime, int arrivalTime,
+                       const std::string& name) {
+    addColumns(&pid, &priority, &burstTime, &arrivalTime, 1);
+    if (!name.empty()) {
+        nameIds.back() = internName(name);
+    }
+}
+
+void ProcessTable::addColumns(const int* pidColumn, const int* priorityColumn,
+                              const int* burstColumn, const int* arrivalColumn, size_t count) {
+    pids.insert(pids.end(), pidColumn, pidColumn + count);
+    priorities.insert(priorities.end(), priorityColumn, priorityColumn + count);
+    burstTimes.insert(burstTimes.end(), burstColumn, burstColumn + count);
+    remainingTimes.insert(remainingTimes.end(), burstColumn, burstColumn + count);
+    arrivalTimes.insert(arrivalTimes.end(), arrivalColumn, arrivalColumn + count);
+
+    const size_t rows = pids.size();
+    waitingTimes.resize(rows, 0);
+    turnaroundTimes.resize(rows, 0);
+    responseTimes.resize(rows, -1);
+    completionTimes.resize(rows, 0);
+    queueLevels.resize(rows, 0);
+    waitStarts.resize(rows, 0);
+    started.resize(rows, 0);
+    states.resize(rows, ProcessState::NEW);
+    nameIds.resize(rows, DEFAULT_NAME);
+    if (!ioFirst.empty()) {
+        ioFirst.resize(rows, 0);
+        ioCounts.resize(rows, 0);
+        ioNext.resize(rows, 0);
+        ioTimes.resize(rows, 0);
+    }
+}
+
+bool ProcessTable::addIoBurst(size_t i, int after, int length) {
+    if (ioFirst.empty()) {
+        ioFirst.assign(size(), 0);
+        ioCounts.assign(size(), 0);
+        ioNext.assign(size(), 0);
+        ioTimes.assign(size(), 0);
+    }
+    const int count = ioCounts[i];
+    const int earliest = count == 0 ? 1 : ioBursts[ioFirst[i] + count - 1].after + 1;
+    if (after < earliest || after >= burstTimes[i] || length < 1) {
+        return false;
+    }
+    if (count == 0) {
+        ioFirst[i] = static_cast<int>(ioBursts.size());
+    } else if (static_cast<size_t>(ioFirst[i] + count) != ioBursts.size()) {
+        const int first = ioFirst[i];
+        ioFirst[i] = static_cast<int>(ioBursts.size());
+        for (int k = 0; k < count; ++k) {
+            ioBursts.push_back(ioBursts[first + k]);
+        }
+    }
+    ioBursts.push_back({after, length});
+    ioCounts[i]++;
+    ioTimes[i] += length;
+    return true;
+}
+
+int ProcessTable::internName(const std::string& name) {
+    auto it = nameIndex.find(name);
+    if (it == nameIndex.end()) {
+        it = nameIndex.emplace(name, static_cast<int>(names.size())).first;
+        names.push_back(name);
+    }
+    return it->second;
+}
+
+void ProcessTable::clear() {
+    pids.clear();
+    priorities.clear();
+    burstTimes.clear();
+    remainingTimes.clear();
+    arrivalTimes.clear();
+    waitingTimes.clear();
+    turnaroundTimes.clear();
+    responseTimes.clear();
+    completionTimes.clear();
+    queueLevels.clear();
+    waitStarts.clear();
+    started.clear();
+    states.clear();
+    nameIds.clear();
+    names.clear();
+    nameIndex.clear();
+    ioFirst.clear();
+    ioCounts.clear();
+    ioNext.clear();
+    ioTimes.clear();
+    ioBursts.clear();
+}
+
+void ProcessTable::truncate(size_t count) {
+    if (count >= pids.size()) {
+        return;
+    }
+    pids.resize(count);
+    priorities.resize(count);
+    burstTimes.resize(count);
+    remainingTimes.resize(count);
+    arrivalTimes.resize(count);
+    waitingTimes.resize(count);
+    turnaroundTimes.resize(count);
+    responseTimes.resize(count);
+    completionTimes.resize(count);
+    queueLevels.resize(count);
+    waitStarts.resize(count);
+    started.resize(count);
+    states.resize(count);
+    nameIds.resize(count);
+    if (!ioFirst.empty()) {
+        ioFirst.resize(count);
+        ioCounts.resize(count);
+        ioNext.resize(count);
+        ioTimes.resize(count);
+    }
+}
+
+void ProcessTable::reserve(size_t count) {
+    pids.reserve(count);
+    priorities.reserve(count);
+    burstTimes.reserve(count);
+    remainingTimes.reserve(count);
+    arrivalTimes.reserve(count);
+    waitingTimes.reserve(count);
+    turnaroundTimes.reserve(count);
+    responseTimes.reserve(count);
+    completionTimes.reserve(count);
+    queueLevels.reserve(count);
+    waitStarts.reserve(count);
+    started.reserve(count);
+    states.reserve(count);
+    nameIds.reserve(count);
+}
+
+Process ProcessTable::getProcess(size_t i) const {
+    Process process(pids[i], priorities[i], burstTimes[i], arrivalTimes[i], getName(i));
+    process.setRemainingTime(remainingTimes[i]);
+    process.setWaitingTime(waitingTimes[i]);
+    process.setTurnaroundTime(turnaroundTimes[i]);
+    process.setResponseTime(responseTimes[i]);
+    process.setCompletionTime(completionTimes[i]);
+    process.setQueueLevel(queueLevels[i]);
+    process.setHasStarted(started[i] != 0);
+    process.setState(states[i]);
+    for (size_t k = 0; k < getIoBurstCount(i); ++k) {
+        process.addIoBurst(getIoBurst(i, k).after, getIoBurst(i, k).length);
+    }
+    return process;
+}
+
+std::vector<Process> ProcessTable::toProcesses() const {
+    std::vector<Process> result;
+    result.reserve(size());
+    for (size_t i = 0; i < size(); ++i) {
+        result.push_back(getProcess(i));
+    }
+    return result;
+}
+
+int ProcessTable::execute(size_t i, int timeSlice) {
+    if (remainingTimes[i] == 0) {
+        return 0;
+    }
+
+    started[i] = 1;
+    int executedTime = std::min(timeSlice, remainingTimes[i]);
+    remainingTimes[i] -= executedTime;
+    states[i] = (remainingTimes[i] == 0) ? ProcessState::TERMINATED : ProcessState::RUNNING;
+    return executedTime;
+}
+
+void ProcessTable::resetProcess(size_t i) {
+    remainingTimes[i] = burstTimes[i];
+    waitingTimes[i] = 0;
+    turnaroundTimes[i] = 0;
+    responseTimes[i] = -1;
+    completionTimes[i] = 0;
+    queueLevels[i] = 0;
+    waitStarts[i] = 0;
+    started[i] = 0;
+    states[i] = ProcessState::NEW;
+    if (!ioNext.empty()) {
+        ioNext[i] = 0;
+    }
+}
+
+void ProcessTable::resetAll() {
+    remainingTimes = burstTimes;
+    std::fill(waitingTimes.begin(), waitingTimes.end(), 0);
+    std::fill(turnaroundTimes.begin(), turnaroundTimes.end(), 0);
+    std::fill(responseTimes.begin(), responseTimes.end(), -1);
+    std::fill(completionTimes.begin(), completionTimes.end(), 0);
+    std::fill(queueLevels.begin(), queueLevels.end(), 0);
+    std::fill(waitStarts.begin(), waitStarts.end(), 0);
+    std::fill(started.begin(), started.end(), 0);
+    std::fill(states.begin(), states.end(), ProcessState::NEW);
+    std::fill(ioNext.begin(), ioNext.end(), 0);
+}
+
+size_t ProcessTable::countUnfinished() const {
+    size_t count = 0;
+    for (ProcessState state : states) {
+        count += (state != ProcessState::TERMINATED);
+    }
+    return count;
+}
+
+void ProcessTable::sortByArrival() {
+    sortOrder.resize(size());
+    for (size_t i = 0; i < sortOrder.size(); ++i) {
+        sortOrder[i] = static_cast<int>(i);
+    }
+    std::sort(sortOrder.begin(), sortOrder.end(), [this](int a, int b) {
+        return arrivalTimes[a] < arrivalTimes[b];
+    });
+
+    // Row i takes the old row sortOrder[i]; following each cycle of the
+    // permutation moves a column in place, with one saved value per cycle
+    auto permute = [this](auto& column) {
+        sortPlaced.assign(sortOrder.size(), 0);
+        for (size_t start = 0; start < sortOrder.size(); ++start) {
+            if (sortPlaced[start]) {
+                continue;
+            }
+            auto saved = column[start];
+            size_t i = start;
+            while (true) {
+                sortPlaced[i] = 1;
+                const size_t from = static_cast<size_t>(sortOrder[i]);
+                if (from == start) {
+                    column[i] = saved;
+                    break;
+                }
+                column[i] = column[from];
+                i = from;
+            }
+        }
+    };
+    permute(pids);
+    permute(priorities);
+    permute(burstTimes);
+    permute(remainingTimes);
+    permute(arrivalTimes);
+    permute(waitingTimes);
+    permute(turnaroundTimes);
+    permute(responseTimes);
+    permute(completionTimes);
+    permute(queueLevels);
+    permute(waitStarts);
+    permute(started);
+    permute(states);
+    permute(nameIds);
+    if (!ioFirst.empty()) {
+        permute(ioFirst);
+        permute(ioCounts);
+        permute(ioNext);
+        permute(ioTimes);
+    }
+}
+
+void ProcessTable::loadFrom(const ProcessTable& source) {
+    pids = source.pids;
+    priorities = source.priorities;
+    burstTimes = source.burstTimes;
+    remainingTimes = source.remainingTimes;
+    arrivalTimes = source.arrivalTimes;
+    waitingTimes = source.waitingTimes;
+    turnaroundTimes = source.turnaroundTimes;
+    responseTimes = source.responseTimes;
+    completionTimes = source.completionTimes;
+    queueLevels = source.queueLevels;
+    waitStarts = source.waitStarts;
+    started = source.started;
+    states = source.states;
+    nameIds = source.nameIds;
+    if (names != source.names) {
+        names = source.names;
+        nameIndex = source.nameIndex;
+    }
+    ioFirst = source.ioFirst;
+    ioCounts = source.ioCounts;
+    ioNext = source.ioNext;
+    ioTimes = source.ioTimes;
+    ioBursts = source.ioBursts;
+}
@@ -0,0 +1,195 @@
+/**
+ * @file ReplicaRunner.cpp
+ * @brief Implementation of the Monte Carlo replica runner
+ * @version 1.0
+ */
+
+#include "ReplicaRunner.h"
+#include "Simulator.h"
+#include "ThreadPool.h"
+#include <algorithm>
+#include <cmath>
+#include <future>
+#include <memory>
+#include <iomanip>
+#include <sstream>
+#include <stdexcept>
+
+ReplicaRunner::ReplicaRunner(const WorkloadSpec& spec, const SchedulerConfig& config,
+                             const ReplicaOptions& options)
+    : spec(spec)
+    , config(config)
+    , options(options)
+{
+    WorkloadGenerator check(spec);
+    if (options.minReplicas < 2) {
+        throw std::invalid_argument("Replica runs need at least two replicas for an interval");
+    }
+    if (options.maxReplicas < options.minReplicas || options.batchSize < 1) {
+        throw std::invalid_argument("Replica limits out of range");
+    }
+    if (!(options.confidence > 0.0 && options.confidence < 1.0)) {
+        throw std::invalid_argument("Confidence level must lie in (0, 1)");
+    }
+    if (!(options.targetPrecision >= 0.0)) {
+        throw std::invalid_argument("Replica precision target must not be negative");
+    }
+    // Only the pooled aggregates are reported, so keep memory flat
+    this->config.keepTimeline = false;
+    this->config.keepProcessMetrics = false;
+    // Only the policy engine blocks processes on I/O bursts
+    if (spec.ioShare > 0.0) {
+        this->config.policyEngine = true;
+    }
+}
+
+std::vector<SchedulerType> ReplicaRunner::getAlgorithms() const {
+    if (!options.algorithms.empty()) {
+        return options.algorithms;
+    }
+    return Simulator::defaultAlgorithms();
+}
+
+bool ReplicaRunner::isConverged(const ReplicaResult& result) const {
+    if (options.targetPrecision <= 0.0 || result.replicas < options.minReplicas) {
+        return false;
+    }
+    for (const SampleStats* stats : {&result.waiting, &result.turnaround, &result.response}) {
+        if (stats->halfWidth(options.confidence) >
+            options.targetPrecision * std::fabs(stats->getMean())) {
+            return false;
+        }
+    }
+    return true;
+}
+
+std::vector<ReplicaResult> ReplicaRunner::run(std::ostream* progress) const {
+    const std::vector<SchedulerType> algorithms = getAlgorithms();
+    std::vector<ReplicaResult> results(algorithms.size());
+    for (size_t a = 0; a < algorithms.size(); ++a) {
+        results[a].algorithm = algorithms[a];
+    }
+
+    ThreadPool pool(options.workerThreads > 0 ?
+                    static_cast<size_t>(options.workerThreads) : 0);
+    int done = 0;
+    while (done < options.maxReplicas) {
+        std::vector<size_t> active;
+        for (size_t a = 0; a < results.size(); ++a) {
+            if (!results[a].converged) {
+                active.push_back(a);
+            }
+        }
+        if (active.empty()) {
+            break;
+        }
+        const int round = std::min(done == 0 ? options.minReplicas : options.batchSize,
+                                   options.maxReplicas - done);
+
+        // One task per replica: generate its workload once, run every active
+        // algorithm on it, and fill that replica's slots
+        std::vector<Metrics> slots(static_cast<size_t>(round) * active.size());
+        std::vector<std::string> names(active.size());
+        std::vector<std::future<void>> pending;
+        pending.reserve(static_cast<size_t>(round));
+        for (int r = 0; r < round; ++r) {
+            pending.push_back(pool.submit([&, r]() {
+                WorkloadSpec replica = spec;
+                replica.seed = spec.seed + static_cast<std::uint64_t>(done + r);
+                replica.threads = 1;
+                const std::shared_ptr<const Workload> workload =
+                    std::make_shared<const Workload>(WorkloadGenerator(replica).generate());
+                for (size_t i = 0; i < active.size(); ++i) {
+                    std::unique_ptr<Scheduler> scheduler =
+                        Simulator::createScheduler(algorithms[active[i]], config);
+                    scheduler->setWorkload(workload);
+                    scheduler->run();
+                    slots[static_cast<size_t>(r) * active.size() + i] = scheduler->takeMetrics();
+                    if (r == 0) {
+                        names[i] = scheduler->getName();
+                    }
+                }
+            }));
+        }
+        for (auto& task : pending) {
+            task.get();
+        }
+
+        // Fold in replica order, so the sums do not depend on thread timing
+        for (size_t i = 0; i < active.size(); ++i) {
+            ReplicaResult& result = results[active[i]];
+            result.schedulerName = names[i];
+            for (int r = 0; r < round; ++r) {
+                const Metrics& metrics = slots[static_cast<size_t>(r) * active.size() + i];
+                result.waiting.add(metrics.getAvgWaitingTime());
+                result.turnaround.add(metrics.getAvgTurnaroundTime());
+                result.response.add(metrics.getAvgResponseTime());
+                result.utilization.add(metrics.getCpuUtilization());
+                result.throughput.add(metrics.getThroughput());
+                if (result.replicas == 0) {
+                    result.pooled = metrics;
+                } else {
+                    result.pooled.merge(metrics);
+                }
+                result.replicas++;
+            }
+            result.converged = isConverged(result);
+        }
+        done += round;
+
+        if (progress) {
+            size_t converged = static_cast<size_t>(std::count_if(
+                results.begin(), results.end(),
+                [](const ReplicaResult& result) { return result.converged; }));
+            *progress << "  " << std::setw(5) << done << " replicas, " << converged << "/"
+                      << results.size() << " algorithms converged\n" << std::flush;
+        }
+    }
+    return results;
+}
+
+void ReplicaRunner::printSummary(std::ostream& out,
+                                 const std::vector<ReplicaResult>& results) const {
+    out << "\nMeans of per-replica averages, +/- the " << std::fixed << std::setprecision(0)
+        << options.confidence * 100 << "% confidence half-width:\n";
+    out << std::left << std::setw(32) << "Algorithm" << std::right << std::setw(9) << "Replicas"
+        << std::setw(20) << "Waiting" << std::setw(20) << "Turnaround"
+        << std::setw(20) << "Response" << "\n";
+    for (const ReplicaResult& result : results) {
+        out << std::left << std::setw(32) << result.schedulerName.substr(0, 32) << std::right
+            << std::setw(8) << result.replicas << (result.converged ? " " : "*");
+        for (const SampleStats* stats : {&result.waiting, &result.turnaround, &result.response}) {
+            std::ostringstream cell;
+            cell << std::fixed << std::setprecision(2) << stats->getMean() << " +/- "
+                 << stats->halfWidth(options.confidence);
+            out << std::setw(20) << cell.str();
+        }
+        out << "\n";
+    }
+    if (std::any_of(results.begin(), results.end(),
+                    [](const ReplicaResult& result) { return !result.converged; })) {
+        out << "* stopped at the replica limit before reaching the precision target\n";
+    }
+    out << std::defaultfloat;
+}
+
+void ReplicaRunner::writeTable(std::ostream& out,
+                               const std::vector<ReplicaResult>& results) const {
+    out << "Algorithm,Replicas,Converged,Confidence,"
+        << "AvgWaitTime,AvgWaitTimeCI,AvgTurnaroundTime,AvgTurnaroundTimeCI,"
+        << "AvgResponseTime,AvgResponseTimeCI,CPUUtilization,CPUUtilizationCI,"
+        << "Throughput,ThroughputCI,PooledAvgWaitTime,PooledP99WaitTime\n";
+
+    for (const ReplicaResult& result : results) {
+        out << result.schedulerName << ","
+            << result.replicas << ","
+            << (result.converged ? "yes" : "no") << ","
+            << options.confidence;
+        for (const SampleStats* stats : {&result.waiting, &result.turnaround, &result.response,
+                                         &result.utilization, &result.throughput}) {
+            out << "," << stats->getMean() << "," << stats->halfWidth(options.confidence);
+        }
+        out << "," << result.pooled.getAvgWaitingTime()
+            << "," << result.pooled.getWaitingTimePercentile(0.99) << "\n";
+    }
+}
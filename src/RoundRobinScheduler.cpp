@@ -15,86 +15,88 @@ RoundRobinScheduler::RoundRobinScheduler(int quantum, const SchedulerConfig& con
 {}
 
 bool RoundRobinScheduler::hasWaitingProcesses() const {
-    for (const auto& process : processes) {
-        if (process.getState() != ProcessState::TERMINATED) {
-            return true;
+    return processes.countUnfinished() > 0;
+}
+
+void RoundRobinScheduler::enqueue(int processIdx) {
+    if (!enqueued[processIdx]) {
+        enqueued[processIdx] = 1;
+        processQueue.push(processIdx);
+    }
+}
+
+void RoundRobinScheduler::enqueueArrivals(int time) {
+    SCHED_PROFILE_PHASE(RunPhase::ADMISSION);
+    for (int idx : admitArrivals(time)) {
+        if (processes.getState(idx) == ProcessState::READY) {
+            enqueue(idx);
         }
     }
-    return false;
+}
+
+void RoundRobinScheduler::onProcessInjected(int idx) {
+    (void)idx;
+    enqueued.push_back(0);
+}
+
+void RoundRobinScheduler::smpBegin(int cpuCount) {
+    cpuQueues.resize(cpuCount);
+    for (RingQueue& queue : cpuQueues) {
+        queue.clear();
+    }
+}
+
+int RoundRobinScheduler::smpDequeue(int cpu) {
+    return cpuQueues[cpu].empty() ? -1 : cpuQueues[cpu].pop();
+}
+
+int RoundRobinScheduler::smpSliceLength(int idx) const {
+    return std::min(timeQuantum, processes.getRemainingTime(idx));
 }
 
 void RoundRobinScheduler::run() {
-    if (processes.empty()) {
+    rewindArrivals();
+    if (processes.empty() && arrivalSource == nullptr) {
+        return;
+    }
+    if (config.numCpus > 1) {
+        runSmp();
         return;
     }
     
     // Initialize runtime state
     currentTime = 0;
     contextSwitches = 0;
-    timeline.clear();
+    startTimeline(timeQuantum, 2);
     readyQueue.clear();
-    while (!processQueue.empty()) {
-        processQueue.pop();
-    }
+    processQueue.clear();
+    processQueue.reserve(processes.size());
+    enqueued.assign(processes.size(), 0);
     isRunning = true;
     
     // Reset all processes to initial state
-    for (auto& p : processes) {
-        p.reset();
-    }
+    processes.resetAll();
     
     // Sort processes by arrival time
-    std::sort(processes.begin(), processes.end(),
-              [](const Process& a, const Process& b) {
-                  return a.getArrivalTime() < b.getArrivalTime();
-              });
+    processes.sortByArrival();
     
-    // Initialize: check arrivals at time 0
-    checkArrivals(0);
+    // Initialize: processes arriving at time 0 form the initial queue
+    buildArrivalIndex();
+    enqueueArrivals(0);
     
-    // Build initial queue from ready processes
-    for (size_t i = 0; i < readyQueue.size(); ++i) {
-        processQueue.push(static_cast<int>(i));
-    }
-    
-    Process* lastProcess = nullptr;
+    int lastProcess = -1;
+    size_t completed = 0;
     
-    while (!isComplete()) {
-        // Check for new arrivals
-        checkArrivals(currentTime);
-        
+    while (completed < processes.size()) {
         // Add newly arrived processes to the circular queue
-        for (size_t i = 0; i < processes.size(); ++i) {
-            bool inQueue = false;
-            std::queue<int> tempQueue = processQueue;
-            while (!tempQueue.empty()) {
-                if (tempQueue.front() == static_cast<int>(i)) {
-                    inQueue = true;
-                    break;
-                }
-                tempQueue.pop();
-            }
-            
-            if (!inQueue && 
-                processes[i].getState() == ProcessState::READY &&
-                processes[i].getArrivalTime() <= currentTime &&
-                !processes[i].isCompleted()) {
-                processQueue.push(static_cast<int>(i));
-            }
-        }
+        enqueueArrivals(currentTime);
         
         if (processQueue.empty()) {
             // CPU idle - advance time to next arrival
-            int nextArrival = INT_MAX;
-            for (const auto& p : processes) {
-                if (p.getArrivalTime() > currentTime && 
-                    p.getState() != ProcessState::TERMINATED) {
-                    nextArrival = std::min(nextArrival, p.getArrivalTime());
-                }
-            }
+            int nextArrival = nextArrivalTime();
             
             if (nextArrival != INT_MAX) {
-                recordEvent(-1, currentTime, nextArrival, false, "CPU Idle");
+                recordEvent(-1, currentTime, nextArrival, EventKind::IDLE);
                 currentTime = nextArrival;
             } else {
                 break;
@@ -103,82 +105,66 @@ void RoundRobinScheduler::run() {
         }
         
         // Get next process from queue
-        int processIdx = processQueue.front();
-        processQueue.pop();
-        
-        Process& currentProc = processes[processIdx];
+        int processIdx;
+        {
+            SCHED_PROFILE_PHASE(RunPhase::SELECTION);
+            processIdx = processQueue.pop();
+            enqueued[processIdx] = 0;
+        }
         
         // Skip if already completed
-        if (currentProc.isCompleted()) {
+        if (processes.isCompleted(processIdx)) {
             continue;
         }
         
         // Context switch if different process
-        if (lastProcess != nullptr && lastProcess->getPid() != currentProc.getPid()) {
-            performContextSwitch(lastProcess, &currentProc);
+        if (lastProcess != -1 && 
+            processes.getPid(lastProcess) != processes.getPid(processIdx)) {
+            performContextSwitch(lastProcess, processIdx);
         }
         
         // Set response time if first execution
-        if (!currentProc.getHasStarted()) {
-            currentProc.setResponseTime(currentTime - currentProc.getArrivalTime());
-            currentProc.setHasStarted(true);
+        if (!processes.getHasStarted(processIdx)) {
+            processes.setResponseTime(processIdx, 
+                                      currentTime - processes.getArrivalTime(processIdx));
+            processes.setHasStarted(processIdx, true);
         }
         
-        currentProc.setState(ProcessState::RUNNING);
+        processes.setState(processIdx, ProcessState::RUNNING);
         
         // Execute for time quantum or remaining time, whichever is smaller
-        int executeTime = std::min(timeQuantum, currentProc.getRemainingTime());
+        int executeTime = std::min(timeQuantum, processes.getRemainingTime(processIdx));
         int startTime = currentTime;
         
         // Execute the process
-        currentProc.execute(executeTime);
+        processes.execute(processIdx, executeTime);
         currentTime += executeTime;
         
         // Record execution event
-        recordEvent(currentProc.getPid(), startTime, currentTime, false, 
-                    "Execute P" + std::to_string(currentProc.getPid()));
-        
-        // Check for new arrivals during execution
-        for (int t = startTime + 1; t <= currentTime; ++t) {
-            checkArrivals(t);
-        }
+        recordEvent(processes.getPid(processIdx), startTime, currentTime);
         
-        // Add newly arrived processes to queue (they should go after current process if it continues)
-        for (size_t i = 0; i < processes.size(); ++i) {
-            if (static_cast<int>(i) != processIdx) {
-                bool inQueue = false;
-                std::queue<int> tempQueue = processQueue;
-                while (!tempQueue.empty()) {
-                    if (tempQueue.front() == static_cast<int>(i)) {
-                        inQueue = true;
-                        break;
-                    }
-                    tempQueue.pop();
-                }
-                
-                if (!inQueue && 
-                    processes[i].getState() == ProcessState::READY &&
-                    processes[i].getArrivalTime() <= currentTime &&
-                    !processes[i].isCompleted()) {
-                    processQueue.push(static_cast<int>(i));
-                }
-            }
-        }
+        // Arrivals during the context switch and execution go ahead of
+        // the current process if it continues
+        enqueueArrivals(currentTime);
         
         // Handle process completion or preemption
-        if (currentProc.isCompleted()) {
-            currentProc.setState(ProcessState::TERMINATED);
-            currentProc.setCompletionTime(currentTime);
-            currentProc.setTurnaroundTime(currentTime - currentProc.getArrivalTime());
-            currentProc.setWaitingTime(currentProc.getTurnaroundTime() - 
-                                       currentProc.getBurstTime());
+        if (processes.isCompleted(processIdx)) {
+            int turnaround = currentTime - processes.getArrivalTime(processIdx);
+            processes.setState(processIdx, ProcessState::TERMINATED);
+            processes.setCompletionTime(processIdx, currentTime);
+            processes.setTurnaroundTime(processIdx, turnaround);
+            processes.setWaitingTime(processIdx, 
+                                     turnaround - processes.getBurstTime(processIdx));
+            recordCompletion(processIdx);
+            completed++;
         } else {
             // Preempted - add back to queue
-            currentProc.setState(ProcessState::READY);
-            processQueue.push(processIdx);
+            timeline.back().kind = EventKind::PREEMPT;
+            processes.setState(processIdx, ProcessState::READY);
+            enqueue(processIdx);
         }
         
-        lastProcess = &currentProc;
+        lastProcess = processIdx;
     }
     
     // Calculate final metrics
@@ -186,20 +172,15 @@ void RoundRobinScheduler::run() {
     isRunning = false;
 }
 
-Process* RoundRobinScheduler::getNextProcess() {
-    if (processQueue.empty()) {
-        return nullptr;
-    }
-    
-    int idx = processQueue.front();
-    return &processes[idx];
+int RoundRobinScheduler::getNextProcess() {
+    return processQueue.empty() ? -1 : processQueue.front();
 }
 
 void RoundRobinScheduler::reset() {
     Scheduler::reset();
     
     // Clear the process queue
-    while (!processQueue.empty()) {
-        processQueue.pop();
-    }
+    processQueue.clear();
+    enqueued.clear();
+    cpuQueues.clear();
 }
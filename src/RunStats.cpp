@@ -0,0 +1,53 @@
+/**
+ * @file RunStats.cpp
+ * @brief Implementation of the profiling counters
+ * @version 1.0
+ */
+
+#include "RunStats.h"
+#include <algorithm>
+
+void RunStats::merge(const RunStats& other) {
+    for (size_t p = 0; p < RUN_PHASE_COUNT; ++p) {
+        phases[p].calls += other.phases[p].calls;
+        phases[p].nanoseconds += other.phases[p].nanoseconds;
+    }
+    events += other.events;
+    runNanoseconds += other.runNanoseconds;
+    peakRunnable = std::max(peakRunnable, other.peakRunnable);
+    peakDeadlines = std::max(peakDeadlines, other.peakDeadlines);
+    runs += other.runs;
+}
+
+std::uint64_t RunStats::phaseNanoseconds() const {
+    std::uint64_t total = 0;
+    for (const PhaseCounter& phase : phases) {
+        total += phase.nanoseconds;
+    }
+    return total;
+}
+
+double RunStats::eventsPerSecond() const {
+    return runNanoseconds > 0 ? events / (runNanoseconds / 1e9) : 0.0;
+}
+
+double RunStats::share(RunPhase phase) const {
+    return runNanoseconds > 0 ?
+        static_cast<double>(counter(phase).nanoseconds) / runNanoseconds : 0.0;
+}
+
+const char* RunStats::phaseName(RunPhase phase) {
+    switch (phase) {
+        case RunPhase::ADMISSION:
+            return "admission";
+        case RunPhase::SELECTION:
+            return "selection";
+        case RunPhase::DEADLINES:
+            return "deadlines";
+        case RunPhase::TIMELINE:
+            return "timeline";
+        case RunPhase::METRICS:
+            return "metrics";
+    }
+    return "unknown";
+}
@@ -5,24 +5,194 @@
  */
 
 #include "Scheduler.h"
+#include "ArrivalSource.h"
+#include "SchedulerSnapshot.h"
+#include "TraceSink.h"
 #include <algorithm>
 #include <iostream>
 #include <iomanip>
+#include <climits>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
 
 Scheduler::Scheduler(const SchedulerConfig& config)
     : config(config)
     , currentTime(0)
     , contextSwitches(0)
-    , currentProcess(nullptr)
+    , serviceClock(0)
+    , currentProcess(-1)
     , isRunning(false)
+    , arrivalCursor(0)
+    , sink(nullptr)
+    , idleTime(0)
+    , lastExecutionEnd(0)
+    , arrivalSource(nullptr)
+    , arrivalHorizon(INT_MAX)
+    , injectedCount(0)
+    , lastInjectedArrival(0)
+    , sourceDrained(true)
+    , pidSlotCount(0)
+    , runPool(&runArena)
+    , sliceEnds(SliceEndOrder{&cpus})
+    , leastLoaded(LeastLoadedOrder{&cpus})
+    , longestQueue(LongestQueueOrder{&cpus})
+    , queuedTotal(0)
+    , switchTime(0)
+    , migrations(0)
 {}
 
+bool Scheduler::SliceEndOrder::operator()(int a, int b) const {
+    const int endA = (*cpus)[a].sliceEnd;
+    const int endB = (*cpus)[b].sliceEnd;
+    return endA != endB ? endA < endB : a < b;
+}
+
+bool Scheduler::LeastLoadedOrder::operator()(int a, int b) const {
+    const int loadA = (*cpus)[a].queued + ((*cpus)[a].running != -1);
+    const int loadB = (*cpus)[b].queued + ((*cpus)[b].running != -1);
+    return loadA != loadB ? loadA < loadB : a < b;
+}
+
+bool Scheduler::LongestQueueOrder::operator()(int a, int b) const {
+    const int queuedA = (*cpus)[a].queued;
+    const int queuedB = (*cpus)[b].queued;
+    return queuedA != queuedB ? queuedA > queuedB : a < b;
+}
+
 void Scheduler::addProcess(const Process& process) {
-    processes.push_back(process);
+    // Injected rows must stay at the end of the table
+    processes.truncate(processes.size() - injectedCount);
+    injectedCount = 0;
+    workload.reset();
+    processes.add(process);
 }
 
 void Scheduler::clearProcesses() {
     processes.clear();
+    injectedCount = 0;
+    workload.reset();
+}
+
+void Scheduler::setWorkload(std::shared_ptr<const Workload> shared) {
+    workload = std::move(shared);
+    injectedCount = 0;
+    if (workload) {
+        processes.loadFrom(workload->getTable());
+    }
+}
+
+void Scheduler::reloadProcesses() {
+    if (workload) {
+        processes.loadFrom(workload->getTable());
+    } else {
+        processes.truncate(processes.size() - injectedCount);
+    }
+    injectedCount = 0;
+}
+
+void Scheduler::buildPidSlots() {
+    const size_t rows = processes.size();
+    pidSlots.resize(rows);
+    pidSlotIndex.clear();
+    pidSlotCount = rows;
+    
+    bool dense = true;
+    for (size_t i = 0; i < rows && dense; ++i) {
+        const int pid = processes.getPid(i);
+        dense = pid >= 0 && static_cast<size_t>(pid) < rows;
+    }
+    if (dense) {
+        for (size_t i = 0; i < rows; ++i) {
+            pidSlots[i] = processes.getPid(i);
+        }
+        return;
+    }
+    
+    pidSlotCount = 0;
+    for (size_t i = 0; i < rows; ++i) {
+        auto slot = pidSlotIndex.emplace(processes.getPid(i), static_cast<int>(pidSlotCount));
+        if (slot.second) {
+            pidSlotCount++;
+        }
+        pidSlots[i] = slot.first->second;
+    }
+}
+
+void Scheduler::addPidSlot(int idx) {
+    const int pid = processes.getPid(idx);
+    if (pidSlotIndex.empty() && pid >= 0 && static_cast<size_t>(pid) <= pidSlotCount) {
+        // Still dense: an existing pid, or the next one
+        if (static_cast<size_t>(pid) == pidSlotCount) {
+            pidSlotCount++;
+        }
+        pidSlots.push_back(pid);
+        return;
+    }
+    if (pidSlotIndex.empty()) {
+        // Leaving the dense case: index the identity slots handed out so far
+        for (size_t slot = 0; slot < pidSlotCount; ++slot) {
+            pidSlotIndex.emplace(static_cast<int>(slot), static_cast<int>(slot));
+        }
+    }
+    auto slot = pidSlotIndex.emplace(pid, static_cast<int>(pidSlotCount));
+    if (slot.second) {
+        pidSlotCount++;
+    }
+    pidSlots.push_back(slot.first->second);
+}
+
+void Scheduler::releaseRunMemory() {
+    runPool.release();
+    runArena.release();
+}
+
+void Scheduler::setArrivalSource(ArrivalSource* source, int horizon) {
+    arrivalSource = source;
+    arrivalHorizon = horizon;
+}
+
+void Scheduler::beginRunStats() {
+#ifdef SCHEDULER_PROFILE
+    runStats.reset();
+    runStats.runs = 1;
+    runStarted = std::chrono::steady_clock::now();
+#endif
+}
+
+void Scheduler::rewindArrivals() {
+    beginRunStats();
+    reloadProcesses();
+    sourceDrained = (arrivalSource == nullptr);
+    if (arrivalSource != nullptr) {
+        arrivalSource->rewind();
+    }
+}
+
+void Scheduler::pullArrivals(int time) {
+    Arrival arrival;
+    while (!sourceDrained && (injectedCount == 0 || lastInjectedArrival <= time)) {
+        if (!arrivalSource->next(arrival) || arrival.arrivalTime > arrivalHorizon) {
+            sourceDrained = true;
+            break;
+        }
+        
+        // Arrivals must not go back in time
+        const int when = injectedCount > 0 ?
+                         std::max(arrival.arrivalTime, lastInjectedArrival) : arrival.arrivalTime;
+        processes.add(arrival.pid, arrival.priority, arrival.burstTime, when);
+        const int idx = static_cast<int>(processes.size() - 1);
+        
+        // After every pending arrival at the same time, like the static index
+        auto pos = std::upper_bound(arrivalOrder.begin() + arrivalCursor, arrivalOrder.end(), when,
+                                    [this](int value, int other) {
+                                        return value < processes.getArrivalTime(other);
+                                    });
+        arrivalOrder.insert(pos, idx);
+        injectedCount++;
+        lastInjectedArrival = when;
+        onProcessInjected(idx);
+    }
 }
 
 void Scheduler::addProcesses(const std::vector<Process>& procs) {
@@ -32,83 +202,639 @@ void Scheduler::addProcesses(const std::vector<Process>& procs) {
 }
 
 void Scheduler::checkArrivals(int time) {
-    for (auto& process : processes) {
-        if (process.getArrivalTime() == time && 
-            process.getState() == ProcessState::NEW) {
-            process.setState(ProcessState::READY);
-            readyQueue.push_back(process);
+    for (int idx : arrivalsBetween(time, time)) {
+        if (processes.getState(idx) == ProcessState::NEW) {
+            processes.setState(idx, ProcessState::READY);
+            processes.beginWait(idx, serviceClock);
+            readyQueue.push_back(idx);
         }
     }
 }
 
-void Scheduler::performContextSwitch(Process* from, Process* to) {
-    if (from != nullptr && to != nullptr && from->getPid() != to->getPid()) {
+void Scheduler::buildArrivalIndex() {
+    arrivalOrder.resize(processes.size());
+    for (size_t i = 0; i < processes.size(); ++i) {
+        arrivalOrder[i] = static_cast<int>(i);
+    }
+    // Ties broken by row index: the order of a stable sort, without the
+    // temporary buffer std::stable_sort allocates on every run
+    std::sort(arrivalOrder.begin(), arrivalOrder.end(),
+              [this](int a, int b) {
+                  const int arrivalA = processes.getArrivalTime(a);
+                  const int arrivalB = processes.getArrivalTime(b);
+                  return arrivalA < arrivalB || (arrivalA == arrivalB && a < b);
+              });
+    arrivalCursor = 0;
+    events.clear();
+    ioTimers.reset();
+    pullArrivals(INT_MIN);
+}
+
+void Scheduler::saveRunState(SchedulerSnapshot& snapshot) const {
+    snapshot.processes = processes;
+    snapshot.arrivalCursor = arrivalCursor;
+    snapshot.deadlines = events.pending();
+    snapshot.nextSequence = events.getNextSequence();
+    snapshot.timeline = timeline;
+    snapshot.currentTime = currentTime;
+    snapshot.contextSwitches = contextSwitches;
+    snapshot.serviceClock = serviceClock;
+    snapshot.idleTime = idleTime;
+    snapshot.lastExecutionEnd = lastExecutionEnd;
+    snapshot.wakeups.clear();
+    ioTimers.forEach([&snapshot](int idx, int time) {
+        snapshot.wakeups.push_back({time, SimEventType::IO_COMPLETE, idx,
+                                    static_cast<long long>(snapshot.wakeups.size())});
+    });
+}
+
+void Scheduler::loadRunState(const SchedulerSnapshot& snapshot) {
+    if (arrivalSource != nullptr) {
+        throw std::logic_error("Cannot resume a snapshot with an arrival source attached");
+    }
+    const size_t rows = snapshot.processes.size();
+    if (snapshot.arrivalCursor > rows) {
+        throw std::invalid_argument("Snapshot admits more processes than it holds");
+    }
+    for (const SimEvent& event : snapshot.deadlines) {
+        if (event.processIdx < -1 || event.processIdx >= static_cast<int>(rows) ||
+            event.sequence >= snapshot.nextSequence) {
+            throw std::invalid_argument("Snapshot has a deadline of no process");
+        }
+    }
+    // A run pauses before admitting, so wakeups up to the pause time may
+    // still be pending; they fire at the first admission after the resume
+    for (const SimEvent& wakeup : snapshot.wakeups) {
+        if (wakeup.processIdx < 0 || wakeup.processIdx >= static_cast<int>(rows) ||
+            snapshot.processes.getState(wakeup.processIdx) != ProcessState::WAITING) {
+            throw std::invalid_argument("Snapshot wakes a process that is not blocked");
+        }
+    }
+
+    beginRunStats();
+    processes = snapshot.processes;
+    injectedCount = 0;
+    workload.reset();
+    sourceDrained = true;
+    buildArrivalIndex();
+    arrivalCursor = snapshot.arrivalCursor;
+    events.restore(snapshot.deadlines, snapshot.nextSequence);
+    for (const SimEvent& wakeup : snapshot.wakeups) {
+        ioTimers.schedule(wakeup.processIdx, wakeup.time);
+    }
+    timeline = snapshot.timeline;
+    currentTime = snapshot.currentTime;
+    contextSwitches = snapshot.contextSwitches;
+    serviceClock = snapshot.serviceClock;
+    idleTime = snapshot.idleTime;
+    lastExecutionEnd = snapshot.lastExecutionEnd;
+    SCHED_PROFILE(runStats.runnable = arrivalCursor - (rows - processes.countUnfinished()));
+}
+
+bool Scheduler::runUntil(int time) {
+    (void)time;
+    throw std::logic_error(getName() + " cannot pause runs; use a policy-engine scheduler");
+}
+
+SchedulerSnapshot Scheduler::snapshot() const {
+    throw std::logic_error(getName() + " cannot snapshot runs; use a policy-engine scheduler");
+}
+
+bool Scheduler::resume(const SchedulerSnapshot& snapshot, int until) {
+    (void)snapshot;
+    (void)until;
+    throw std::logic_error(getName() + " cannot resume runs; use a policy-engine scheduler");
+}
+
+ArrivalRange Scheduler::takeArrivals(int time) {
+    // Injecting can reallocate the index, so find the window afterwards
+    pullArrivals(time);
+    const int* first = arrivalOrder.data() + arrivalCursor;
+    while (arrivalCursor < arrivalOrder.size() &&
+           processes.getArrivalTime(arrivalOrder[arrivalCursor]) <= time) {
+        arrivalCursor++;
+    }
+    SCHED_PROFILE(runStats.noteAdmitted(static_cast<size_t>(arrivalOrder.data() + arrivalCursor -
+                                                            first), events.size()));
+    return {first, arrivalOrder.data() + arrivalCursor};
+}
+
+ArrivalRange Scheduler::arrivalsBetween(int t0, int t1) const {
+    auto byArrival = [this](int idx, int time) {
+        return processes.getArrivalTime(idx) < time;
+    };
+    auto firstIt = std::lower_bound(arrivalOrder.begin(), arrivalOrder.end(),
+                                    t0, byArrival);
+    auto lastIt = firstIt;
+    if (t1 >= t0) {
+        lastIt = (t1 == INT_MAX) ? arrivalOrder.end() :
+                 std::lower_bound(firstIt, arrivalOrder.end(), t1 + 1, byArrival);
+    }
+    const int* base = arrivalOrder.data();
+    return {base + (firstIt - arrivalOrder.begin()), base + (lastIt - arrivalOrder.begin())};
+}
+
+int Scheduler::nextArrivalTime() const {
+    if (arrivalCursor >= arrivalOrder.size()) {
+        return INT_MAX;
+    }
+    return processes.getArrivalTime(arrivalOrder[arrivalCursor]);
+}
+
+int Scheduler::nextEventTime() const {
+    return std::min({events.nextTime(), nextArrivalTime(), ioTimers.nextTime()});
+}
+
+ArrivalRange Scheduler::admitArrivals(int time) {
+    ArrivalRange arrivals = takeArrivals(time);
+    for (int idx : arrivals) {
+        if (processes.getState(idx) == ProcessState::NEW) {
+            processes.setState(idx, ProcessState::READY);
+            processes.beginWait(idx, serviceClock);
+            readyQueue.push_back(idx);
+        }
+    }
+    return arrivals;
+}
+
+int Scheduler::eventSlice(int start, int budget) const {
+    if (!config.eventDriven) {
+        return std::min(1, budget);
+    }
+    
+    int nextEvent = nextEventTime();
+    if (nextEvent == INT_MAX) {
+        return budget;
+    }
+    return std::min(budget, std::max(1, nextEvent - start));
+}
+
+void Scheduler::advanceIdleTime() {
+    int nextEvent = nextEventTime();
+    if (config.eventDriven && nextEvent != INT_MAX) {
+        currentTime = std::max(currentTime + 1, nextEvent);
+    } else {
+        currentTime++;
+    }
+}
+
+void Scheduler::performContextSwitch(int from, int to) {
+    if (from >= 0 && to >= 0 && processes.getPid(from) != processes.getPid(to)) {
         contextSwitches++;
         
         // Record context switch in timeline
         recordEvent(-1, currentTime, currentTime + config.contextSwitchTime, 
-                    true, "Context Switch");
+                    EventKind::CONTEXT_SWITCH);
         
         // Simulate context switch time
         currentTime += config.contextSwitchTime;
     }
 }
 
-void Scheduler::recordEvent(int pid, int start, int end, bool isSwitch, 
-                            const std::string& desc) {
-    ExecutionEvent event;
-    event.processId = pid;
-    event.startTime = start;
-    event.endTime = end;
-    event.isContextSwitch = isSwitch;
-    event.description = desc;
-    timeline.push_back(event);
+void Scheduler::recordEvent(int pid, int start, int end, EventKind kind, int cpu) {
+    SCHED_PROFILE_PHASE(RunPhase::TIMELINE);
+    SCHED_PROFILE(runStats.events++);
+    if (!timeline.empty()) {
+        if (sink != nullptr) {
+            sink->onEvent(timeline.back());
+        }
+        if (!config.keepTimeline) {
+            timeline.pop_back();
+        }
+    }
+    
+    // Idle gaps are the time between consecutive execution events
+    if (kind != EventKind::CONTEXT_SWITCH && pid >= 0) {
+        if (start > lastExecutionEnd) {
+            idleTime += start - lastExecutionEnd;
+        }
+        lastExecutionEnd = end;
+    }
+    timeline.push_back({pid, start, end, kind, static_cast<std::uint16_t>(cpu)});
+}
+
+void Scheduler::finishTimeline() {
+    if (!timeline.empty()) {
+        if (sink != nullptr) {
+            sink->onEvent(timeline.back());
+        }
+        if (!config.keepTimeline) {
+            timeline.pop_back();
+        }
+    }
+    if (sink != nullptr) {
+        sink->flush();
+    }
+}
+
+void Scheduler::recordCompletion(int idx) {
+    SCHED_PROFILE(runStats.noteCompleted());
+    if (sink != nullptr) {
+        sink->onCompletion({processes.getPid(idx), processes.getArrivalTime(idx),
+                            processes.getBurstTime(idx), processes.getCompletionTime(idx),
+                            processes.getTurnaroundTime(idx), processes.getWaitingTime(idx),
+                            processes.getResponseTime(idx)});
+    }
+}
+
+void Scheduler::startTimeline(int sliceLength, int eventsPerSlice) {
+    timeline.clear();
+    idleTime = 0;
+    lastExecutionEnd = 0;
+    if (!config.keepTimeline) {
+        return;
+    }
+    
+    const long long length = std::max(1, sliceLength);
+    long long slices = 0;
+    for (size_t i = 0; i < processes.size(); ++i) {
+        slices += (processes.getBurstTime(i) + length - 1) / length;
+    }
+    timeline.reserve(static_cast<size_t>(slices * eventsPerSlice));
+}
+
+std::string ExecutionEvent::describe() const {
+    switch (kind) {
+        case EventKind::CONTEXT_SWITCH: return "Context Switch";
+        case EventKind::IDLE: return "CPU Idle";
+        case EventKind::PREEMPT: return "Preempt P" + std::to_string(processId);
+        case EventKind::DEMOTE: return "Demote P" + std::to_string(processId);
+        case EventKind::BLOCK: return "Block P" + std::to_string(processId);
+        case EventKind::EXECUTE: break;
+    }
+    return "Execute P" + std::to_string(processId);
+}
+
+void Scheduler::smpUpdateLoad(int cpu) {
+    leastLoaded.update(cpu);
+    longestQueue.update(cpu);
+}
+
+void Scheduler::smpPlace(int idx, int cpu) {
+    if (static_cast<size_t>(idx) >= queuedCpu.size()) {
+        // Injected during the run
+        queuedCpu.resize(processes.size(), -1);
+        lastCpu.resize(processes.size(), -1);
+    }
+    processes.setState(idx, ProcessState::READY);
+    queuedCpu[idx] = cpu;
+    smpEnqueue(cpu, idx);
+    cpus[cpu].queued++;
+    queuedTotal++;
+    smpUpdateLoad(cpu);
+    
+    if (cpus[cpu].running == -1) {
+        readyCpus.set(cpu);
+    } else {
+        smpPreemptFor(cpu, idx);
+    }
+}
+
+void Scheduler::smpPreemptFor(int cpu, int idx) {
+    const int running = cpus[cpu].running;
+    if (running == -1 || !smpPreempts(idx, running)) {
+        return;
+    }
+    // The slice is cut short, so the process cannot finish in it
+    sliceEnds.erase(cpu);
+    smpEndSlice(cpu, currentTime);
+}
+
+void Scheduler::smpStart(int cpu, int from) {
+    const int idx = smpDequeue(from);
+    cpus[from].queued--;
+    queuedTotal--;
+    
+    CpuState& state = cpus[cpu];
+    const int pid = processes.getPid(idx);
+    // A CPU preempted mid-switch finishes the switch first
+    const int start = std::max(currentTime, state.sliceEnd);
+    int cost = 0;
+    if (state.lastPid != -1 && state.lastPid != pid) {
+        contextSwitches++;
+        cost += config.contextSwitchTime;
+    }
+    if (lastCpu[idx] != -1 && lastCpu[idx] != cpu) {
+        migrations++;
+        cost += config.migrationCost;
+    }
+    if (cost > 0) {
+        recordEvent(-1, start, start + cost, EventKind::CONTEXT_SWITCH, cpu);
+        switchTime += cost;
+    }
+    
+    state.sliceStart = start + cost;
+    state.sliceEnd = state.sliceStart + smpSliceLength(idx);
+    if (!processes.getHasStarted(idx)) {
+        processes.setResponseTime(idx, state.sliceStart - processes.getArrivalTime(idx));
+        processes.setHasStarted(idx, true);
+    }
+    processes.setState(idx, ProcessState::RUNNING);
+    state.running = idx;
+    state.lastPid = pid;
+    lastCpu[idx] = cpu;
+    queuedCpu[idx] = cpu;
+    
+    idleCpus.clear(cpu);
+    readyCpus.clear(cpu);
+    sliceEnds.push(cpu);
+    smpUpdateLoad(from);
+    if (from != cpu) {
+        smpUpdateLoad(cpu);
+    }
+}
+
+bool Scheduler::smpEndSlice(int cpu, int end) {
+    CpuState& state = cpus[cpu];
+    const int idx = state.running;
+    const int ran = std::max(0, end - state.sliceStart);
+    const int pid = processes.getPid(idx);
+    if (ran > 0) {
+        processes.execute(idx, ran);
+        state.busyTime += ran;
+        recordEvent(pid, state.sliceStart, state.sliceStart + ran, EventKind::EXECUTE, cpu);
+    }
+    const EventKind kind = smpSliceEnd(idx, ran);
+    
+    state.running = -1;
+    state.sliceEnd = std::max(end, state.sliceStart);
+    idleCpus.set(cpu);
+    if (state.queued > 0) {
+        readyCpus.set(cpu);
+    }
+    smpUpdateLoad(cpu);
+    
+    if (processes.getRemainingTime(idx) == 0) {
+        const int turnaround = state.sliceEnd - processes.getArrivalTime(idx);
+        processes.setState(idx, ProcessState::TERMINATED);
+        processes.setCompletionTime(idx, state.sliceEnd);
+        processes.setTurnaroundTime(idx, turnaround);
+        processes.setWaitingTime(idx, turnaround - processes.getBurstTime(idx));
+        recordCompletion(idx);
+        return true;
+    }
+    if (ran > 0) {
+        timeline.back().kind = kind;
+    }
+    requeued.push_back(idx);
+    return false;
+}
+
+void Scheduler::smpDispatch() {
+    for (int cpu = readyCpus.first(); cpu != -1; cpu = readyCpus.first()) {
+        readyCpus.clear(cpu);
+        if (cpus[cpu].running == -1 && cpus[cpu].queued > 0) {
+            smpStart(cpu, cpu);
+        }
+    }
+    // Every idle CPU with a queue of its own is busy now
+    if (config.workStealing) {
+        for (int cpu = idleCpus.first(); cpu != -1 && queuedTotal > 0; cpu = idleCpus.first()) {
+            smpStart(cpu, longestQueue.top());
+        }
+    }
+}
+
+void Scheduler::runSmp() {
+    const int cpuCount = std::min(std::max(1, config.numCpus), UINT16_MAX + 1);
+    currentTime = 0;
+    contextSwitches = 0;
+    serviceClock = 0;
+    switchTime = 0;
+    migrations = 0;
+    queuedTotal = 0;
+    startTimeline(config.timeQuantum, 2);
+    
+    processes.resetAll();
+    buildPidSlots();
+    cpus.assign(cpuCount, CpuState());
+    sliceEnds.reset(cpuCount);
+    leastLoaded.reset(cpuCount);
+    longestQueue.reset(cpuCount);
+    idleCpus.reset(cpuCount);
+    readyCpus.reset(cpuCount);
+    for (int cpu = 0; cpu < cpuCount; ++cpu) {
+        leastLoaded.push(cpu);
+        longestQueue.push(cpu);
+        idleCpus.set(cpu);
+    }
+    requeued.clear();
+    buildArrivalIndex();
+    queuedCpu.assign(processes.size(), -1);
+    lastCpu.assign(processes.size(), -1);
+    smpBegin(cpuCount);
+    
+    // Injected arrivals grow the table as the run goes
+    size_t completed = 0;
+    while (true) {
+        while (!sliceEnds.empty() && cpus[sliceEnds.top()].sliceEnd <= currentTime) {
+            const int cpu = sliceEnds.pop();
+            completed += smpEndSlice(cpu, cpus[cpu].sliceEnd);
+        }
+        // The run ends with its last completion, not at the next deadline
+        if (completed >= processes.size()) {
+            break;
+        }
+        
+        // Arrivals go ahead of the slices that just ended, as on one CPU
+        {
+            SCHED_PROFILE_PHASE(RunPhase::ADMISSION);
+            for (int idx : takeArrivals(currentTime)) {
+                const unsigned int home = static_cast<unsigned int>(processes.getPid(idx)) %
+                                          static_cast<unsigned int>(cpuCount);
+                smpPlace(idx, config.pushMigration ? leastLoaded.top() : static_cast<int>(home));
+            }
+        }
+        {
+            SCHED_PROFILE_PHASE(RunPhase::DEADLINES);
+            smpDeadlines();
+            events.discardUntil(currentTime);
+        }
+        
+        // Unfinished slices stay on their CPU unless another has two fewer processes
+        for (size_t i = 0; i < requeued.size(); ++i) {
+            const int idx = requeued[i];
+            int cpu = lastCpu[idx];
+            if (config.pushMigration) {
+                const int target = leastLoaded.top();
+                const int load = cpus[cpu].queued + (cpus[cpu].running != -1);
+                const int targetLoad = cpus[target].queued + (cpus[target].running != -1);
+                if (targetLoad + 1 < load) {
+                    cpu = target;
+                }
+            }
+            smpPlace(idx, cpu);
+        }
+        requeued.clear();
+        {
+            SCHED_PROFILE_PHASE(RunPhase::SELECTION);
+            smpDispatch();
+        }
+        
+        const int nextSliceEnd = sliceEnds.empty() ? INT_MAX : cpus[sliceEnds.top()].sliceEnd;
+        const int next = std::min(nextSliceEnd, nextEventTime());
+        if (next == INT_MAX) {
+            break;
+        }
+        // Tick mode visits every time unit; nothing happens between events
+        currentTime = config.eventDriven ? std::max(next, currentTime + 1) : currentTime + 1;
+    }
+    
+    calculateMetrics();
+    std::vector<int> busyTimes(cpuCount);
+    for (int cpu = 0; cpu < cpuCount; ++cpu) {
+        busyTimes[cpu] = cpus[cpu].busyTime;
+    }
+    metrics.calculateCpuUtilization(busyTimes, switchTime);
+    metrics.setTotalMigrations(migrations);
 }
 
 void Scheduler::reset() {
     readyQueue.clear();
     timeline.clear();
+    idleTime = 0;
+    lastExecutionEnd = 0;
     metrics.reset();
     currentTime = 0;
     contextSwitches = 0;
-    currentProcess = nullptr;
+    serviceClock = 0;
+    currentProcess = -1;
     isRunning = false;
+    events.clear();
+    ioTimers.reset();
+    arrivalOrder.clear();
+    arrivalCursor = 0;
+    migrations = 0;
+    runStats.reset();
     
-    // Reset all processes
-    for (auto& process : processes) {
-        process.reset();
-    }
+    // Reset all processes, dropping any injected by the last run
+    reloadProcesses();
+    processes.resetAll();
+    releaseRunMemory();
 }
 
 void Scheduler::calculateMetrics() {
-    metrics.reset();
-    
-    int totalBurstTime = 0;
-    int idleTime = 0;
-    int lastEndTime = 0;
-    
-    for (const auto& process : processes) {
-        metrics.addWaitingTime(process.getWaitingTime());
-        metrics.addTurnaroundTime(process.getTurnaroundTime());
-        metrics.addResponseTime(process.getResponseTime());
-        totalBurstTime += process.getBurstTime();
+    {
+        SCHED_PROFILE_PHASE(RunPhase::METRICS);
+        finishTimeline();
+        metrics.reset();
+        metrics.setKeepSamples(config.keepProcessMetrics);
+        
+        for (size_t i = 0; i < processes.size(); ++i) {
+            metrics.addWaitingTime(processes.getWaitingTime(i));
+            metrics.addTurnaroundTime(processes.getTurnaroundTime(i));
+            metrics.addResponseTime(processes.getResponseTime(i));
+        }
+        
+        // Idle time is accumulated by recordEvent as the run goes
+        
+        metrics.calculateAverages();
+        metrics.setTotalContextSwitches(contextSwitches);
+        metrics.calculateUtilization(currentTime, idleTime, 
+                                     contextSwitches * config.contextSwitchTime);
+        metrics.calculateThroughput(currentTime);
     }
     
-    // Calculate idle time from timeline
+    // Every run ends here
+#ifdef SCHEDULER_PROFILE
+    runStats.runNanoseconds = static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - runStarted).count());
+#endif
+}
+
+/**
+ * @brief Check if an entry is a slice of a running process
+ */
+static bool isExecution(EventKind kind) {
+    return kind == EventKind::EXECUTE || kind == EventKind::PREEMPT ||
+           kind == EventKind::DEMOTE || kind == EventKind::BLOCK;
+}
+
+/**
+ * @brief Merge back-to-back events of the same kind and process
+ *
+ * The tick loop records one event per time unit where the event engine
+ * records one per slice; merged, both describe the same schedule.
+ */
+static std::vector<ExecutionEvent> coalesceTimeline(
+        const std::vector<ExecutionEvent>& timeline) {
+    std::vector<ExecutionEvent> merged;
     for (const auto& event : timeline) {
-        if (!event.isContextSwitch && event.processId >= 0) {
-            if (event.startTime > lastEndTime) {
-                idleTime += (event.startTime - lastEndTime);
+        if (!merged.empty()) {
+            ExecutionEvent& last = merged.back();
+            // A run of slices takes the kind of its last slice, so ticked
+            // EXECUTE slices ending in a PREEMPT match a single PREEMPT slice
+            bool continues = (last.kind == event.kind) ||
+                             (last.kind == EventKind::EXECUTE && isExecution(event.kind));
+            if (last.processId == event.processId &&
+                last.endTime == event.startTime && continues) {
+                last.endTime = event.endTime;
+                last.kind = event.kind;
+                continue;
+            }
+        }
+        merged.push_back(event);
+    }
+    return merged;
+}
+
+bool Scheduler::verifyEventEngine(std::string* mismatch) {
+    rewindArrivals();
+    const ProcessTable initial = processes;
+    const bool wasEventDriven = config.eventDriven;
+    const bool keptTimeline = config.keepTimeline;
+    TraceSink* const attached = sink;
+    
+    // Both timelines are needed for the comparison; only the kept run is traced
+    config.keepTimeline = true;
+    config.eventDriven = false;
+    sink = nullptr;
+    run();
+    const Metrics tickMetrics = metrics;
+    const std::vector<ExecutionEvent> tickTimeline = coalesceTimeline(timeline);
+    
+    processes = initial;
+    injectedCount = 0;
+    config.eventDriven = true;
+    sink = attached;
+    run();
+    config.eventDriven = wasEventDriven;
+    config.keepTimeline = keptTimeline;
+    
+    std::ostringstream report;
+    bool identical = true;
+    if (!(metrics == tickMetrics)) {
+        identical = false;
+        report << getName() << ": metrics differ (event-driven avg wait "
+               << metrics.getAvgWaitingTime() << ", tick "
+               << tickMetrics.getAvgWaitingTime() << ")";
+    } else {
+        const std::vector<ExecutionEvent> eventTimeline = coalesceTimeline(timeline);
+        size_t count = std::min(eventTimeline.size(), tickTimeline.size());
+        for (size_t i = 0; i < count && identical; ++i) {
+            const ExecutionEvent& a = eventTimeline[i];
+            const ExecutionEvent& b = tickTimeline[i];
+            if (a.processId != b.processId || a.startTime != b.startTime ||
+                a.endTime != b.endTime || a.kind != b.kind) {
+                identical = false;
+                report << getName() << ": timeline differs at entry " << i
+                       << " (event-driven P" << a.processId << " " << a.startTime
+                       << "-" << a.endTime << ", tick P" << b.processId << " "
+                       << b.startTime << "-" << b.endTime << ")";
             }
-            lastEndTime = event.endTime;
+        }
+        if (identical && eventTimeline.size() != tickTimeline.size()) {
+            identical = false;
+            report << getName() << ": timeline length differs (event-driven "
+                   << eventTimeline.size() << ", tick " << tickTimeline.size() << ")";
         }
     }
     
-    metrics.calculateAverages();
-    metrics.setTotalContextSwitches(contextSwitches);
-    metrics.calculateUtilization(currentTime, idleTime, 
-                                 contextSwitches * config.contextSwitchTime);
-    metrics.calculateThroughput(currentTime);
+    if (mismatch != nullptr) {
+        *mismatch = report.str();
+    }
+    return identical;
 }
 
 void Scheduler::printGanttChart() const {
@@ -125,7 +851,7 @@ void Scheduler::printGanttChart() const {
     // Print timeline
     std::cout << "║ ";
     for (const auto& event : timeline) {
-        if (event.isContextSwitch) {
+        if (event.isContextSwitch()) {
             std::cout << "[CS] ";
         } else {
             std::cout << "[P" << event.processId << "] ";
@@ -155,12 +881,12 @@ void Scheduler::printReadyQueue() const {
         std::cout << "╠══════════════════════════════════════════════════════════════╣\n";
         
         int pos = 0;
-        for (const auto& process : readyQueue) {
+        for (int idx : readyQueue) {
             std::cout << "║ " << std::setw(8) << pos++ 
-                      << " │ " << std::setw(3) << process.getPid()
-                      << " │ " << std::setw(8) << process.getPriority()
-                      << " │ " << std::setw(9) << process.getRemainingTime()
-                      << " │ " << std::setw(7) << process.getArrivalTime()
+                      << " │ " << std::setw(3) << processes.getPid(idx)
+                      << " │ " << std::setw(8) << processes.getPriority(idx)
+                      << " │ " << std::setw(9) << processes.getRemainingTime(idx)
+                      << " │ " << std::setw(7) << processes.getArrivalTime(idx)
                       << "             ║\n";
         }
     }
@@ -169,10 +895,26 @@ void Scheduler::printReadyQueue() const {
 }
 
 bool Scheduler::isComplete() const {
-    for (const auto& process : processes) {
-        if (process.getState() != ProcessState::TERMINATED) {
-            return false;
-        }
+    return processes.countUnfinished() == 0;
+}
+
+std::vector<Process> Scheduler::getReadyQueue() const {
+    std::vector<Process> ready;
+    ready.reserve(readyQueue.size());
+    for (int idx : readyQueue) {
+        ready.push_back(processes.getProcess(idx));
     }
-    return true;
+    return ready;
+}
+
+std::vector<ExecutionEvent> Scheduler::takeTimeline() {
+    std::vector<ExecutionEvent> taken;
+    taken.swap(timeline);
+    return taken;
+}
+
+Metrics Scheduler::takeMetrics() {
+    Metrics taken = std::move(metrics);
+    metrics.reset();
+    return taken;
 }
@@ -0,0 +1,45 @@
+/**
+ * @file SchedulerEngine.cpp
+ * @brief Instantiations of the policy-based scheduling loop
+ * @version 1.0
+ */
+
+#include "SchedulerEngine.h"
+
+template class SchedulerEngine<FifoQueue, QuantumExpiry, NoAging, TurnaroundAccounting>;
+template class SchedulerEngine<PriorityHeapQueue, RunToCompletion, PriorityAging,
+                               PreemptionAccounting>;
+template class SchedulerEngine<PriorityHeapQueue, OutrankPreemption, PriorityAging,
+                               PreemptionAccounting>;
+template class SchedulerEngine<StaticLevelQueues, QuantumExpiry, NoAging>;
+template class SchedulerEngine<FeedbackLevelQueues, QuantumExpiry, PeriodicBoost>;
+template class SchedulerEngine<FairQueue, QuantumExpiry, NoAging, TurnaroundAccounting>;
+template class SchedulerEngine<ShortestJobQueue, RunToCompletion, NoAging, TurnaroundAccounting>;
+template class SchedulerEngine<ShortestJobQueue, OutrankPreemption, NoAging,
+                               TurnaroundAccounting>;
+
+std::unique_ptr<Scheduler> createEngineScheduler(SchedulerType type,
+                                                 const SchedulerConfig& config) {
+    switch (type) {
+        case SchedulerType::ROUND_ROBIN:
+            return std::make_unique<RoundRobinEngine>("Round Robin", type, config);
+        case SchedulerType::PRIORITY_PREEMPTIVE:
+            return std::make_unique<PreemptivePriorityEngine>("Priority (Preemptive)", type,
+                                                              config);
+        case SchedulerType::PRIORITY_NON_PREEMPTIVE:
+            return std::make_unique<PriorityEngine>("Priority (Non-Preemptive)", type, config);
+        case SchedulerType::MULTILEVEL_QUEUE:
+            return std::make_unique<MultilevelQueueEngine>("Multilevel Queue", type, config);
+        case SchedulerType::MULTILEVEL_FEEDBACK_QUEUE:
+            return std::make_unique<FeedbackQueueEngine>("Multilevel Feedback Queue", type,
+                                                         config);
+        case SchedulerType::FAIR:
+            return std::make_unique<FairEngine>("Fair (CFS)", type, config);
+        case SchedulerType::SHORTEST_JOB_FIRST:
+            return std::make_unique<ShortestJobEngine>("Shortest Job First", type, config);
+        case SchedulerType::SHORTEST_REMAINING_TIME:
+            return std::make_unique<ShortestRemainingEngine>("Shortest Remaining Time", type,
+                                                             config);
+    }
+    return nullptr;
+}
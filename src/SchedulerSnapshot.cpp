@@ -0,0 +1,309 @@
+/**
+ * @file SchedulerSnapshot.cpp
+ * @brief Binary form of scheduler snapshots
+ * @version 1.0
+ */
+
+#include "SchedulerSnapshot.h"
+#include <cstring>
+#include <fstream>
+#include <istream>
+#include <ostream>
+
+/// Snapshot file identification and layout
+static const char SNAPSHOT_MAGIC[4] = {'C', 'P', 'U', 'S'};
+static const std::uint32_t SNAPSHOT_VERSION = 2;
+static const std::uint32_t BYTE_ORDER_MARK = 0x01020304;
+static const size_t ROW_COLUMNS = 13;      ///< 32-bit columns written per process row
+static const size_t MAX_NAME_LENGTH = 1 << 16;
+static const size_t MAX_IO_BURSTS = 1 << 20;  ///< I/O bursts accepted per process row
+
+/**
+ * @struct SnapshotHeader
+ * @brief Fixed header at the start of a snapshot
+ */
+struct SnapshotHeader {
+    char magic[4];              ///< SNAPSHOT_MAGIC
+    std::uint32_t version;      ///< SNAPSHOT_VERSION
+    std::uint32_t byteOrder;    ///< BYTE_ORDER_MARK as written by the host
+    std::uint32_t type;         ///< SchedulerType of the paused scheduler
+    std::uint64_t rows;         ///< Number of process rows
+};
+static_assert(sizeof(SnapshotHeader) == 24, "snapshot header layout");
+
+static bool fail(std::string* error, const std::string& message) {
+    if (error != nullptr) {
+        *error = message;
+    }
+    return false;
+}
+
+template <typename T>
+static void writeValue(std::ostream& out, T value) {
+    out.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+template <typename T>
+static bool readValue(std::istream& in, T& value) {
+    return static_cast<bool>(in.read(reinterpret_cast<char*>(&value), sizeof(value)));
+}
+
+/**
+ * @brief Write a count followed by fixed-width values
+ */
+template <typename T>
+static void writeValues(std::ostream& out, const std::vector<T>& values) {
+    writeValue<std::uint64_t>(out, values.size());
+    out.write(reinterpret_cast<const char*>(values.data()),
+              static_cast<std::streamsize>(values.size() * sizeof(T)));
+}
+
+/**
+ * @brief Read values written by writeValues()
+ *
+ * Grows the vector as values arrive, so a corrupt count fails at the end
+ * of the stream instead of allocating for it.
+ */
+template <typename T>
+static bool readValues(std::istream& in, std::vector<T>& values) {
+    std::uint64_t count = 0;
+    if (!readValue(in, count)) {
+        return false;
+    }
+    values.clear();
+    T value;
+    for (std::uint64_t i = 0; i < count; ++i) {
+        if (!readValue(in, value)) {
+            return false;
+        }
+        values.push_back(value);
+    }
+    return true;
+}
+
+bool SchedulerSnapshot::write(std::ostream& out) const {
+    SnapshotHeader header;
+    std::memcpy(header.magic, SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC));
+    header.version = SNAPSHOT_VERSION;
+    header.byteOrder = BYTE_ORDER_MARK;
+    header.type = static_cast<std::uint32_t>(type);
+    header.rows = processes.size();
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+    writeValue<std::uint64_t>(out, arrivalCursor);
+    writeValue<std::int64_t>(out, nextSequence);
+    for (int value : {currentTime, contextSwitches, serviceClock, idleTime,
+                      lastExecutionEnd, running, lastPid}) {
+        writeValue<std::int32_t>(out, value);
+    }
+
+    for (size_t i = 0; i < processes.size(); ++i) {
+        const std::int32_t row[ROW_COLUMNS] = {
+            processes.getPid(i), processes.getPriority(i), processes.getBurstTime(i),
+            processes.getRemainingTime(i), processes.getArrivalTime(i),
+            processes.getWaitingTime(i), processes.getTurnaroundTime(i),
+            processes.getResponseTime(i), processes.getCompletionTime(i),
+            processes.getQueueLevel(i), processes.getWaitStart(i),
+            processes.getHasStarted(i) ? 1 : 0, static_cast<std::int32_t>(processes.getState(i))
+        };
+        out.write(reinterpret_cast<const char*>(row), sizeof(row));
+        const std::string name = processes.getName(i);
+        writeValue<std::uint32_t>(out, static_cast<std::uint32_t>(name.size()));
+        out.write(name.data(), static_cast<std::streamsize>(name.size()));
+        writeValue<std::uint32_t>(out, static_cast<std::uint32_t>(processes.getIoBurstCount(i)));
+        for (size_t k = 0; k < processes.getIoBurstCount(i); ++k) {
+            writeValue<std::int32_t>(out, processes.getIoBurst(i, k).after);
+            writeValue<std::int32_t>(out, processes.getIoBurst(i, k).length);
+        }
+        writeValue<std::int32_t>(out, processes.getIoNext(i));
+    }
+
+    // Field by field, so padding never reaches the file
+    writeValue<std::uint64_t>(out, deadlines.size());
+    for (const SimEvent& event : deadlines) {
+        writeValue<std::int32_t>(out, event.time);
+        writeValue<std::int32_t>(out, static_cast<std::int32_t>(event.type));
+        writeValue<std::int32_t>(out, event.processIdx);
+        writeValue<std::int64_t>(out, event.sequence);
+    }
+    writeValue<std::uint64_t>(out, wakeups.size());
+    for (const SimEvent& wakeup : wakeups) {
+        writeValue<std::int32_t>(out, wakeup.time);
+        writeValue<std::int32_t>(out, wakeup.processIdx);
+    }
+    writeValue<std::uint64_t>(out, timeline.size());
+    for (const ExecutionEvent& event : timeline) {
+        writeValue<std::int32_t>(out, event.processId);
+        writeValue<std::int32_t>(out, event.startTime);
+        writeValue<std::int32_t>(out, event.endTime);
+        writeValue<std::uint8_t>(out, static_cast<std::uint8_t>(event.kind));
+        writeValue<std::uint16_t>(out, event.cpu);
+    }
+
+    writeValues(out, queued);
+    writeValues(out, queueState);
+    writeValues(out, agingState);
+    return static_cast<bool>(out);
+}
+
+bool SchedulerSnapshot::read(std::istream& in, SchedulerSnapshot& snapshot, std::string* error) {
+    SnapshotHeader header;
+    if (!readValue(in, header) ||
+        std::memcmp(header.magic, SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC)) != 0) {
+        return fail(error, "not a scheduler snapshot");
+    }
+    if (header.byteOrder != BYTE_ORDER_MARK) {
+        return fail(error, "snapshot has the wrong byte order");
+    }
+    if (header.version != SNAPSHOT_VERSION) {
+        return fail(error, "unsupported snapshot version " + std::to_string(header.version));
+    }
+    if (header.type > static_cast<std::uint32_t>(SchedulerType::SHORTEST_REMAINING_TIME)) {
+        return fail(error, "snapshot has an unknown scheduler type");
+    }
+
+    SchedulerSnapshot loaded;
+    loaded.type = static_cast<SchedulerType>(header.type);
+    std::uint64_t cursor = 0;
+    std::int64_t sequence = 0;
+    std::int32_t clocks[7];
+    if (!readValue(in, cursor) || !readValue(in, sequence) || !readValue(in, clocks)) {
+        return fail(error, "truncated snapshot");
+    }
+    loaded.arrivalCursor = static_cast<size_t>(cursor);
+    loaded.nextSequence = sequence;
+    loaded.currentTime = clocks[0];
+    loaded.contextSwitches = clocks[1];
+    loaded.serviceClock = clocks[2];
+    loaded.idleTime = clocks[3];
+    loaded.lastExecutionEnd = clocks[4];
+    loaded.running = clocks[5];
+    loaded.lastPid = clocks[6];
+
+    ProcessTable& table = loaded.processes;
+    std::string name;
+    for (std::uint64_t r = 0; r < header.rows; ++r) {
+        std::int32_t row[ROW_COLUMNS];
+        std::uint32_t length = 0;
+        if (!readValue(in, row) || !readValue(in, length)) {
+            return fail(error, "truncated snapshot");
+        }
+        if (length > MAX_NAME_LENGTH ||
+            row[12] < 0 || row[12] > static_cast<std::int32_t>(ProcessState::TERMINATED)) {
+            return fail(error, "corrupt process row " + std::to_string(r));
+        }
+        name.resize(length);
+        if (!in.read(&name[0], static_cast<std::streamsize>(length))) {
+            return fail(error, "truncated snapshot");
+        }
+        table.add(row[0], row[1], row[2], row[4], name);
+        const size_t i = table.size() - 1;
+        table.setRemainingTime(i, row[3]);
+        table.setWaitingTime(i, row[5]);
+        table.setTurnaroundTime(i, row[6]);
+        table.setResponseTime(i, row[7]);
+        table.setCompletionTime(i, row[8]);
+        table.setQueueLevel(i, row[9]);
+        table.setWaitStart(i, row[10]);
+        table.setHasStarted(i, row[11] != 0);
+        table.setState(i, static_cast<ProcessState>(row[12]));
+
+        std::uint32_t bursts = 0;
+        if (!readValue(in, bursts)) {
+            return fail(error, "truncated snapshot");
+        }
+        if (bursts > MAX_IO_BURSTS) {
+            return fail(error, "corrupt process row " + std::to_string(r));
+        }
+        for (std::uint32_t k = 0; k < bursts; ++k) {
+            std::int32_t burst[2];
+            if (!readValue(in, burst)) {
+                return fail(error, "truncated snapshot");
+            }
+            if (!table.addIoBurst(i, burst[0], burst[1])) {
+                return fail(error, "corrupt I/O burst of process row " + std::to_string(r));
+            }
+        }
+        std::int32_t ioNext = 0;
+        if (!readValue(in, ioNext)) {
+            return fail(error, "truncated snapshot");
+        }
+        if (ioNext < 0 || static_cast<std::uint32_t>(ioNext) > bursts) {
+            return fail(error, "corrupt process row " + std::to_string(r));
+        }
+        if (bursts > 0) {
+            table.setIoNext(i, ioNext);
+        }
+    }
+
+    std::uint64_t count = 0;
+    if (!readValue(in, count)) {
+        return fail(error, "truncated snapshot");
+    }
+    for (std::uint64_t e = 0; e < count; ++e) {
+        std::int32_t fields[3];
+        std::int64_t eventSequence = 0;
+        if (!readValue(in, fields) || !readValue(in, eventSequence)) {
+            return fail(error, "truncated snapshot");
+        }
+        if (fields[1] < 0 || fields[1] > static_cast<std::int32_t>(SimEventType::PRIORITY_BOOST)) {
+            return fail(error, "corrupt deadline " + std::to_string(e));
+        }
+        loaded.deadlines.push_back({fields[0], static_cast<SimEventType>(fields[1]), fields[2],
+                                   eventSequence});
+    }
+    if (!readValue(in, count)) {
+        return fail(error, "truncated snapshot");
+    }
+    for (std::uint64_t e = 0; e < count; ++e) {
+        std::int32_t fields[2];
+        if (!readValue(in, fields)) {
+            return fail(error, "truncated snapshot");
+        }
+        loaded.wakeups.push_back({fields[0], SimEventType::IO_COMPLETE, fields[1],
+                                 static_cast<long long>(e)});
+    }
+    if (!readValue(in, count)) {
+        return fail(error, "truncated snapshot");
+    }
+    for (std::uint64_t e = 0; e < count; ++e) {
+        std::int32_t fields[3];
+        std::uint8_t kind = 0;
+        std::uint16_t cpu = 0;
+        if (!readValue(in, fields) || !readValue(in, kind) || !readValue(in, cpu)) {
+            return fail(error, "truncated snapshot");
+        }
+        if (kind > static_cast<std::uint8_t>(EventKind::BLOCK)) {
+            return fail(error, "corrupt timeline event " + std::to_string(e));
+        }
+        ExecutionEvent event{fields[0], fields[1], fields[2], static_cast<EventKind>(kind), cpu};
+        loaded.timeline.push_back(event);
+    }
+
+    if (!readValues(in, loaded.queued) || !readValues(in, loaded.queueState) ||
+        !readValues(in, loaded.agingState)) {
+        return fail(error, "truncated snapshot");
+    }
+    snapshot = std::move(loaded);
+    return true;
+}
+
+bool SchedulerSnapshot::save(const std::string& filename, std::string* error) const {
+    std::ofstream out(filename, std::ios::binary);
+    if (!out.is_open()) {
+        return fail(error, "cannot open " + filename + " for writing");
+    }
+    if (!write(out)) {
+        return fail(error, "cannot write " + filename);
+    }
+    return true;
+}
+
+bool SchedulerSnapshot::load(const std::string& filename, SchedulerSnapshot& snapshot,
+                             std::string* error) {
+    std::ifstream in(filename, std::ios::binary);
+    if (!in.is_open()) {
+        return fail(error, "cannot open " + filename);
+    }
+    return read(in, snapshot, error);
+}
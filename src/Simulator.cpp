@@ -5,6 +5,16 @@
  */
 
 #include "Simulator.h"
+#include "ArrivalSource.h"
+#include "ThreadPool.h"
+#include "ParameterSweep.h"
+#include "WorkloadLoader.h"
+#include "TraceSink.h"
+#include "Benchmark.h"
+#include "ReplicaRunner.h"
+#include "WorkloadGenerator.h"
+#include "SchedulerEngine.h"
+#include "SchedulerSnapshot.h"
 #include <iostream>
 #include <fstream>
 #include <sstream>
@@ -13,6 +23,10 @@
 #include <algorithm>
 #include <random>
 #include <iomanip>
+#include <cctype>
+#include <climits>
+#include <stdexcept>
+#include <utility>
 
 Simulator::Simulator()
     : rng(std::random_device{}())
@@ -26,63 +40,174 @@ void Simulator::initialize(const SimulationConfig& simCfg,
     schedConfig = schedCfg;
 }
 
-std::vector<Process> Simulator::generateRandomProcesses(int count, int maxBurst,
-                                                         int maxArrival, int maxPriority) {
-    std::vector<Process> procs;
-    std::uniform_int_distribution<> burstDist(1, maxBurst);
-    std::uniform_int_distribution<> arrivalDist(0, maxArrival);
-    std::uniform_int_distribution<> priorityDist(0, maxPriority);
+/**
+ * @brief File-name friendly form of a scheduler name ("Round_Robin")
+ */
+static std::string traceSlug(const std::string& name) {
+    std::string slug;
+    for (char ch : name) {
+        if (std::isalnum(static_cast<unsigned char>(ch))) {
+            slug += ch;
+        } else if (!slug.empty() && slug.back() != '_') {
+            slug += '_';
+        }
+    }
+    while (!slug.empty() && slug.back() == '_') {
+        slug.pop_back();
+    }
+    return slug;
+}
+
+void Simulator::runScheduler(Scheduler& scheduler, std::ostream& out, std::ostream& err) {
+    // Open system: this run's own stream of arrivals after the static processes
+    std::unique_ptr<GeneratedArrivalSource> arrivals;
+    if (simConfig.dynamicArrivals) {
+        WorkloadSpec spec = simConfig.arrivalSpec;
+        spec.count = INT_MAX;
+        if (spec.arrivals == ArrivalPattern::UNIFORM) {
+            spec.arrivals = ArrivalPattern::POISSON;
+        }
+        const ProcessTable& table = scheduler.getProcessTable();
+        int firstPid = 0;
+        for (size_t i = 0; i < table.size() - scheduler.getInjectedCount(); ++i) {
+            firstPid = std::max(firstPid, table.getPid(i) + 1);
+        }
+        try {
+            arrivals = std::make_unique<GeneratedArrivalSource>(spec, firstPid);
+        } catch (const std::invalid_argument& e) {
+            err << "Error: " << e.what() << "\n";
+            return;
+        }
+        scheduler.setArrivalSource(arrivals.get(), simConfig.maxSimulationTime);
+    }
     
-    for (int i = 0; i < count; ++i) {
-        int burst = burstDist(rng);
-        int arrival = arrivalDist(rng);
-        int priority = priorityDist(rng);
-        
-        procs.emplace_back(i, priority, burst, arrival, "P" + std::to_string(i));
+    // Stream the run to <prefix>_<scheduler>_events.csv / _completions.csv
+    std::unique_ptr<std::ofstream> eventsFile;
+    std::unique_ptr<std::ofstream> completionsFile;
+    std::unique_ptr<CsvTraceSink> traceSink;
+    if (!simConfig.tracePrefix.empty()) {
+        std::string base = simConfig.tracePrefix + "_" + traceSlug(scheduler.getName());
+        eventsFile = std::make_unique<std::ofstream>(base + "_events.csv");
+        completionsFile = std::make_unique<std::ofstream>(base + "_completions.csv");
+        if (eventsFile->is_open() && completionsFile->is_open()) {
+            traceSink = std::make_unique<CsvTraceSink>(*eventsFile, *completionsFile);
+            scheduler.setTraceSink(traceSink.get());
+        } else {
+            err << "Warning: Cannot write trace files " << base << "_*.csv\n";
+        }
     }
     
-    return procs;
+    if (scheduler.getConfig().numCpus > 1 && !scheduler.supportsSmp()) {
+        err << "Warning: " << scheduler.getName() << " simulates a single CPU\n";
+    }
+    if (scheduler.getProcessTable().hasIo() && !scheduler.supportsIo()) {
+        err << "Warning: " << scheduler.getName() << " ignores I/O bursts; use --policy-engine\n";
+    }
+    
+    if (!simConfig.verifyEventEngine) {
+        scheduler.run();
+    } else {
+        std::string mismatch;
+        if (scheduler.verifyEventEngine(&mismatch)) {
+            out << "Event engine verified against tick-based run\n";
+        } else {
+            err << "Warning: " << mismatch << "\n";
+        }
+    }
+    
+    if (traceSink) {
+        scheduler.setTraceSink(nullptr);
+    }
+    if (arrivals) {
+        scheduler.setArrivalSource(nullptr);
+    }
 }
 
-Process* Simulator::dynamicArrivalCallback(int currentTime) {
-    // Simple probability-based arrival
-    std::uniform_real_distribution<> prob(0.0, 1.0);
-    if (prob(rng) < 0.1) {  // 10% chance of new process
-        static int nextPid = 100;
-        std::uniform_int_distribution<> burstDist(5, 20);
-        std::uniform_int_distribution<> priorityDist(0, 10);
-        
-        int burst = burstDist(rng);
-        int priority = priorityDist(rng);
-        
-        return new Process(nextPid++, priority, burst, currentTime);
+Metrics Simulator::simulateAndReport(Scheduler& scheduler, const Visualizer& view,
+                                     std::ostream& err) {
+    std::ostream& out = view.getOutputStream();
+    out << "\n";
+    view.displayHeader(scheduler.getName());
+    
+    loadAndRun(scheduler, out, err);
+    
+    // Display results
+    if (simConfig.showGanttChart) {
+        displayGantt(scheduler, view);
     }
-    return nullptr;
+    
+    if (simConfig.showMetrics) {
+        view.displayMetrics(scheduler.getMetrics());
+    }
+    
+    view.displayFooter();
+    return scheduler.getMetrics();
 }
 
-void Simulator::addScheduler(SchedulerType type) {
-    std::unique_ptr<Scheduler> scheduler;
+void Simulator::shareWorkload() {
+    if (!workload) {
+        workload = std::make_shared<const Workload>(baseProcesses);
+    }
+}
+
+void Simulator::loadAndRun(Scheduler& scheduler, std::ostream& out, std::ostream& err) {
+    // Reset scheduler, then load the shared processes into its own table
+    // (reusing its storage from the last run)
+    scheduler.reset();
+    scheduler.setWorkload(workload);
     
+    runScheduler(scheduler, out, err);
+}
+
+std::unique_ptr<Scheduler> Simulator::createScheduler(SchedulerType type,
+                                                      const SchedulerConfig& config) {
+    if (config.policyEngine) {
+        return createEngineScheduler(type, config);
+    }
     switch (type) {
         case SchedulerType::ROUND_ROBIN:
-            scheduler = std::make_unique<RoundRobinScheduler>(
-                schedConfig.timeQuantum, schedConfig);
-            break;
+            return std::make_unique<RoundRobinScheduler>(config.timeQuantum, config);
         case SchedulerType::PRIORITY_PREEMPTIVE:
-            scheduler = std::make_unique<PriorityScheduler>(true, schedConfig);
-            break;
+            return std::make_unique<PriorityScheduler>(true, config);
         case SchedulerType::PRIORITY_NON_PREEMPTIVE:
-            scheduler = std::make_unique<PriorityScheduler>(false, schedConfig);
-            break;
+            return std::make_unique<PriorityScheduler>(false, config);
         case SchedulerType::MULTILEVEL_QUEUE:
-            scheduler = std::make_unique<MultilevelQueueScheduler>(
-                schedConfig.numQueues, schedConfig);
-            break;
+            return std::make_unique<MultilevelQueueScheduler>(config.numQueues, config);
         case SchedulerType::MULTILEVEL_FEEDBACK_QUEUE:
-            scheduler = std::make_unique<MultilevelFeedbackQueueScheduler>(
-                schedConfig.numQueues, schedConfig);
+            return std::make_unique<MultilevelFeedbackQueueScheduler>(config.numQueues, config);
+        case SchedulerType::FAIR:
+        case SchedulerType::SHORTEST_JOB_FIRST:
+        case SchedulerType::SHORTEST_REMAINING_TIME:
+            // Composed from policies only; there is no classic class
+            return createEngineScheduler(type, config);
+    }
+    return nullptr;
+}
+
+std::vector<SchedulerType> Simulator::defaultAlgorithms() {
+    return {
+        SchedulerType::ROUND_ROBIN,
+        SchedulerType::PRIORITY_PREEMPTIVE,
+        SchedulerType::PRIORITY_NON_PREEMPTIVE,
+        SchedulerType::MULTILEVEL_QUEUE,
+        SchedulerType::MULTILEVEL_FEEDBACK_QUEUE,
+        SchedulerType::FAIR
+    };
+}
+
+SchedulerConfig Simulator::workloadConfig() const {
+    SchedulerConfig config = schedConfig;
+    for (const auto& p : baseProcesses) {
+        if (!p.getIoBursts().empty()) {
+            config.policyEngine = true;
             break;
+        }
     }
+    return config;
+}
+
+void Simulator::addScheduler(SchedulerType type) {
+    std::unique_ptr<Scheduler> scheduler = createScheduler(type, workloadConfig());
     
     if (scheduler) {
         schedulers.push_back(std::move(scheduler));
@@ -97,42 +222,52 @@ void Simulator::addScheduler(std::unique_ptr<Scheduler> scheduler) {
 
 void Simulator::setProcesses(const std::vector<Process>& processes) {
     baseProcesses = processes;
+    workload.reset();
+}
+
+void Simulator::setWorkload(std::shared_ptr<const Workload> shared) {
+    baseProcesses = shared ? shared->toProcesses() : std::vector<Process>();
+    workload = std::move(shared);
 }
 
 void Simulator::generateProcesses(int count) {
-    baseProcesses = generateRandomProcesses(count, 20, 10, 10);
+    WorkloadSpec spec;
+    spec.count = count;
+    spec.seed = rng();
+    generateProcesses(spec);
 }
 
-bool Simulator::loadProcessesFromFile(const std::string& filename) {
-    std::ifstream file(filename);
-    if (!file.is_open()) {
-        std::cerr << "Error: Cannot open file " << filename << std::endl;
+bool Simulator::generateProcesses(const WorkloadSpec& spec) {
+    try {
+        baseProcesses = WorkloadGenerator(spec).generateProcesses();
+        workload.reset();
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << "\n";
         return false;
     }
-    
-    baseProcesses.clear();
-    std::string line;
-    
-    // Skip header if present
-    std::getline(file, line);
-    if (line.find("PID") == std::string::npos) {
-        file.seekg(0);  // Reset if no header
-    }
-    
-    while (std::getline(file, line)) {
-        std::istringstream iss(line);
-        int pid, priority, burst, arrival;
-        
-        if (iss >> pid >> priority >> burst >> arrival) {
-            baseProcesses.emplace_back(pid, priority, burst, arrival);
-        }
+    return true;
+}
+
+bool Simulator::loadProcessesFromFile(const std::string& filename) {
+    size_t threads = static_cast<size_t>(std::max(0, simConfig.loadThreads));
+    std::string error;
+    workload.reset();
+    if (!WorkloadLoader::load(filename, baseProcesses, threads, &error)) {
+        std::cerr << "Error: Cannot load " << filename << ": " << error << std::endl;
+        return false;
     }
-    
-    file.close();
     return !baseProcesses.empty();
 }
 
-bool Simulator::saveProcessesToFile(const std::string& filename) const {
+bool Simulator::saveProcessesToFile(const std::string& filename, bool binary) const {
+    if (binary) {
+        if (!WorkloadLoader::saveBinary(filename, baseProcesses)) {
+            std::cerr << "Error: Cannot write to file " << filename << std::endl;
+            return false;
+        }
+        return true;
+    }
+    
     std::ofstream file(filename);
     if (!file.is_open()) {
         std::cerr << "Error: Cannot write to file " << filename << std::endl;
@@ -142,47 +277,164 @@ bool Simulator::saveProcessesToFile(const std::string& filename) const {
     file << "PID Priority BurstTime ArrivalTime\n";
     for (const auto& p : baseProcesses) {
         file << p.getPid() << " " << p.getPriority() << " " 
-             << p.getBurstTime() << " " << p.getArrivalTime() << "\n";
+             << p.getBurstTime() << " " << p.getArrivalTime();
+        for (const IoBurst& burst : p.getIoBursts()) {
+            file << " " << burst.after << ":" << burst.length;
+        }
+        file << "\n";
     }
     
     file.close();
     return true;
 }
 
+void Simulator::forEachScheduler(const std::function<void(size_t)>& task) {
+    if (!simConfig.parallelComparison || schedulers.size() < 2) {
+        for (size_t i = 0; i < schedulers.size(); ++i) {
+            task(i);
+        }
+        return;
+    }
+    
+    // Schedulers share no state, so each can run on its own worker
+    size_t threads = simConfig.workerThreads > 0 ? 
+                     static_cast<size_t>(simConfig.workerThreads) : 
+                     ThreadPool::defaultThreadCount();
+    ThreadPool pool(std::min(threads, schedulers.size()));
+    std::vector<std::future<void>> pending;
+    
+    for (size_t i = 0; i < schedulers.size(); ++i) {
+        pending.push_back(pool.submit([&task, i]() { task(i); }));
+    }
+    for (auto& result : pending) {
+        result.get();
+    }
+}
+
 void Simulator::runAll() {
-    if (baseProcesses.empty()) {
+    if (baseProcesses.empty() && !simConfig.dynamicArrivals) {
         std::cerr << "Error: No processes to simulate\n";
         return;
     }
+    shareWorkload();
     
-    results.clear();
-    
-    for (auto& scheduler : schedulers) {
-        std::cout << "\n";
-        visualizer->displayHeader(scheduler->getName());
-        
-        // Clear and reset scheduler, then add fresh processes
-        scheduler->clearProcesses();
-        scheduler->reset();
-        for (const auto& p : baseProcesses) {
-            scheduler->addProcess(p);
+    if (simConfig.headless) {
+        for (const RunResult& run : runBatch()) {
+            std::cerr << run.messages;
         }
-        
-        // Run simulation
-        scheduler->run();
-        
-        // Display results
-        if (simConfig.showGanttChart) {
-            visualizer->displayGanttChart(scheduler->getTimeline());
+        return;
+    }
+    
+    results.assign(schedulers.size(), Metrics());
+    
+    if (!simConfig.parallelComparison || schedulers.size() < 2) {
+        for (size_t i = 0; i < schedulers.size(); ++i) {
+            results[i] = simulateAndReport(*schedulers[i], *visualizer, std::cerr);
         }
-        
-        if (simConfig.showMetrics) {
-            visualizer->displayMetrics(scheduler->getMetrics());
+        return;
+    }
+    
+    // Each parallel run reports into its own buffers
+    struct Report {
+        std::ostringstream out;
+        std::ostringstream err;
+    };
+    std::vector<Report> reports(schedulers.size());
+    forEachScheduler([this, &reports](size_t i) {
+        Visualizer view(*visualizer);
+        view.setOutputStream(reports[i].out);
+        results[i] = simulateAndReport(*schedulers[i], view, reports[i].err);
+    });
+    
+    // Print in scheduler order, as a sequential run would
+    for (const auto& report : reports) {
+        std::cout << report.out.str();
+        std::cerr << report.err.str();
+    }
+}
+
+std::vector<RunResult> Simulator::runBatch() {
+    results.assign(schedulers.size(), Metrics());
+    if (baseProcesses.empty() && !simConfig.dynamicArrivals) {
+        return {};
+    }
+    shareWorkload();
+    
+    std::vector<RunResult> batch(schedulers.size());
+    forEachScheduler([this, &batch](size_t i) {
+        std::ostringstream messages;
+        loadAndRun(*schedulers[i], messages, messages);
+        batch[i].schedulerName = schedulers[i]->getName();
+        batch[i].metrics = schedulers[i]->getMetrics();
+        batch[i].messages = messages.str();
+        results[i] = batch[i].metrics;
+    });
+    return batch;
+}
+
+void Simulator::recordLastResult() {
+    results.resize(schedulers.size());
+    results.back() = schedulers.back()->getMetrics();
+}
+
+bool Simulator::runToSnapshot(SchedulerType type, int pauseAt, const std::string& filename) {
+    std::ostream& out = simConfig.headless ? std::cerr : std::cout;
+    std::unique_ptr<Scheduler> scheduler;
+    try {
+        scheduler = createEngineScheduler(type, schedConfig);
+    } catch (const std::invalid_argument& e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return false;
+    }
+    for (const auto& p : baseProcesses) {
+        scheduler->addProcess(p);
+    }
+    
+    if (scheduler->runUntil(pauseAt)) {
+        out << scheduler->getName() << " finished at time " << scheduler->getCurrentTime()
+            << ", before the pause; no snapshot written\n";
+        addScheduler(std::move(scheduler));
+        recordLastResult();
+        if (!simConfig.headless) {
+            displayRun(*schedulers.back());
         }
-        
-        results.push_back(scheduler->getMetrics());
-        visualizer->displayFooter();
+        return true;
+    }
+    
+    std::string error;
+    if (!scheduler->snapshot().save(filename, &error)) {
+        std::cerr << "Error: " << error << std::endl;
+        return false;
     }
+    out << scheduler->getName() << " paused at time " << scheduler->getCurrentTime()
+        << "; snapshot saved to " << filename << "\n";
+    return true;
+}
+
+bool Simulator::resumeSnapshot(const std::string& filename) {
+    SchedulerSnapshot snapshot;
+    std::string error;
+    if (!SchedulerSnapshot::load(filename, snapshot, &error)) {
+        std::cerr << "Error: Cannot load " << filename << ": " << error << std::endl;
+        return false;
+    }
+    
+    try {
+        std::unique_ptr<Scheduler> scheduler = createEngineScheduler(snapshot.type, schedConfig);
+        scheduler->resume(snapshot);
+        addScheduler(std::move(scheduler));
+    } catch (const std::invalid_argument& e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return false;
+    }
+    (simConfig.headless ? std::cerr : std::cout)
+        << "Resumed " << schedulers.back()->getName() << " at time " << snapshot.currentTime
+        << "\n";
+    recordLastResult();
+    if (!simConfig.headless) {
+        displayRun(*schedulers.back());
+    }
+    return true;
 }
 
 void Simulator::run(SchedulerType type) {
@@ -193,36 +445,165 @@ void Simulator::run(SchedulerType type) {
         for (const auto& p : baseProcesses) {
             scheduler->addProcess(p);
         }
-        scheduler->run();
-        
-        visualizer->displayHeader(scheduler->getName());
-        if (simConfig.showGanttChart) {
-            visualizer->displayGanttChart(scheduler->getTimeline());
+        runScheduler(*scheduler, simConfig.headless ? std::cerr : std::cout, std::cerr);
+        recordLastResult();
+        if (!simConfig.headless) {
+            displayRun(*scheduler);
         }
-        if (simConfig.showMetrics) {
-            visualizer->displayMetrics(scheduler->getMetrics());
+    }
+}
+
+bool Simulator::runStreaming(SchedulerType type, const std::string& filename) {
+    addScheduler(type);
+    auto& scheduler = schedulers.back();
+    scheduler->reset();
+    
+    if (WorkloadLoader::isBinary(filename)) {
+        ProcessTable table;
+        std::string error;
+        if (!WorkloadLoader::loadBinary(filename, table, &error)) {
+            std::cerr << "Error: Cannot load " << filename << ": " << error << std::endl;
+            return false;
         }
-        visualizer->displayFooter();
+        scheduler->setProcessTable(std::move(table));
+    } else {
+        WorkloadReader reader(filename);
+        if (!reader.isOpen()) {
+            std::cerr << "Error: Cannot open file " << filename << std::endl;
+            return false;
+        }
+        Process process;
+        while (reader.next(process)) {
+            scheduler->addProcess(process);
+        }
+    }
+    if (scheduler->getProcessTable().empty()) {
+        std::cerr << "Error: No processes in " << filename << std::endl;
+        return false;
+    }
+    
+    runScheduler(*scheduler, simConfig.headless ? std::cerr : std::cout, std::cerr);
+    recordLastResult();
+    if (!simConfig.headless) {
+        displayRun(*scheduler);
     }
+    return true;
+}
+
+void Simulator::displayRun(const Scheduler& scheduler) const {
+    visualizer->displayHeader(scheduler.getName());
+    if (simConfig.showGanttChart) {
+        displayGantt(scheduler, *visualizer);
+    }
+    if (simConfig.showMetrics) {
+        visualizer->displayMetrics(scheduler.getMetrics());
+    }
+    visualizer->displayFooter();
+}
+
+void Simulator::displayGantt(const Scheduler& scheduler, const Visualizer& view) const {
+    // Lanes per CPU only where the scheduler really ran on several
+    const int cpus = scheduler.supportsSmp() ?
+                     std::min(std::max(scheduler.getConfig().numCpus, 1), 65536) : 1;
+    view.displayGanttWindow(scheduler.getTimeline(), simConfig.ganttStart, simConfig.ganttEnd,
+                            cpus);
 }
 
 void Simulator::runComparison() {
     if (schedulers.empty()) {
         // Add all scheduler types for comparison
-        addScheduler(SchedulerType::ROUND_ROBIN);
-        addScheduler(SchedulerType::PRIORITY_PREEMPTIVE);
-        addScheduler(SchedulerType::PRIORITY_NON_PREEMPTIVE);
-        addScheduler(SchedulerType::MULTILEVEL_QUEUE);
-        addScheduler(SchedulerType::MULTILEVEL_FEEDBACK_QUEUE);
+        for (SchedulerType type : defaultAlgorithms()) {
+            addScheduler(type);
+        }
     }
     
     runAll();
+    if (simConfig.headless) {
+        return;
+    }
     
     // Display comparison
     std::vector<std::string> names = getSchedulerNames();
     visualizer->displayComparison(names, results);
 }
 
+bool Simulator::runSweep(const SweepSpace& space, const SweepOptions& options,
+                         const std::string& filename) {
+    if (baseProcesses.empty()) {
+        std::cerr << "Error: No processes to simulate\n";
+        return false;
+    }
+    
+    std::vector<SweepResult> sweepResults;
+    try {
+        ParameterSweep sweep(baseProcesses, workloadConfig(), space, options);
+        if (!simConfig.headless) {
+            std::cout << "Sweeping " << sweep.generatePoints().size() << " configurations x "
+                      << sweep.getAlgorithms().size() << " algorithms...\n";
+        }
+        sweepResults = sweep.run();
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << "\n";
+        return false;
+    }
+    
+    if (filename.empty()) {
+        ParameterSweep::writeTable(std::cout, sweepResults);
+        return true;
+    }
+    
+    std::ofstream file(filename);
+    if (!file.is_open()) {
+        std::cerr << "Error: Cannot write to " << filename << std::endl;
+        return false;
+    }
+    ParameterSweep::writeTable(file, sweepResults);
+    if (!simConfig.headless) {
+        std::cout << "Sweep results (" << sweepResults.size() << " rows) exported to " 
+                  << filename << std::endl;
+    }
+    return true;
+}
+
+bool Simulator::runReplicas(const WorkloadSpec& spec, const ReplicaOptions& options,
+                            const std::string& filename) {
+    std::vector<ReplicaResult> replicaResults;
+    try {
+        ReplicaRunner runner(spec, schedConfig, options);
+        if (simConfig.headless) {
+            // Only the table, on standard output unless a file is given
+            replicaResults = runner.run();
+            if (filename.empty()) {
+                runner.writeTable(std::cout, replicaResults);
+                return true;
+            }
+        } else {
+            std::cout << "Replicating " << runner.getAlgorithms().size() << " algorithms on "
+                      << spec.count << "-process workloads from seed " << spec.seed
+                      << " (up to " << options.maxReplicas << " replicas)...\n";
+            replicaResults = runner.run(&std::cout);
+            runner.printSummary(std::cout, replicaResults);
+            if (filename.empty()) {
+                return true;
+            }
+        }
+        std::ofstream file(filename);
+        if (!file.is_open()) {
+            std::cerr << "Error: Cannot write to " << filename << std::endl;
+            return false;
+        }
+        runner.writeTable(file, replicaResults);
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << "\n";
+        return false;
+    }
+    if (!simConfig.headless) {
+        std::cout << "Replica results (" << replicaResults.size() << " rows) exported to "
+                  << filename << std::endl;
+    }
+    return true;
+}
+
 void Simulator::exportResults(const std::string& filename) const {
     std::ofstream file(filename);
     if (!file.is_open()) {
@@ -230,22 +611,27 @@ void Simulator::exportResults(const std::string& filename) const {
         return;
     }
     
-    file << "Algorithm,AvgWaitTime,AvgTurnaroundTime,AvgResponseTime,"
-         << "CPUUtilization,Throughput,ContextSwitches\n";
+    writeResults(file);
+    file.close();
+    if (!simConfig.headless) {
+        std::cout << "Results exported to " << filename << std::endl;
+    }
+}
+
+void Simulator::writeResults(std::ostream& out) const {
+    out << "Algorithm,AvgWaitTime,AvgTurnaroundTime,AvgResponseTime,"
+        << "CPUUtilization,Throughput,ContextSwitches\n";
     
     for (size_t i = 0; i < schedulers.size() && i < results.size(); ++i) {
         const auto& metrics = results[i];
-        file << schedulers[i]->getName() << ","
-             << metrics.getAvgWaitingTime() << ","
-             << metrics.getAvgTurnaroundTime() << ","
-             << metrics.getAvgResponseTime() << ","
-             << metrics.getCpuUtilization() << ","
-             << metrics.getThroughput() << ","
-             << metrics.getTotalContextSwitches() << "\n";
+        out << schedulers[i]->getName() << ","
+            << metrics.getAvgWaitingTime() << ","
+            << metrics.getAvgTurnaroundTime() << ","
+            << metrics.getAvgResponseTime() << ","
+            << metrics.getCpuUtilization() << ","
+            << metrics.getThroughput() << ","
+            << metrics.getTotalContextSwitches() << "\n";
     }
-    
-    file.close();
-    std::cout << "Results exported to " << filename << std::endl;
 }
 
 void Simulator::interactiveMenu() {
@@ -300,6 +686,7 @@ void Simulator::interactiveMenu() {
                 std::cout << "Enter process details (PID Priority Burst Arrival): ";
                 std::cin >> pid >> priority >> burst >> arrival;
                 baseProcesses.emplace_back(pid, priority, burst, arrival);
+                workload.reset();
                 std::cout << "Process added.\n";
                 break;
             }
@@ -346,7 +733,7 @@ void Simulator::interactiveMenu() {
                 break;
             }
             case 13:
-                runBenchmark(5);
+                runBenchmark(BenchmarkOptions());
                 break;
             default:
                 std::cout << "Invalid choice. Try again.\n";
@@ -354,33 +741,41 @@ void Simulator::interactiveMenu() {
     }
 }
 
-void Simulator::runBenchmark(int iterations) {
-    std::cout << "\n╔══════════════════════════════════════════════════════════════╗\n";
-    std::cout << "║              PERFORMANCE BENCHMARK                           ║\n";
-    std::cout << "╚══════════════════════════════════════════════════════════════╝\n";
-    
-    std::vector<int> processCounts = {5, 10, 20, 50, 100};
+bool Simulator::runBenchmark(const BenchmarkOptions& options, const std::string& filename) {
+    if (!simConfig.headless) {
+        std::cout << "\n╔══════════════════════════════════════════════════════════════╗\n";
+        std::cout << "║              PERFORMANCE BENCHMARK                           ║\n";
+        std::cout << "╚══════════════════════════════════════════════════════════════╝\n";
+    }
     
-    for (int count : processCounts) {
-        std::cout << "\nBenchmarking with " << count << " processes...\n";
-        
-        generateProcesses(count);
-        schedulers.clear();
-        results.clear();
-        
-        addScheduler(SchedulerType::ROUND_ROBIN);
-        addScheduler(SchedulerType::PRIORITY_PREEMPTIVE);
-        addScheduler(SchedulerType::MULTILEVEL_FEEDBACK_QUEUE);
-        
-        auto start = std::chrono::high_resolution_clock::now();
-        runAll();
-        auto end = std::chrono::high_resolution_clock::now();
-        
-        auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(
-            end - start).count();
+    std::vector<BenchmarkResult> benchResults;
+    try {
+        Benchmark benchmark(schedConfig, options);
+        if (!simConfig.headless) {
+            std::cout << "Seed " << options.seed << ", " << options.warmupRuns << " warmup + "
+                      << options.iterations << " timed runs per algorithm and size\n";
+        }
+        benchResults = benchmark.run(simConfig.headless ? nullptr : &std::cout);
         
-        std::cout << "Completed in " << duration << " ms\n";
+        if (filename.empty()) {
+            benchmark.writeJson(std::cout, benchResults);
+            return true;
+        }
+        std::ofstream file(filename);
+        if (!file.is_open()) {
+            std::cerr << "Error: Cannot write to " << filename << std::endl;
+            return false;
+        }
+        benchmark.writeJson(file, benchResults);
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << "\n";
+        return false;
+    }
+    if (!simConfig.headless) {
+        std::cout << "Benchmark results (" << benchResults.size() << " entries) exported to "
+                  << filename << std::endl;
     }
+    return true;
 }
 
 void Simulator::setColorMode(bool useColor) {
@@ -401,13 +796,20 @@ void Simulator::reset() {
     schedulers.clear();
     results.clear();
     baseProcesses.clear();
+    workload.reset();
 }
 
 void Simulator::printSummary() const {
+    // Dynamic arrivals add processes beyond the base set during the runs
+    size_t totalProcesses = baseProcesses.size();
+    for (const auto& scheduler : schedulers) {
+        totalProcesses = std::max(totalProcesses, scheduler->getProcessTable().size());
+    }
+    
     std::cout << "\n╔══════════════════════════════════════════════════════════════╗\n";
     std::cout << "║                  SIMULATION SUMMARY                          ║\n";
     std::cout << "╠══════════════════════════════════════════════════════════════╣\n";
-    std::cout << "║ Total Processes:     " << std::setw(10) << baseProcesses.size() 
+    std::cout << "║ Total Processes:     " << std::setw(10) << totalProcesses 
               << "                              ║\n";
     std::cout << "║ Schedulers Run:      " << std::setw(10) << schedulers.size() 
               << "                              ║\n";
@@ -0,0 +1,257 @@
+/**
+ * @file Statistics.cpp
+ * @brief Implementation of the running statistics and quantile sketch
+ * @version 1.0
+ */
+
+#include "Statistics.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+RunningStats::RunningStats() {
+    clear();
+}
+
+void RunningStats::clear() {
+    count = 0;
+    sum = 0;
+    minValue = 0;
+    maxValue = 0;
+    mean = 0.0;
+    m2 = 0.0;
+}
+
+void RunningStats::add(int value) {
+    minValue = (count == 0) ? value : std::min(minValue, value);
+    maxValue = (count == 0) ? value : std::max(maxValue, value);
+    count++;
+    sum += value;
+    double delta = value - mean;
+    mean += delta / count;
+    m2 += delta * (value - mean);
+}
+
+void RunningStats::merge(const RunningStats& other) {
+    if (other.count == 0) {
+        return;
+    }
+    if (count == 0) {
+        *this = other;
+        return;
+    }
+    long long combined = count + other.count;
+    double delta = other.mean - mean;
+    mean += delta * other.count / combined;
+    m2 += other.m2 + delta * delta * (static_cast<double>(count) * other.count / combined);
+    count = combined;
+    sum += other.sum;
+    minValue = std::min(minValue, other.minValue);
+    maxValue = std::max(maxValue, other.maxValue);
+}
+
+double RunningStats::getVariance() const {
+    return count < 2 ? 0.0 : m2 / (count - 1);
+}
+
+SampleStats::SampleStats()
+    : count(0)
+    , mean(0.0)
+    , m2(0.0)
+{}
+
+void SampleStats::add(double value) {
+    count++;
+    double delta = value - mean;
+    mean += delta / count;
+    m2 += delta * (value - mean);
+}
+
+void SampleStats::merge(const SampleStats& other) {
+    if (other.count == 0) {
+        return;
+    }
+    if (count == 0) {
+        *this = other;
+        return;
+    }
+    long long combined = count + other.count;
+    double delta = other.mean - mean;
+    mean += delta * other.count / combined;
+    m2 += other.m2 + delta * delta * (static_cast<double>(count) * other.count / combined);
+    count = combined;
+}
+
+double SampleStats::getVariance() const {
+    return count < 2 ? 0.0 : m2 / (count - 1);
+}
+
+double SampleStats::halfWidth(double confidence) const {
+    if (count < 2) {
+        return std::numeric_limits<double>::infinity();
+    }
+    double t = tQuantile(0.5 + confidence / 2.0, count - 1);
+    return t * std::sqrt(getVariance() / count);
+}
+
+/**
+ * @brief Continued fraction of the regularized incomplete beta function
+ *
+ * Modified Lentz evaluation, converging quickly for x < (a + 1) / (a + b + 2).
+ */
+static double betaFraction(double a, double b, double x) {
+    const double tiny = 1e-300;
+    double c = 1.0;
+    double d = 1.0 - (a + b) * x / (a + 1.0);
+    d = 1.0 / (std::fabs(d) < tiny ? tiny : d);
+    double h = d;
+    for (int m = 1; m <= 300; ++m) {
+        for (int step = 0; step < 2; ++step) {
+            double coefficient = step == 0 ?
+                m * (b - m) * x / ((a + 2 * m - 1) * (a + 2 * m)) :
+                -(a + m) * (a + b + m) * x / ((a + 2 * m) * (a + 2 * m + 1));
+            d = 1.0 + coefficient * d;
+            d = 1.0 / (std::fabs(d) < tiny ? tiny : d);
+            c = 1.0 + coefficient / c;
+            c = std::fabs(c) < tiny ? tiny : c;
+            h *= d * c;
+        }
+        if (std::fabs(d * c - 1.0) < 1e-15) {
+            break;
+        }
+    }
+    return h;
+}
+
+/**
+ * @brief Regularized incomplete beta function I_x(a, b)
+ */
+static double incompleteBeta(double a, double b, double x) {
+    if (x <= 0.0) {
+        return 0.0;
+    }
+    if (x >= 1.0) {
+        return 1.0;
+    }
+    double front = std::exp(std::lgamma(a + b) - std::lgamma(a) - std::lgamma(b) +
+                            a * std::log(x) + b * std::log1p(-x));
+    if (x < (a + 1.0) / (a + b + 2.0)) {
+        return front * betaFraction(a, b, x) / a;
+    }
+    return 1.0 - front * betaFraction(b, a, 1.0 - x) / b;
+}
+
+double SampleStats::tQuantile(double probability, long long degrees) {
+    if (probability == 0.5) {
+        return 0.0;
+    }
+    if (probability < 0.5) {
+        return -tQuantile(1.0 - probability, degrees);
+    }
+    const double nu = static_cast<double>(degrees);
+    // P(T <= t) for t >= 0
+    auto cdf = [nu](double t) {
+        return 1.0 - 0.5 * incompleteBeta(nu / 2.0, 0.5, nu / (nu + t * t));
+    };
+    double low = 0.0;
+    double high = 1.0;
+    while (cdf(high) < probability && high < 1e12) {
+        low = high;
+        high *= 2.0;
+    }
+    for (int i = 0; i < 100 && high - low > 1e-12 * high; ++i) {
+        double middle = (low + high) / 2.0;
+        if (cdf(middle) < probability) {
+            low = middle;
+        } else {
+            high = middle;
+        }
+    }
+    return (low + high) / 2.0;
+}
+
+QuantileSketch::QuantileSketch()
+    : total(0)
+{}
+
+size_t QuantileSketch::bucketOf(int value) {
+    if (value < SUB_BUCKETS) {
+        return value < 0 ? 0 : static_cast<size_t>(value);
+    }
+    // Shift the value down until it lies in [SUB_BUCKETS / 2, SUB_BUCKETS)
+    int shift = 0;
+    unsigned int scaled = static_cast<unsigned int>(value);
+    while (scaled >= static_cast<unsigned int>(SUB_BUCKETS)) {
+        scaled >>= 1;
+        shift++;
+    }
+    return SUB_BUCKETS + static_cast<size_t>(shift - 1) * (SUB_BUCKETS / 2) +
+           (scaled - SUB_BUCKETS / 2);
+}
+
+int QuantileSketch::bucketLowerBound(size_t bucket) {
+    if (bucket < static_cast<size_t>(SUB_BUCKETS)) {
+        return static_cast<int>(bucket);
+    }
+    size_t offset = bucket - SUB_BUCKETS;
+    int shift = static_cast<int>(offset / (SUB_BUCKETS / 2)) + 1;
+    int mantissa = static_cast<int>(offset % (SUB_BUCKETS / 2)) + SUB_BUCKETS / 2;
+    return mantissa << shift;
+}
+
+void QuantileSketch::clear() {
+    counts.clear();
+    total = 0;
+}
+
+void QuantileSketch::add(int value) {
+    size_t bucket = bucketOf(value);
+    if (bucket >= counts.size()) {
+        counts.resize(bucket + 1, 0);
+    }
+    counts[bucket]++;
+    total++;
+}
+
+void QuantileSketch::merge(const QuantileSketch& other) {
+    if (other.counts.size() > counts.size()) {
+        counts.resize(other.counts.size(), 0);
+    }
+    for (size_t i = 0; i < other.counts.size(); ++i) {
+        counts[i] += other.counts[i];
+    }
+    total += other.total;
+}
+
+int QuantileSketch::quantile(double fraction) const {
+    if (total == 0) {
+        return 0;
+    }
+    fraction = std::min(std::max(fraction, 0.0), 1.0);
+    std::uint64_t rank = static_cast<std::uint64_t>(std::ceil(fraction * total));
+    rank = std::max<std::uint64_t>(rank, 1);
+
+    std::uint64_t seen = 0;
+    for (size_t i = 0; i < counts.size(); ++i) {
+        seen += counts[i];
+        if (seen >= rank) {
+            return bucketLowerBound(i);
+        }
+    }
+    return bucketLowerBound(counts.size() - 1);
+}
+
+bool QuantileSketch::operator==(const QuantileSketch& other) const {
+    if (total != other.total) {
+        return false;
+    }
+    // Trailing empty buckets do not change the distribution
+    size_t common = std::min(counts.size(), other.counts.size());
+    if (!std::equal(counts.begin(), counts.begin() + common, other.counts.begin())) {
+        return false;
+    }
+    const std::vector<std::uint64_t>& longer =
+        counts.size() > other.counts.size() ? counts : other.counts;
+    return std::all_of(longer.begin() + common, longer.end(),
+                       [](std::uint64_t n) { return n == 0; });
+}
@@ -0,0 +1,62 @@
+/**
+ * @file ThreadPool.cpp
+ * @brief Implementation of the worker thread pool
+ * @version 1.0
+ */
+
+#include "ThreadPool.h"
+#include <memory>
+
+ThreadPool::ThreadPool(size_t threads)
+    : stopping(false)
+{
+    size_t count = (threads > 0) ? threads : defaultThreadCount();
+    workers.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        workers.emplace_back(&ThreadPool::workerLoop, this);
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    available.notify_all();
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
+
+size_t ThreadPool::defaultThreadCount() {
+    unsigned int hardware = std::thread::hardware_concurrency();
+    return hardware > 0 ? hardware : 1;
+}
+
+std::future<void> ThreadPool::submit(std::function<void()> task) {
+    // packaged_task is move-only; share it so the queue can hold a std::function
+    auto packaged = std::make_shared<std::packaged_task<void()>>(std::move(task));
+    std::future<void> result = packaged->get_future();
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        tasks.push([packaged]() { (*packaged)(); });
+    }
+    available.notify_one();
+    return result;
+}
+
+void ThreadPool::workerLoop() {
+    while (true) {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            available.wait(lock, [this]() { return stopping || !tasks.empty(); });
+            if (tasks.empty()) {
+                return;
+            }
+            task = std::move(tasks.front());
+            tasks.pop();
+        }
+        task();
+    }
+}
@@ -0,0 +1,150 @@
+/**
+ * @file TraceSink.cpp
+ * @brief Implementation of the CSV, binary and callback trace sinks
+ * @version 1.0
+ */
+
+#include "TraceSink.h"
+#include <initializer_list>
+#include <utility>
+
+/**
+ * @brief Column value for an event kind
+ */
+static const char* kindName(EventKind kind) {
+    switch (kind) {
+        case EventKind::CONTEXT_SWITCH: return "CONTEXT_SWITCH";
+        case EventKind::IDLE: return "IDLE";
+        case EventKind::PREEMPT: return "PREEMPT";
+        case EventKind::DEMOTE: return "DEMOTE";
+        case EventKind::BLOCK: return "BLOCK";
+        case EventKind::EXECUTE: break;
+    }
+    return "EXECUTE";
+}
+
+/**
+ * @brief Append comma-separated integers to a CSV row
+ */
+static void appendValues(std::string& buffer, std::initializer_list<int> values) {
+    bool first = true;
+    for (int value : values) {
+        if (!first) {
+            buffer += ',';
+        }
+        buffer += std::to_string(value);
+        first = false;
+    }
+}
+
+CsvTraceSink::CsvTraceSink(std::ostream& eventsOut, std::ostream& completionsOut,
+                           size_t bufferBytes)
+    : eventsOut(eventsOut)
+    , completionsOut(completionsOut)
+    , bufferBytes(bufferBytes)
+{
+    eventBuffer.reserve(bufferBytes + 64);
+    completionBuffer.reserve(bufferBytes + 64);
+    eventsOut << "PID,Start,End,Kind\n";
+    completionsOut << "PID,Arrival,Burst,Completion,Turnaround,Waiting,Response\n";
+}
+
+CsvTraceSink::~CsvTraceSink() {
+    flush();
+}
+
+void CsvTraceSink::onEvent(const ExecutionEvent& event) {
+    appendValues(eventBuffer, {event.processId, event.startTime, event.endTime});
+    eventBuffer += ',';
+    eventBuffer += kindName(event.kind);
+    eventBuffer += '\n';
+    if (eventBuffer.size() >= bufferBytes) {
+        eventsOut.write(eventBuffer.data(), static_cast<std::streamsize>(eventBuffer.size()));
+        eventBuffer.clear();
+    }
+}
+
+void CsvTraceSink::onCompletion(const CompletionRecord& record) {
+    appendValues(completionBuffer, {record.processId, record.arrivalTime, record.burstTime,
+                                    record.completionTime, record.turnaroundTime,
+                                    record.waitingTime, record.responseTime});
+    completionBuffer += '\n';
+    if (completionBuffer.size() >= bufferBytes) {
+        completionsOut.write(completionBuffer.data(),
+                             static_cast<std::streamsize>(completionBuffer.size()));
+        completionBuffer.clear();
+    }
+}
+
+void CsvTraceSink::flush() {
+    eventsOut.write(eventBuffer.data(), static_cast<std::streamsize>(eventBuffer.size()));
+    completionsOut.write(completionBuffer.data(),
+                         static_cast<std::streamsize>(completionBuffer.size()));
+    eventBuffer.clear();
+    completionBuffer.clear();
+    eventsOut.flush();
+    completionsOut.flush();
+}
+
+BinaryTraceSink::BinaryTraceSink(std::ostream& eventsOut, std::ostream& completionsOut,
+                                 size_t batchSize)
+    : eventsOut(eventsOut)
+    , completionsOut(completionsOut)
+    , batchSize(batchSize > 0 ? batchSize : 1)
+{
+    eventBatch.reserve(this->batchSize);
+    completionBatch.reserve(this->batchSize);
+}
+
+BinaryTraceSink::~BinaryTraceSink() {
+    flush();
+}
+
+/**
+ * @brief Write a batch of trivially copyable records and empty it
+ */
+template<typename Record>
+static void writeBatch(std::ostream& out, std::vector<Record>& batch) {
+    out.write(reinterpret_cast<const char*>(batch.data()),
+              static_cast<std::streamsize>(batch.size() * sizeof(Record)));
+    batch.clear();
+}
+
+void BinaryTraceSink::onEvent(const ExecutionEvent& event) {
+    eventBatch.push_back(event);
+    if (eventBatch.size() >= batchSize) {
+        writeBatch(eventsOut, eventBatch);
+    }
+}
+
+void BinaryTraceSink::onCompletion(const CompletionRecord& record) {
+    completionBatch.push_back(record);
+    if (completionBatch.size() >= batchSize) {
+        writeBatch(completionsOut, completionBatch);
+    }
+}
+
+void BinaryTraceSink::flush() {
+    writeBatch(eventsOut, eventBatch);
+    writeBatch(completionsOut, completionBatch);
+    eventsOut.flush();
+    completionsOut.flush();
+}
+
+CallbackTraceSink::CallbackTraceSink(std::function<void(const ExecutionEvent&)> onEvent,
+                                     std::function<void(const CompletionRecord&)> onCompletion)
+    : eventCallback(std::move(onEvent))
+    , completionCallback(std::move(onCompletion))
+{}
+
+void CallbackTraceSink::onEvent(const ExecutionEvent& event) {
+    if (eventCallback) {
+        eventCallback(event);
+    }
+}
+
+void CallbackTraceSink::onCompletion(const CompletionRecord& record) {
+    if (completionCallback) {
+        completionCallback(record);
+    }
+}
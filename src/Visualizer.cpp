@@ -32,6 +32,7 @@ Visualizer::Visualizer(int width, bool useColors)
     , colorEnabled(useColors)
     , animationEnabled(false)
     , animationDelay(100)
+    , out(&std::cout)
 {}
 
 std::string Visualizer::getProcessColor(int pid) const {
@@ -50,70 +51,264 @@ void Visualizer::clearScreen() const {
 }
 
 void Visualizer::moveCursor(int row, int col) const {
-    std::cout << "\033[" << row << ";" << col << "H";
+    *out << "\033[" << row << ";" << col << "H";
 }
 
 void Visualizer::drawLine(int length, char ch) const {
     for (int i = 0; i < length; ++i) {
-        std::cout << ch;
+        *out << ch;
     }
-    std::cout << "\n";
+    *out << "\n";
 }
 
 void Visualizer::drawProgressBar(double progress, int barWidth) const {
     int filled = static_cast<int>(progress * barWidth);
-    std::cout << "[";
+    *out << "[";
     for (int i = 0; i < barWidth; ++i) {
         if (i < filled) {
-            std::cout << (colorEnabled ? GREEN : "") << "█" << RESET;
+            *out << (colorEnabled ? GREEN : "") << "█" << RESET;
         } else {
-            std::cout << "░";
+            *out << "░";
         }
     }
-    std::cout << "] " << std::fixed << std::setprecision(1) 
+    *out << "] " << std::fixed << std::setprecision(1) 
               << (progress * 100) << "%";
 }
 
-void Visualizer::displayGanttChart(const std::vector<ExecutionEvent>& timeline) const {
-    if (timeline.empty()) {
-        std::cout << "No execution timeline to display.\n";
-        return;
+/**
+ * @brief Lane a timeline event is drawn in (GanttBucket::IDLE, SWITCH or the pid)
+ */
+static int ganttOwner(const ExecutionEvent& event) {
+    if (event.isContextSwitch()) {
+        return GanttBucket::SWITCH;
     }
+    return event.processId >= 0 ? event.processId : GanttBucket::IDLE;
+}
+
+std::vector<GanttBucket> Visualizer::bucketTimeline(const std::vector<ExecutionEvent>& lane,
+                                                    int startTime, int endTime, int columns) {
+    // Events summed exactly per column; busier columns are sampled instead
+    const size_t maxExactEvents = 32;
+    const int samples = 32;
     
-    std::cout << "\n+--------------------------------------------------------------+\n";
-    std::cout << "|                      GANTT CHART                             |\n";
-    std::cout << "+--------------------------------------------------------------+\n";
+    std::vector<GanttBucket> buckets(static_cast<size_t>(std::max(columns, 0)),
+                                     GanttBucket{GanttBucket::IDLE, 0.0});
+    if (columns <= 0 || endTime <= startTime) {
+        return buckets;
+    }
+    const double span = static_cast<double>(endTime - startTime) / columns;
+    
+    // Events are sorted by start and disjoint, so also sorted by end
+    auto firstEndingAfter = [&lane](double time) {
+        return std::upper_bound(lane.begin(), lane.end(), time,
+                                [](double t, const ExecutionEvent& e) { return t < e.endTime; });
+    };
     
-    // Display process blocks
-    std::cout << "| ";
-    for (const auto& event : timeline) {
-        if (event.processId == -1) {
-            std::cout << "[IDLE]";
+    std::vector<std::pair<int, double>> tally;
+    for (int c = 0; c < columns; ++c) {
+        const double from = startTime + c * span;
+        const double to = from + span;
+        tally.clear();
+        auto add = [&tally](int owner, double time) {
+            for (auto& entry : tally) {
+                if (entry.first == owner) {
+                    entry.second += time;
+                    return;
+                }
+            }
+            tally.emplace_back(owner, time);
+        };
+        
+        size_t seen = 0;
+        auto it = firstEndingAfter(from);
+        for (; it != lane.end() && it->startTime < to; ++it) {
+            if (++seen > maxExactEvents) {
+                break;
+            }
+            double overlap = std::min<double>(to, it->endTime) -
+                             std::max<double>(from, it->startTime);
+            if (overlap > 0.0) {
+                add(ganttOwner(*it), overlap);
+            }
+        }
+        if (seen > maxExactEvents) {
+            tally.clear();
+            for (int k = 0; k < samples; ++k) {
+                const double t = from + (k + 0.5) * span / samples;
+                auto at = firstEndingAfter(t);
+                if (at != lane.end() && at->startTime <= t) {
+                    add(ganttOwner(*at), span / samples);
+                }
+            }
+        }
+        
+        // Time not covered by any event is idle
+        double covered = 0.0;
+        for (const auto& entry : tally) {
+            covered += entry.second;
+        }
+        add(GanttBucket::IDLE, std::max(0.0, span - covered));
+        
+        // Busy, switching or idle, whichever is longest; busy shows its longest pid
+        GanttBucket& bucket = buckets[static_cast<size_t>(c)];
+        double busy = 0.0;
+        double switching = 0.0;
+        double idle = 0.0;
+        double longest = -1.0;
+        int longestPid = GanttBucket::IDLE;
+        for (const auto& entry : tally) {
+            if (entry.first == GanttBucket::SWITCH) {
+                switching += entry.second;
+            } else if (entry.first == GanttBucket::IDLE) {
+                idle += entry.second;
+            } else {
+                busy += entry.second;
+                if (entry.second > longest) {
+                    longest = entry.second;
+                    longestPid = entry.first;
+                }
+            }
+        }
+        if (busy >= switching && busy >= idle && busy > 0.0) {
+            bucket.processId = longestPid;
+        } else if (switching > idle) {
+            bucket.processId = GanttBucket::SWITCH;
+        }
+        bucket.busyFraction = std::min(1.0, busy / span);
+    }
+    return buckets;
+}
+
+void Visualizer::drawGanttLane(const std::vector<GanttBucket>& buckets, const std::string& label,
+                               bool showLoad, std::vector<int>* runStarts) const {
+    *out << label;
+    size_t c = 0;
+    while (c < buckets.size()) {
+        const int owner = buckets[c].processId;
+        size_t end = c;
+        while (end < buckets.size() && buckets[end].processId == owner) {
+            end++;
+        }
+        const size_t length = end - c;
+        if (runStarts) {
+            runStarts->push_back(static_cast<int>(c));
+        }
+        
+        if (owner == GanttBucket::IDLE) {
+            *out << std::string(length, ' ');
+        } else if (owner == GanttBucket::SWITCH) {
+            *out << std::string(length, '.');
         } else {
-            std::cout << getProcessColor(event.processId) 
-                      << "[P" << event.processId << "]" << RESET;
+            // "[P12----" when the label fits, solid blocks otherwise
+            const std::string text = "[P" + std::to_string(owner);
+            *out << getProcessColor(owner);
+            if (length >= text.size()) {
+                *out << text << std::string(length - text.size(), '-');
+            } else {
+                for (size_t i = 0; i < length; ++i) {
+                    *out << "█";
+                }
+            }
+            *out << (colorEnabled ? RESET : "");
         }
+        c = end;
     }
-    std::cout << "\n";
+    *out << "\n";
     
-    // Display timeline
-    std::cout << "| ";
-    int currentPos = 0;
-    for (const auto& event : timeline) {
-        if (currentPos == 0) {
-            std::cout << event.startTime;
+    if (showLoad) {
+        static const char* const glyphs[] = {" ", "░", "▒", "▓", "█"};
+        *out << "|" << std::string(label.size() - 1, ' ');
+        for (const GanttBucket& bucket : buckets) {
+            const double busy = bucket.busyFraction;
+            const int level = busy <= 0.0 ? 0 : busy >= 1.0 ? 4 : 1 + static_cast<int>(busy * 3);
+            *out << glyphs[level];
         }
-        
-        int duration = event.endTime - event.startTime;
-        for (int i = 0; i < duration; ++i) {
-            std::cout << "-";
+        *out << " busy\n";
+    }
+}
+
+void Visualizer::displayGanttChart(const std::vector<ExecutionEvent>& timeline,
+                                   int cpuCount) const {
+    displayGanttWindow(timeline, 0, -1, cpuCount);
+}
+
+void Visualizer::displayGanttWindow(const std::vector<ExecutionEvent>& timeline, int startTime,
+                                    int endTime, int cpuCount) const {
+    if (timeline.empty()) {
+        *out << "No execution timeline to display.\n";
+        return;
+    }
+    
+    // SMP runs interleave CPUs in the timeline; split it into sorted lanes
+    std::vector<std::vector<ExecutionEvent>> lanes;
+    const std::vector<ExecutionEvent>* single = &timeline;
+    int horizon = timeline.back().endTime;
+    if (cpuCount > 1) {
+        lanes.resize(static_cast<size_t>(cpuCount));
+        horizon = 0;
+        for (const ExecutionEvent& event : timeline) {
+            if (event.cpu < lanes.size()) {
+                lanes[event.cpu].push_back(event);
+            }
+            horizon = std::max(horizon, event.endTime);
         }
-        std::cout << event.endTime;
-        currentPos = event.endTime;
+        single = nullptr;
+    }
+    if (endTime < 0) {
+        endTime = horizon;
     }
-    std::cout << "\n";
+    startTime = std::max(startTime, 0);
     
-    std::cout << "+--------------------------------------------------------------+\n";
+    *out << "\n+--------------------------------------------------------------+\n";
+    *out << "|                      GANTT CHART                             |\n";
+    *out << "+--------------------------------------------------------------+\n";
+    if (endTime <= startTime) {
+        *out << "| (empty window " << startTime << " to " << endTime << ")\n";
+        *out << "+--------------------------------------------------------------+\n";
+        return;
+    }
+    
+    // The window always fills the chart width
+    const std::string margin = single ? "| " : 
+        "| CPU" + std::string(std::to_string(cpuCount - 1).size() + 2, ' ');
+    const int columns = std::max(10, width - 2 - static_cast<int>(margin.size()));
+    const double unitsPerColumn = static_cast<double>(endTime - startTime) / columns;
+    
+    *out << "| Time " << startTime << " to " << endTime << ", " << std::defaultfloat
+         << std::setprecision(3) << unitsPerColumn << " time units per column\n";
+    
+    std::vector<int> runStarts;
+    if (single) {
+        drawGanttLane(bucketTimeline(*single, startTime, endTime, columns), margin,
+                      unitsPerColumn > 1.0, &runStarts);
+    } else {
+        for (size_t cpu = 0; cpu < lanes.size(); ++cpu) {
+            std::string label = "| CPU" + std::to_string(cpu);
+            label += std::string(margin.size() - label.size(), ' ');
+            drawGanttLane(bucketTimeline(lanes[cpu], startTime, endTime, columns), label,
+                          false, nullptr);
+        }
+        runStarts.push_back(0);
+    }
+    
+    // Time labels at run starts where they fit, and always at both ends
+    std::string axis(static_cast<size_t>(columns) + 1, ' ');
+    const std::string last = std::to_string(endTime);
+    const size_t lastAt = axis.size() >= last.size() ? axis.size() - last.size() : 0;
+    size_t freeFrom = 0;
+    for (int column : runStarts) {
+        const long long time = std::llround(startTime + column * unitsPerColumn);
+        const std::string text = std::to_string(time);
+        const size_t at = static_cast<size_t>(column);
+        if (at >= freeFrom && at + text.size() < lastAt) {
+            axis.replace(at, text.size(), text);
+            freeFrom = at + text.size() + 1;
+        }
+    }
+    axis.replace(lastAt, last.size(), last);
+    *out << std::string(margin.size(), ' ') << axis << "\n";
+    
+    *out << "+--------------------------------------------------------------+\n";
 }
 
 void Visualizer::displayCompactGanttChart(const std::vector<ExecutionEvent>& timeline,
@@ -121,105 +316,121 @@ void Visualizer::displayCompactGanttChart(const std::vector<ExecutionEvent>& tim
     if (timeline.empty()) return;
     
     int totalTime = timeline.back().endTime;
-    double scale = static_cast<double>(maxWidth) / totalTime;
     
-    std::cout << "\nCompact Gantt Chart (scaled):\n";
-    std::cout << "│";
+    *out << "\nCompact Gantt Chart (scaled):\n";
+    *out << "│";
     
-    for (const auto& event : timeline) {
-        int width = std::max(1, static_cast<int>((event.endTime - event.startTime) * scale));
-        std::string color = (event.processId == -1) ? "" : getProcessColor(event.processId);
-        
-        for (int i = 0; i < width; ++i) {
-            if (event.processId == -1) {
-                std::cout << " ";
-            } else {
-                std::cout << color << "█" << RESET;
-            }
+    for (const GanttBucket& bucket : bucketTimeline(timeline, 0, totalTime, maxWidth)) {
+        if (bucket.processId < 0) {
+            *out << " ";
+        } else {
+            *out << getProcessColor(bucket.processId) << "█" << RESET;
         }
     }
-    std::cout << "│\n";
-    std::cout << "0" << std::setw(maxWidth) << totalTime << "\n";
+    *out << "│\n";
+    *out << "0" << std::setw(maxWidth) << totalTime << "\n";
 }
 
 void Visualizer::displayReadyQueue(const std::vector<Process>& readyQueue) const {
-    std::cout << "\n+--------------------------------------------------------------+\n";
-    std::cout << "|                    READY QUEUE STATUS                        |\n";
-    std::cout << "+--------------------------------------------------------------+\n";
+    *out << "\n+--------------------------------------------------------------+\n";
+    *out << "|                    READY QUEUE STATUS                        |\n";
+    *out << "+--------------------------------------------------------------+\n";
     
     if (readyQueue.empty()) {
-        std::cout << "|                    (Queue is empty)                          |\n";
+        *out << "|                    (Queue is empty)                          |\n";
     } else {
-        std::cout << "| Processes: ";
+        *out << "| Processes: ";
         for (const auto& p : readyQueue) {
-            std::cout << getProcessColor(p.getPid()) 
+            *out << getProcessColor(p.getPid()) 
                       << "P" << p.getPid() << RESET << " ";
         }
-        std::cout << std::setw(40) << "|\n";
+        *out << std::setw(40) << "|\n";
     }
     
-    std::cout << "+--------------------------------------------------------------+\n";
+    *out << "+--------------------------------------------------------------+\n";
 }
 
 void Visualizer::displayCPUStatus(const Process* currentProcess, int currentTime) const {
-    std::cout << "\n+----------------------------------------+\n";
-    std::cout << "|         CPU STATUS                     |\n";
-    std::cout << "+----------------------------------------+\n";
-    std::cout << "| Time: " << std::setw(10) << currentTime << std::setw(22) << "|\n";
+    *out << "\n+----------------------------------------+\n";
+    *out << "|         CPU STATUS                     |\n";
+    *out << "+----------------------------------------+\n";
+    *out << "| Time: " << std::setw(10) << currentTime << std::setw(22) << "|\n";
     
     if (currentProcess) {
-        std::cout << "| Running: " << getProcessColor(currentProcess->getPid())
+        *out << "| Running: " << getProcessColor(currentProcess->getPid())
                   << "P" << currentProcess->getPid() << RESET 
                   << std::setw(26) << "|\n";
-        std::cout << "| Remaining: " << std::setw(5) << currentProcess->getRemainingTime() 
+        *out << "| Remaining: " << std::setw(5) << currentProcess->getRemainingTime() 
                   << std::setw(21) << "|\n";
     } else {
-        std::cout << "| Running: IDLE" << std::setw(23) << "|\n";
+        *out << "| Running: IDLE" << std::setw(23) << "|\n";
     }
     
-    std::cout << "+----------------------------------------+\n";
+    *out << "+----------------------------------------+\n";
 }
 
 void Visualizer::displayCPUUtilization(double utilization) const {
-    std::cout << "\nCPU Utilization: ";
+    *out << "\nCPU Utilization: ";
     drawProgressBar(utilization / 100.0, 40);
-    std::cout << "\n";
+    *out << "\n";
 }
 
-void Visualizer::displayProcessTable(const std::vector<Process>& processes) const {
-    std::cout << "\n+-----+----------+--------+-----------+------------+---------+\n";
-    std::cout << "| PID | Priority | Burst  |  Arrival  |   State    | Queue   |\n";
-    std::cout << "+-----+----------+--------+-----------+------------+---------+\n";
+void Visualizer::drawProcessTableHeader() const {
+    *out << "\n+-----+----------+--------+-----------+------------+---------+\n";
+    *out << "| PID | Priority | Burst  |  Arrival  |   State    | Queue   |\n";
+    *out << "+-----+----------+--------+-----------+------------+---------+\n";
+}
+
+void Visualizer::drawProcessTableFooter() const {
+    *out << "+-----+----------+--------+-----------+------------+---------+\n";
+}
+
+void Visualizer::drawProcessRow(int pid, int priority, int burstTime, int arrivalTime,
+                                ProcessState state, int queueLevel) const {
+    *out << "| " << std::setw(3) << pid 
+              << " | " << std::setw(8) << priority
+              << " | " << std::setw(6) << burstTime
+              << " | " << std::setw(9) << arrivalTime
+              << " | ";
     
-    for (const auto& p : processes) {
-        std::cout << "| " << std::setw(3) << p.getPid() 
-                  << " | " << std::setw(8) << p.getPriority()
-                  << " | " << std::setw(6) << p.getBurstTime()
-                  << " | " << std::setw(9) << p.getArrivalTime()
-                  << " | ";
-        
-        switch (p.getState()) {
-            case ProcessState::NEW:
-                std::cout << std::setw(10) << "NEW";
-                break;
-            case ProcessState::READY:
-                std::cout << colorEnabled << GREEN << std::setw(10) << "READY" << RESET;
-                break;
-            case ProcessState::RUNNING:
-                std::cout << colorEnabled << CYAN << std::setw(10) << "RUNNING" << RESET;
-                break;
-            case ProcessState::WAITING:
-                std::cout << colorEnabled << YELLOW << std::setw(10) << "WAITING" << RESET;
-                break;
-            case ProcessState::TERMINATED:
-                std::cout << colorEnabled << RED << std::setw(10) << "DONE" << RESET;
-                break;
-        }
-        
-        std::cout << " | " << std::setw(7) << p.getQueueLevel() << " |\n";
+    switch (state) {
+        case ProcessState::NEW:
+            *out << std::setw(10) << "NEW";
+            break;
+        case ProcessState::READY:
+            *out << colorEnabled << GREEN << std::setw(10) << "READY" << RESET;
+            break;
+        case ProcessState::RUNNING:
+            *out << colorEnabled << CYAN << std::setw(10) << "RUNNING" << RESET;
+            break;
+        case ProcessState::WAITING:
+            *out << colorEnabled << YELLOW << std::setw(10) << "WAITING" << RESET;
+            break;
+        case ProcessState::TERMINATED:
+            *out << colorEnabled << RED << std::setw(10) << "DONE" << RESET;
+            break;
     }
     
-    std::cout << "+-----+----------+--------+-----------+------------+---------+\n";
+    *out << " | " << std::setw(7) << queueLevel << " |\n";
+}
+
+void Visualizer::displayProcessTable(const std::vector<Process>& processes) const {
+    drawProcessTableHeader();
+    for (const auto& p : processes) {
+        drawProcessRow(p.getPid(), p.getPriority(), p.getBurstTime(),
+                       p.getArrivalTime(), p.getState(), p.getQueueLevel());
+    }
+    drawProcessTableFooter();
+}
+
+void Visualizer::displayProcessTable(const ProcessTable& processes) const {
+    drawProcessTableHeader();
+    for (size_t i = 0; i < processes.size(); ++i) {
+        drawProcessRow(processes.getPid(i), processes.getPriority(i),
+                       processes.getBurstTime(i), processes.getArrivalTime(i),
+                       processes.getState(i), processes.getQueueLevel(i));
+    }
+    drawProcessTableFooter();
 }
 
 void Visualizer::displayStateTransition(const Process& process,
@@ -237,55 +448,71 @@ void Visualizer::displayStateTransition(const Process& process,
         return "UNKNOWN";
     };
     
-    std::cout << "[Time " << time << "] " 
+    *out << "[Time " << time << "] " 
               << getProcessColor(process.getPid()) << "P" << process.getPid() << RESET
               << ": " << stateToString(fromState) << " → " << stateToString(toState) 
               << "\n";
 }
 
 void Visualizer::displayMetrics(const Metrics& metrics) const {
-    std::cout << "\n+--------------------------------------------------------------+\n";
-    std::cout << "|               PERFORMANCE METRICS                            |\n";
-    std::cout << "+--------------------------------------------------------------+\n";
-    std::cout << "| Processes:              " << std::setw(10) << metrics.getProcessCount() 
+    *out << "\n+--------------------------------------------------------------+\n";
+    *out << "|               PERFORMANCE METRICS                            |\n";
+    *out << "+--------------------------------------------------------------+\n";
+    *out << "| Processes:              " << std::setw(10) << metrics.getProcessCount() 
               << "                        |\n";
-    std::cout << "| Total Execution Time:   " << std::setw(10) << metrics.getTotalExecutionTime() 
+    *out << "| Total Execution Time:   " << std::setw(10) << metrics.getTotalExecutionTime() 
               << " time units             |\n";
-    std::cout << "+--------------------------------------------------------------+\n";
-    std::cout << "| Avg Waiting Time:       " << std::setw(10) << std::fixed 
+    *out << "+--------------------------------------------------------------+\n";
+    *out << "| Avg Waiting Time:       " << std::setw(10) << std::fixed 
               << std::setprecision(2) << metrics.getAvgWaitingTime() 
               << " time units             |\n";
-    std::cout << "| Avg Turnaround Time:    " << std::setw(10) << std::fixed 
+    *out << "| Avg Turnaround Time:    " << std::setw(10) << std::fixed 
               << std::setprecision(2) << metrics.getAvgTurnaroundTime() 
               << " time units             |\n";
-    std::cout << "| Avg Response Time:      " << std::setw(10) << std::fixed 
+    *out << "| Avg Response Time:      " << std::setw(10) << std::fixed 
               << std::setprecision(2) << metrics.getAvgResponseTime() 
               << " time units             |\n";
-    std::cout << "+--------------------------------------------------------------+\n";
-    std::cout << "| CPU Utilization:        " << std::setw(10) << std::fixed 
+    *out << "| P99 Waiting Time:       " << std::setw(10) << metrics.getWaitingTimePercentile(0.99)
+              << " time units             |\n";
+    *out << "| P99 Response Time:      " << std::setw(10) << metrics.getResponseTimePercentile(0.99)
+              << " time units             |\n";
+    *out << "+--------------------------------------------------------------+\n";
+    *out << "| CPU Utilization:        " << std::setw(10) << std::fixed 
               << std::setprecision(2) << metrics.getCpuUtilization() 
               << " %                      |\n";
-    std::cout << "| Throughput:             " << std::setw(10) << std::fixed 
+    *out << "| Throughput:             " << std::setw(10) << std::fixed 
               << std::setprecision(4) << metrics.getThroughput() 
               << " proc/time             |\n";
-    std::cout << "| Context Switches:       " << std::setw(10) << metrics.getTotalContextSwitches() 
+    *out << "| Context Switches:       " << std::setw(10) << metrics.getTotalContextSwitches() 
               << "                        |\n";
-    std::cout << "| CS Overhead:            " << std::setw(10) << metrics.getContextSwitchOverhead() 
+    *out << "| CS Overhead:            " << std::setw(10) << metrics.getContextSwitchOverhead() 
               << " time units             |\n";
-    std::cout << "+--------------------------------------------------------------+\n";
+    if (metrics.getCpuCount() > 1) {
+        const std::vector<int>& busy = metrics.getCpuBusyTimes();
+        auto range = std::minmax_element(busy.begin(), busy.end());
+        *out << "| CPUs:                   " << std::setw(10) << metrics.getCpuCount()
+                  << "                        |\n";
+        *out << "| Migrations:             " << std::setw(10) << metrics.getTotalMigrations()
+                  << "                        |\n";
+        *out << "| Per-CPU Utilization: " << std::setw(6) << std::fixed << std::setprecision(2)
+                  << metrics.getCpuUtilization(range.first - busy.begin()) << " % to "
+                  << std::setw(6) << metrics.getCpuUtilization(range.second - busy.begin())
+                  << " %                 |\n";
+    }
+    *out << "+--------------------------------------------------------------+\n";
 }
 
 void Visualizer::displayComparison(const std::vector<std::string>& schedulerNames,
                                    const std::vector<Metrics>& allMetrics) const {
-    std::cout << "\n+--------------------------------------------------------------------------+\n";
-    std::cout << "|                    SCHEDULER COMPARISON                                  |\n";
-    std::cout << "+------------------+-------+-------+-------+------+------+---------------+\n";
-    std::cout << "| Algorithm        |  WT   |  TAT  |  RT   | CPU% |  TP  | Ctx Switches  |\n";
-    std::cout << "+------------------+-------+-------+-------+------+------+---------------+\n";
+    *out << "\n+--------------------------------------------------------------------------+\n";
+    *out << "|                    SCHEDULER COMPARISON                                  |\n";
+    *out << "+------------------+-------+-------+-------+------+------+---------------+\n";
+    *out << "| Algorithm        |  WT   |  TAT  |  RT   | CPU% |  TP  | Ctx Switches  |\n";
+    *out << "+------------------+-------+-------+-------+------+------+---------------+\n";
     
     for (size_t i = 0; i < schedulerNames.size() && i < allMetrics.size(); ++i) {
         const auto& m = allMetrics[i];
-        std::cout << "| " << std::left << std::setw(16) << schedulerNames[i].substr(0, 16)
+        *out << "| " << std::left << std::setw(16) << schedulerNames[i].substr(0, 16)
                   << " | " << std::right << std::setw(5) << std::fixed << std::setprecision(1) 
                   << m.getAvgWaitingTime()
                   << " | " << std::setw(5) << m.getAvgTurnaroundTime()
@@ -296,7 +523,7 @@ void Visualizer::displayComparison(const std::vector<std::string>& schedulerName
                   << " |\n";
     }
     
-    std::cout << "+------------------+-------+-------+-------+------+------+---------------+\n";
+    *out << "+------------------+-------+-------+-------+------+------+---------------+\n";
     
     // Find best performers
     if (!allMetrics.empty()) {
@@ -313,32 +540,39 @@ void Visualizer::displayComparison(const std::vector<std::string>& schedulerName
                 bestCPU = i;
         }
         
-        std::cout << "\n" << BOLD << GREEN << "Best Performers:" << RESET << "\n";
-        std::cout << "  Lowest Avg Waiting Time:   " << schedulerNames[bestWT] << "\n";
-        std::cout << "  Lowest Avg Turnaround:     " << schedulerNames[bestTAT] << "\n";
-        std::cout << "  Lowest Avg Response Time:  " << schedulerNames[bestRT] << "\n";
-        std::cout << "  Highest CPU Utilization:   " << schedulerNames[bestCPU] << "\n";
+        *out << "\n" << BOLD << GREEN << "Best Performers:" << RESET << "\n";
+        *out << "  Lowest Avg Waiting Time:   " << schedulerNames[bestWT] << "\n";
+        *out << "  Lowest Avg Turnaround:     " << schedulerNames[bestTAT] << "\n";
+        *out << "  Lowest Avg Response Time:  " << schedulerNames[bestRT] << "\n";
+        *out << "  Highest CPU Utilization:   " << schedulerNames[bestCPU] << "\n";
     }
 }
 
 void Visualizer::displaySimulationFrame(const Scheduler& scheduler, int time) const {
     clearScreen();
     displayHeader("Real-Time Simulation");
-    displayCPUStatus(scheduler.getCurrentProcess(), time);
-    displayProcessTable(scheduler.getProcesses());
+    const ProcessTable& processes = scheduler.getProcessTable();
+    int running = scheduler.getCurrentProcess();
+    if (running >= 0) {
+        const Process current = processes.getProcess(running);
+        displayCPUStatus(&current, time);
+    } else {
+        displayCPUStatus(nullptr, time);
+    }
+    displayProcessTable(processes);
     wait(animationDelay);
 }
 
 void Visualizer::displayHeader(const std::string& title) const {
-    std::cout << "\n";
+    *out << "\n";
     drawLine(width, '=');
-    std::cout << std::setw(width/2 + title.length()/2) << title << "\n";
+    *out << std::setw(width/2 + title.length()/2) << title << "\n";
     drawLine(width, '=');
 }
 
 void Visualizer::displayFooter() const {
     drawLine(width, '=');
-    std::cout << "\n";
+    *out << "\n";
 }
 
 void Visualizer::printSeparator() const {
@@ -0,0 +1,22 @@
+/**
+ * @file Workload.cpp
+ * @brief Implementation of shared immutable workloads
+ * @version 1.0
+ */
+
+#include "Workload.h"
+#include <utility>
+
+Workload::Workload(ProcessTable processes)
+    : table(std::move(processes))
+{
+    table.resetAll();
+}
+
+Workload::Workload(const std::vector<Process>& processes) {
+    table.reserve(processes.size());
+    for (const Process& process : processes) {
+        table.add(process);
+    }
+    table.resetAll();
+}
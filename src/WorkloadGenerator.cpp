@@ -0,0 +1,316 @@
+/**
+ * @file WorkloadGenerator.cpp
+ * @brief Implementation of the synthetic workload generator
+ * @version 1.0
+ */
+
+#include "WorkloadGenerator.h"
+#include "ThreadPool.h"
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <future>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+
+static const double PI = 3.14159265358979323846;
+
+/**
+ * @brief SplitMix64 finaliser, used to derive independent stream seeds
+ */
+static std::uint64_t splitmix64(std::uint64_t x) {
+    x += 0x9E3779B97F4A7C15ULL;
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+    return x ^ (x >> 31);
+}
+
+/**
+ * @brief RNG for one chunk; stream 0 draws gaps, stream 1 everything else
+ */
+static std::mt19937_64 chunkStream(std::uint64_t seed, size_t chunk, int stream) {
+    return std::mt19937_64(splitmix64(seed ^ splitmix64(chunk * 2 + stream)));
+}
+
+/**
+ * @brief RNG for one chunk's I/O bursts, independent of both chunk streams
+ */
+static std::mt19937_64 ioStream(std::uint64_t seed, size_t chunk) {
+    return std::mt19937_64(splitmix64(splitmix64(seed ^ 0x494F425552535453ULL) ^ chunk));
+}
+
+/**
+ * @brief Uniform double in [0, 1) from the top 53 bits of a draw
+ */
+static double uniform01(std::mt19937_64& rng) {
+    return static_cast<double>(rng() >> 11) * (1.0 / 9007199254740992.0);
+}
+
+/**
+ * @brief Uniform integer in [low, high]
+ */
+static int uniformInt(std::mt19937_64& rng, int low, int high) {
+    std::uint64_t span = static_cast<std::uint64_t>(static_cast<long long>(high) - low) + 1;
+    return static_cast<int>(low + static_cast<long long>(rng() % span));
+}
+
+/**
+ * @brief Unit-mean exponential variate
+ */
+static double unitExponential(std::mt19937_64& rng) {
+    return -std::log(1.0 - uniform01(rng));
+}
+
+WorkloadGenerator::WorkloadGenerator(const WorkloadSpec& spec)
+    : spec(spec)
+{
+    if (spec.count < 0) {
+        throw std::invalid_argument("Workload count must not be negative");
+    }
+    if (spec.minBurst < 1 || spec.maxBurst < spec.minBurst || spec.burstCap < spec.minBurst) {
+        throw std::invalid_argument("Workload burst bounds out of range");
+    }
+    if (spec.maxArrival < 0 || spec.maxPriority < 0 || spec.chunkSize == 0) {
+        throw std::invalid_argument("Workload arrival, priority or chunk bound out of range");
+    }
+    if (spec.arrivals != ArrivalPattern::UNIFORM && !(spec.arrivalRate > 0.0)) {
+        throw std::invalid_argument("Workload arrival rate must be positive");
+    }
+    if (spec.arrivals == ArrivalPattern::DIURNAL &&
+        (!(spec.diurnalPeriod > 0.0) || spec.diurnalAmplitude < 0.0 ||
+         spec.diurnalAmplitude >= 1.0)) {
+        throw std::invalid_argument("Diurnal period must be positive and amplitude in [0, 1)");
+    }
+    if (spec.bursts != BurstDistribution::UNIFORM && !(spec.burstMean > 0.0)) {
+        throw std::invalid_argument("Workload burst mean must be positive");
+    }
+    if (spec.bursts == BurstDistribution::PARETO && !(spec.paretoShape > 1.0)) {
+        throw std::invalid_argument("Pareto shape must be above 1 for a finite mean");
+    }
+    if (spec.bursts == BurstDistribution::LOGNORMAL && spec.lognormalSigma < 0.0) {
+        throw std::invalid_argument("Lognormal sigma must not be negative");
+    }
+    if (!(spec.ioShare >= 0.0 && spec.ioShare <= 1.0) ||
+        (spec.ioShare > 0.0 && (!(spec.ioCpuMean > 0.0) || !(spec.ioMean > 0.0)))) {
+        throw std::invalid_argument("I/O share must be in [0, 1] and I/O means positive");
+    }
+}
+
+void WorkloadGenerator::addIoBursts(size_t chunk, ProcessTable& table) const {
+    const size_t first = chunk * spec.chunkSize;
+    const size_t last = std::min(first + spec.chunkSize, static_cast<size_t>(spec.count));
+    std::mt19937_64 rng = ioStream(spec.seed, chunk);
+    for (size_t i = first; i < last; ++i) {
+        if (uniform01(rng) >= spec.ioShare) {
+            continue;
+        }
+        const double burst = table.getBurstTime(i);
+        double after = 0.0;
+        while (true) {
+            after += std::max(1.0, std::round(spec.ioCpuMean * unitExponential(rng)));
+            if (after >= burst) {
+                break;
+            }
+            const double length = std::max(1.0, std::round(spec.ioMean * unitExponential(rng)));
+            table.addIoBurst(i, static_cast<int>(after),
+                             static_cast<int>(std::min(length, static_cast<double>(INT_MAX))));
+        }
+    }
+}
+
+double WorkloadGenerator::chunkDuration(size_t chunk) const {
+    size_t first = chunk * spec.chunkSize;
+    size_t last = std::min(first + spec.chunkSize, static_cast<size_t>(spec.count));
+    std::mt19937_64 gaps = chunkStream(spec.seed, chunk, 0);
+    double total = 0.0;
+    for (size_t i = first; i < last; ++i) {
+        total += unitExponential(gaps);
+    }
+    return total;
+}
+
+double WorkloadGenerator::arrivalAt(double operationalTime) const {
+    const double rate = spec.arrivalRate;
+    if (spec.arrivals == ArrivalPattern::POISSON || spec.diurnalAmplitude == 0.0) {
+        return operationalTime / rate;
+    }
+
+    // Solve L(t) = s for the cumulative rate
+    // L(t) = rate * (t + A * P / (2 pi) * (1 - cos(2 pi t / P))), which is
+    // increasing and within rate * A * P / pi of rate * t
+    const double amplitude = spec.diurnalAmplitude;
+    const double period = spec.diurnalPeriod;
+    const double omega = 2.0 * PI / period;
+    double high = operationalTime / rate;
+    double low = std::max(0.0, high - amplitude * period / PI);
+    double t = high;
+    for (int step = 0; step < 64 && high - low > 1e-9 * std::max(1.0, high); ++step) {
+        double value = rate * (t + amplitude / omega * (1.0 - std::cos(omega * t))) -
+                       operationalTime;
+        if (value > 0.0) {
+            high = t;
+        } else {
+            low = t;
+        }
+        // Newton step, falling back to bisection when it leaves the bracket
+        double slope = rate * (1.0 + amplitude * std::sin(omega * t));
+        double next = t - value / slope;
+        t = (next > low && next < high) ? next : 0.5 * (low + high);
+    }
+    return t;
+}
+
+size_t WorkloadGenerator::getChunkCount() const {
+    return (static_cast<size_t>(spec.count) + spec.chunkSize - 1) / spec.chunkSize;
+}
+
+size_t WorkloadGenerator::generateChunk(size_t chunk, double timeOffset, int* priorities,
+                                        int* bursts, int* arrivals) const {
+    size_t first = chunk * spec.chunkSize;
+    size_t last = std::min(first + spec.chunkSize, static_cast<size_t>(spec.count));
+    std::mt19937_64 gaps = chunkStream(spec.seed, chunk, 0);
+    std::mt19937_64 rng = chunkStream(spec.seed, chunk, 1);
+
+    const double mean = spec.burstMean;
+    const double paretoScale = mean * (spec.paretoShape - 1.0) / spec.paretoShape;
+    const double sigma = spec.lognormalSigma;
+    const double logMean = std::log(mean) - 0.5 * sigma * sigma;
+    double operationalTime = timeOffset;
+
+    for (size_t i = 0; first + i < last; ++i) {
+        if (spec.arrivals == ArrivalPattern::UNIFORM) {
+            arrivals[i] = uniformInt(rng, 0, spec.maxArrival);
+        } else {
+            operationalTime += unitExponential(gaps);
+            double when = std::floor(arrivalAt(operationalTime));
+            arrivals[i] = when >= INT_MAX ? INT_MAX : static_cast<int>(when);
+        }
+
+        double burst = 0.0;
+        switch (spec.bursts) {
+            case BurstDistribution::UNIFORM:
+                burst = uniformInt(rng, spec.minBurst, spec.maxBurst);
+                break;
+            case BurstDistribution::EXPONENTIAL:
+                burst = mean * unitExponential(rng);
+                break;
+            case BurstDistribution::PARETO:
+                burst = paretoScale / std::pow(1.0 - uniform01(rng), 1.0 / spec.paretoShape);
+                break;
+            case BurstDistribution::LOGNORMAL: {
+                // Box-Muller; one normal per process keeps the stream simple
+                double u1 = 1.0 - uniform01(rng);
+                double u2 = uniform01(rng);
+                double normal = std::sqrt(-2.0 * std::log(u1)) * std::cos(2.0 * PI * u2);
+                burst = std::exp(logMean + sigma * normal);
+                break;
+            }
+        }
+        if (spec.bursts != BurstDistribution::UNIFORM) {
+            burst = std::min(std::max(std::round(burst), static_cast<double>(spec.minBurst)),
+                             static_cast<double>(spec.burstCap));
+        }
+        bursts[i] = static_cast<int>(burst);
+        priorities[i] = uniformInt(rng, 0, spec.maxPriority);
+    }
+    return last - first;
+}
+
+ProcessTable WorkloadGenerator::generate() const {
+    const size_t count = static_cast<size_t>(spec.count);
+    const size_t chunks = getChunkCount();
+    std::vector<int> pids(count);
+    std::vector<int> priorities(count);
+    std::vector<int> bursts(count);
+    std::vector<int> arrivals(count);
+    std::iota(pids.begin(), pids.end(), 0);
+
+    size_t threads = (spec.threads > 0) ? static_cast<size_t>(spec.threads) :
+                                          ThreadPool::defaultThreadCount();
+    threads = std::min(threads, std::max<size_t>(chunks, 1));
+    std::vector<double> offsets(chunks, 0.0);
+
+    if (threads < 2) {
+        for (size_t c = 0; c < chunks; ++c) {
+            if (spec.arrivals != ArrivalPattern::UNIFORM && c > 0) {
+                offsets[c] = offsets[c - 1] + chunkDuration(c - 1);
+            }
+            generateChunk(c, offsets[c], priorities.data() + c * spec.chunkSize,
+                          bursts.data() + c * spec.chunkSize, arrivals.data() + c * spec.chunkSize);
+        }
+    } else {
+        ThreadPool pool(threads);
+        std::vector<std::future<void>> pending;
+        if (spec.arrivals != ArrivalPattern::UNIFORM) {
+            // Pass 1: each chunk's total gap, then a prefix sum for the offsets
+            std::vector<double> durations(chunks, 0.0);
+            for (size_t c = 0; c + 1 < chunks; ++c) {
+                pending.push_back(pool.submit([this, &durations, c]() {
+                    durations[c] = chunkDuration(c);
+                }));
+            }
+            for (auto& task : pending) {
+                task.get();
+            }
+            pending.clear();
+            for (size_t c = 1; c < chunks; ++c) {
+                offsets[c] = offsets[c - 1] + durations[c - 1];
+            }
+        }
+        // Pass 2: chunks write disjoint slices of the columns
+        for (size_t c = 0; c < chunks; ++c) {
+            pending.push_back(pool.submit([this, &offsets, &priorities, &bursts, &arrivals, c]() {
+                const size_t first = c * spec.chunkSize;
+                generateChunk(c, offsets[c], priorities.data() + first, bursts.data() + first,
+                              arrivals.data() + first);
+            }));
+        }
+        for (auto& task : pending) {
+            task.get();
+        }
+    }
+
+    ProcessTable table;
+    table.addColumns(pids.data(), priorities.data(), bursts.data(), arrivals.data(), count);
+    if (spec.ioShare > 0.0) {
+        // Bursts go into one shared pool; filling it in row order keeps it tidy
+        for (size_t c = 0; c < chunks; ++c) {
+            addIoBursts(c, table);
+        }
+    }
+    return table;
+}
+
+std::vector<Process> WorkloadGenerator::generateProcesses() const {
+    return generate().toProcesses();
+}
+
+bool WorkloadGenerator::parseArrivalPattern(const std::string& name, ArrivalPattern& pattern) {
+    if (name == "uniform") {
+        pattern = ArrivalPattern::UNIFORM;
+    } else if (name == "poisson") {
+        pattern = ArrivalPattern::POISSON;
+    } else if (name == "diurnal") {
+        pattern = ArrivalPattern::DIURNAL;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+bool WorkloadGenerator::parseBurstDistribution(const std::string& name,
+                                               BurstDistribution& distribution) {
+    if (name == "uniform") {
+        distribution = BurstDistribution::UNIFORM;
+    } else if (name == "exponential") {
+        distribution = BurstDistribution::EXPONENTIAL;
+    } else if (name == "pareto") {
+        distribution = BurstDistribution::PARETO;
+    } else if (name == "lognormal") {
+        distribution = BurstDistribution::LOGNORMAL;
+    } else {
+        return false;
+    }
+    return true;
+}
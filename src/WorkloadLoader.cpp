@@ -0,0 +1,466 @@
+/**
+ * @file WorkloadLoader.cpp
+ * @brief Implementation of the workload file loader
+ * @version 1.0
+ */
+
+#include "WorkloadLoader.h"
+#include "ThreadPool.h"
+#include <algorithm>
+#include <charconv>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <future>
+#include <iterator>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+/// Files smaller than this are parsed on one thread
+static const size_t MIN_PARALLEL_BYTES = 1 << 20;
+
+/// Binary workload identification and layout
+static const char BINARY_MAGIC[4] = {'C', 'P', 'U', 'W'};
+static const std::uint32_t BINARY_VERSION = 1;
+static const std::uint32_t BYTE_ORDER_MARK = 0x01020304;
+static const std::uint32_t FLAG_NAMES = 1;
+static const std::uint32_t FLAG_IO = 2;
+
+/**
+ * @struct BinaryHeader
+ * @brief Fixed header at the start of a binary workload
+ */
+struct BinaryHeader {
+    char magic[4];              ///< BINARY_MAGIC
+    std::uint32_t version;      ///< BINARY_VERSION
+    std::uint32_t byteOrder;    ///< BYTE_ORDER_MARK as written by the host
+    std::uint32_t flags;        ///< FLAG_NAMES, FLAG_IO: sections after the columns
+    std::uint64_t count;        ///< Number of processes
+};
+static_assert(sizeof(BinaryHeader) == 24, "binary header layout");
+static_assert(sizeof(int) == 4, "columns are 32-bit integers");
+
+MappedFile::MappedFile(const std::string& filename)
+    : contents(nullptr)
+    , length(0)
+    , mapped(false)
+    , opened(false)
+{
+#ifndef _WIN32
+    int fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return;
+    }
+    struct stat info;
+    if (::fstat(fd, &info) == 0 && S_ISREG(info.st_mode)) {
+        opened = true;
+        length = static_cast<size_t>(info.st_size);
+        if (length > 0) {
+            void* view = ::mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (view != MAP_FAILED) {
+                ::madvise(view, length, MADV_SEQUENTIAL);
+                contents = static_cast<const char*>(view);
+                mapped = true;
+            }
+        }
+    }
+    ::close(fd);
+    if (mapped || !opened || length == 0) {
+        return;
+    }
+    opened = false;
+    length = 0;
+#endif
+    // No mapping available: read the whole file instead
+    std::ifstream file(filename, std::ios::binary);
+    if (!file.is_open()) {
+        return;
+    }
+    buffer.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    contents = buffer.data();
+    length = buffer.size();
+    opened = true;
+}
+
+MappedFile::~MappedFile() {
+#ifndef _WIN32
+    if (mapped) {
+        ::munmap(const_cast<char*>(contents), length);
+    }
+#endif
+}
+
+/**
+ * @brief End of the line starting at first (the newline or last)
+ */
+static const char* findLineEnd(const char* first, const char* last) {
+    const void* newline = std::memchr(first, '\n', static_cast<size_t>(last - first));
+    return newline ? static_cast<const char*>(newline) : last;
+}
+
+/**
+ * @brief Skip the first line if it is a "PID ..." header
+ */
+static const char* skipHeader(const char* first, const char* last) {
+    const char* end = findLineEnd(first, last);
+    const char* pid = "PID";
+    if (std::search(first, end, pid, pid + 3) == end) {
+        return first;
+    }
+    return end == last ? last : end + 1;
+}
+
+static const char* skipSeparators(const char* cursor, const char* end) {
+    while (cursor < end && (*cursor == ' ' || *cursor == '\t' || *cursor == ',' ||
+                            *cursor == '\r' || *cursor == '\v' || *cursor == '\f')) {
+        ++cursor;
+    }
+    return cursor;
+}
+
+/**
+ * @brief Parse the four leading integers of a line
+ * @param rest Set to the text after the fourth integer
+ * @return false if the line is not a process record
+ */
+static bool parseRecord(const char* cursor, const char* end, int values[4], const char*& rest) {
+    for (int field = 0; field < 4; ++field) {
+        cursor = skipSeparators(cursor, end);
+        if (cursor < end && *cursor == '+') {
+            ++cursor;
+        }
+        std::from_chars_result parsed = std::from_chars(cursor, end, values[field]);
+        if (parsed.ec != std::errc()) {
+            return false;
+        }
+        cursor = parsed.ptr;
+    }
+    rest = cursor;
+    return true;
+}
+
+/**
+ * @brief Add the "after:length" I/O bursts that follow a record
+ *
+ * Stops at the first token that is not a valid burst, so other trailing
+ * text is ignored as before.
+ */
+static void parseIoBursts(const char* cursor, const char* end, Process& process) {
+    int after = 0;
+    int length = 0;
+    while (true) {
+        cursor = skipSeparators(cursor, end);
+        std::from_chars_result parsed = std::from_chars(cursor, end, after);
+        if (parsed.ec != std::errc() || parsed.ptr == end || *parsed.ptr != ':') {
+            return;
+        }
+        parsed = std::from_chars(parsed.ptr + 1, end, length);
+        if (parsed.ec != std::errc() || !process.addIoBurst(after, length)) {
+            return;
+        }
+        cursor = parsed.ptr;
+    }
+}
+
+/**
+ * @brief Store an error message and report failure
+ */
+static bool fail(std::string* error, const std::string& message) {
+    if (error != nullptr) {
+        *error = message;
+    }
+    return false;
+}
+
+/**
+ * @brief Check for the binary magic at the start of a file
+ */
+static bool hasBinaryMagic(const MappedFile& file) {
+    return file.size() >= sizeof(BINARY_MAGIC) &&
+           std::memcmp(file.data(), BINARY_MAGIC, sizeof(BINARY_MAGIC)) == 0;
+}
+
+/**
+ * @brief Read the I/O section of a binary workload: count + 1 offsets, then bursts
+ */
+static bool readIoSection(const char* section, const char* last, size_t first, size_t rows,
+                          ProcessTable& table, std::string* error) {
+    const size_t offsetBytes = sizeof(std::uint64_t) * (rows + 1);
+    if (static_cast<size_t>(last - section) < offsetBytes) {
+        return fail(error, "binary workload is truncated");
+    }
+    const char* bursts = section + offsetBytes;
+    const std::uint64_t available = static_cast<std::uint64_t>(last - bursts) / (2 * sizeof(int));
+    std::uint64_t begin = 0;
+    std::memcpy(&begin, section, sizeof(begin));
+    if (begin != 0) {
+        return fail(error, "binary workload has invalid I/O offsets");
+    }
+    for (size_t i = 0; i < rows; ++i) {
+        std::uint64_t end = 0;
+        std::memcpy(&end, section + sizeof(std::uint64_t) * (i + 1), sizeof(end));
+        if (end < begin || end > available) {
+            return fail(error, "binary workload has invalid I/O offsets");
+        }
+        for (std::uint64_t k = begin; k < end; ++k) {
+            std::int32_t burst[2];
+            std::memcpy(burst, bursts + sizeof(burst) * k, sizeof(burst));
+            if (!table.addIoBurst(first + i, burst[0], burst[1])) {
+                return fail(error, "binary workload has an invalid I/O burst");
+            }
+        }
+        begin = end;
+    }
+    return true;
+}
+
+/**
+ * @brief Validate a binary workload and append its rows to a table
+ */
+static bool readBinary(const MappedFile& file, ProcessTable& table, std::string* error) {
+    BinaryHeader header;
+    if (file.size() < sizeof(header) || !hasBinaryMagic(file)) {
+        return fail(error, "not a binary workload");
+    }
+    std::memcpy(&header, file.data(), sizeof(header));
+    if (header.byteOrder != BYTE_ORDER_MARK) {
+        return fail(error, "binary workload has the wrong byte order");
+    }
+    if (header.version != BINARY_VERSION) {
+        return fail(error, "unsupported binary workload version " +
+                           std::to_string(header.version));
+    }
+    if ((header.flags & ~(FLAG_NAMES | FLAG_IO)) != 0) {
+        return fail(error, "binary workload has unknown sections");
+    }
+
+    const std::uint64_t available = file.size() - sizeof(header);
+    const std::uint64_t count = header.count;
+    if (count > available / (4 * sizeof(int))) {
+        return fail(error, "binary workload is truncated");
+    }
+    const size_t rows = static_cast<size_t>(count);
+    const int* columns = reinterpret_cast<const int*>(file.data() + sizeof(header));
+    const size_t first = table.size();
+    table.reserve(first + rows);
+    table.addColumns(columns, columns + rows, columns + 2 * rows, columns + 3 * rows, rows);
+
+    const char* offsetsStart = file.data() + sizeof(header) + 4 * sizeof(int) * rows;
+    const char* last = file.data() + file.size();
+    if ((header.flags & FLAG_NAMES) == 0) {
+        return (header.flags & FLAG_IO) == 0 ||
+               readIoSection(offsetsStart, last, first, rows, table, error);
+    }
+    const std::uint64_t nameSpace = available - 4 * sizeof(int) * count;
+    if (count + 1 > nameSpace / sizeof(std::uint64_t)) {
+        return fail(error, "binary workload is truncated");
+    }
+    const std::uint64_t* offsets = reinterpret_cast<const std::uint64_t*>(offsetsStart);
+    const char* blob = offsetsStart + sizeof(std::uint64_t) * (rows + 1);
+    const std::uint64_t blobSize = nameSpace - sizeof(std::uint64_t) * (count + 1);
+    if (offsets[0] != 0 || offsets[rows] > blobSize) {
+        return fail(error, "binary workload has invalid name offsets");
+    }
+    for (size_t i = 0; i < rows; ++i) {
+        if (offsets[i + 1] < offsets[i]) {
+            return fail(error, "binary workload has invalid name offsets");
+        }
+        table.setName(first + i, std::string(blob + offsets[i],
+                                             static_cast<size_t>(offsets[i + 1] - offsets[i])));
+    }
+    return (header.flags & FLAG_IO) == 0 ||
+           readIoSection(blob + offsets[rows], last, first, rows, table, error);
+}
+
+WorkloadReader::WorkloadReader(const std::string& filename)
+    : file(filename)
+    , cursor(file.data())
+    , last(file.data() + file.size())
+{
+    if (file.size() > 0) {
+        cursor = skipHeader(cursor, last);
+    }
+}
+
+bool WorkloadReader::next(Process& process) {
+    int values[4];
+    const char* rest = nullptr;
+    while (cursor < last) {
+        const char* end = findLineEnd(cursor, last);
+        bool valid = parseRecord(cursor, end, values, rest);
+        cursor = (end == last) ? last : end + 1;
+        if (valid) {
+            process = Process(values[0], values[1], values[2], values[3]);
+            parseIoBursts(rest, end, process);
+            return true;
+        }
+    }
+    return false;
+}
+
+void WorkloadLoader::parse(const char* first, const char* last,
+                           std::vector<Process>& processes) {
+    int values[4];
+    const char* rest = nullptr;
+    while (first < last) {
+        const char* end = findLineEnd(first, last);
+        if (parseRecord(first, end, values, rest)) {
+            processes.emplace_back(values[0], values[1], values[2], values[3]);
+            parseIoBursts(rest, end, processes.back());
+        }
+        first = (end == last) ? last : end + 1;
+    }
+}
+
+bool WorkloadLoader::load(const std::string& filename, std::vector<Process>& processes,
+                          size_t threads, std::string* error) {
+    MappedFile file(filename);
+    if (!file.isOpen()) {
+        return fail(error, "cannot open " + filename);
+    }
+    processes.clear();
+    if (file.size() == 0) {
+        return true;
+    }
+    if (hasBinaryMagic(file)) {
+        ProcessTable table;
+        if (!readBinary(file, table, error)) {
+            return false;
+        }
+        processes = table.toProcesses();
+        return true;
+    }
+
+    const char* first = skipHeader(file.data(), file.data() + file.size());
+    const char* last = file.data() + file.size();
+
+    size_t count = (threads > 0) ? threads : ThreadPool::defaultThreadCount();
+    if (count < 2 || static_cast<size_t>(last - first) < MIN_PARALLEL_BYTES) {
+        processes.reserve(static_cast<size_t>(std::count(first, last, '\n')) + 1);
+        parse(first, last, processes);
+        return true;
+    }
+
+    // Split at line boundaries; each chunk parses into its own vector
+    std::vector<const char*> bounds(1, first);
+    const size_t step = static_cast<size_t>(last - first) / count;
+    for (size_t i = 1; i < count; ++i) {
+        const char* split = std::max(bounds.back(), first + i * step);
+        split = findLineEnd(split, last);
+        bounds.push_back(split == last ? last : split + 1);
+    }
+    bounds.push_back(last);
+
+    std::vector<std::vector<Process>> chunks(count);
+    {
+        ThreadPool pool(count);
+        std::vector<std::future<void>> pending;
+        for (size_t i = 0; i < count; ++i) {
+            pending.push_back(pool.submit([&bounds, &chunks, i]() {
+                chunks[i].reserve(static_cast<size_t>(
+                    std::count(bounds[i], bounds[i + 1], '\n')) + 1);
+                parse(bounds[i], bounds[i + 1], chunks[i]);
+            }));
+        }
+        for (auto& task : pending) {
+            task.get();
+        }
+    }
+    size_t total = 0;
+    for (const auto& chunk : chunks) {
+        total += chunk.size();
+    }
+    processes.reserve(total);
+    for (auto& chunk : chunks) {
+        processes.insert(processes.end(), std::make_move_iterator(chunk.begin()),
+                         std::make_move_iterator(chunk.end()));
+        std::vector<Process>().swap(chunk);
+    }
+    return true;
+}
+
+bool WorkloadLoader::isBinary(const std::string& filename) {
+    MappedFile file(filename);
+    return file.isOpen() && hasBinaryMagic(file);
+}
+
+bool WorkloadLoader::loadBinary(const std::string& filename, ProcessTable& table,
+                                std::string* error) {
+    MappedFile file(filename);
+    if (!file.isOpen()) {
+        return fail(error, "cannot open " + filename);
+    }
+    return readBinary(file, table, error);
+}
+
+bool WorkloadLoader::saveBinary(const std::string& filename,
+                                const std::vector<Process>& processes) {
+    std::ofstream file(filename, std::ios::binary);
+    if (!file.is_open()) {
+        return false;
+    }
+
+    BinaryHeader header;
+    std::memcpy(header.magic, BINARY_MAGIC, sizeof(BINARY_MAGIC));
+    header.version = BINARY_VERSION;
+    header.byteOrder = BYTE_ORDER_MARK;
+    header.flags = 0;
+    header.count = processes.size();
+    for (const auto& p : processes) {
+        if (p.getName() != "P" + std::to_string(p.getPid())) {
+            header.flags |= FLAG_NAMES;
+        }
+        if (!p.getIoBursts().empty()) {
+            header.flags |= FLAG_IO;
+        }
+    }
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+    // One column at a time, in pid, priority, burst, arrival order
+    std::vector<int> column(processes.size());
+    for (int field = 0; field < 4; ++field) {
+        for (size_t i = 0; i < processes.size(); ++i) {
+            const Process& p = processes[i];
+            column[i] = (field == 0) ? p.getPid() :
+                        (field == 1) ? p.getPriority() :
+                        (field == 2) ? p.getBurstTime() : p.getArrivalTime();
+        }
+        file.write(reinterpret_cast<const char*>(column.data()),
+                   static_cast<std::streamsize>(column.size() * sizeof(int)));
+    }
+
+    if (header.flags & FLAG_NAMES) {
+        std::vector<std::uint64_t> offsets(1, 0);
+        offsets.reserve(processes.size() + 1);
+        for (const auto& p : processes) {
+            offsets.push_back(offsets.back() + p.getName().size());
+        }
+        file.write(reinterpret_cast<const char*>(offsets.data()),
+                   static_cast<std::streamsize>(offsets.size() * sizeof(std::uint64_t)));
+        for (const auto& p : processes) {
+            file.write(p.getName().data(), static_cast<std::streamsize>(p.getName().size()));
+        }
+    }
+
+    if (header.flags & FLAG_IO) {
+        std::vector<std::uint64_t> offsets(1, 0);
+        offsets.reserve(processes.size() + 1);
+        for (const auto& p : processes) {
+            offsets.push_back(offsets.back() + p.getIoBursts().size());
+        }
+        file.write(reinterpret_cast<const char*>(offsets.data()),
+                   static_cast<std::streamsize>(offsets.size() * sizeof(std::uint64_t)));
+        for (const auto& p : processes) {
+            for (const IoBurst& burst : p.getIoBursts()) {
+                const std::int32_t fields[2] = {burst.after, burst.length};
+                file.write(reinterpret_cast<const char*>(fields), sizeof(fields));
+            }
+        }
+    }
+    return static_cast<bool>(file);
+}
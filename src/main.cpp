@@ -5,12 +5,18 @@
  */
 
 #include "Simulator.h"
+#include "ParameterSweep.h"
+#include "Benchmark.h"
+#include "ReplicaRunner.h"
+#include "WorkloadGenerator.h"
 #include "Process.h"
 #include <iostream>
 #include <vector>
 #include <string>
 #include <cstdlib>
 #include <iomanip>
+#include <sstream>
+#include <cctype>
 
 /**
  * @brief Display welcome banner
@@ -49,25 +55,85 @@ void displayUsage(const char* programName) {
     std::cout << "  -h, --help              Display this help message\n";
     std::cout << "  -i, --interactive       Start interactive menu mode (default)\n";
     std::cout << "  -f, --file <filename>   Load processes from file\n";
+    std::cout << "  --load-threads <N>      Parse the file on N threads (0 = all cores)\n";
+    std::cout << "  --stream                Feed the file straight into one -a algorithm\n";
+    std::cout << "  --convert <file>        Save the loaded processes as a binary workload\n";
     std::cout << "  -n, --num <count>       Generate N random processes\n";
+    std::cout << "  --arrivals <pattern>    Arrivals for -n: uniform, poisson, diurnal\n";
+    std::cout << "  --arrival-rate <r>      Mean arrivals per time unit (default: 0.1)\n";
+    std::cout << "  --diurnal-period <t>    Length of one diurnal cycle (default: 1440)\n";
+    std::cout << "  --bursts <dist>         Bursts for -n: uniform, exponential, pareto, lognormal\n";
+    std::cout << "  --burst-mean <m>        Mean burst time (default: 10)\n";
+    std::cout << "  --burst-max <n>         Longest burst time\n";
+    std::cout << "  --io-share <f>          Fraction of -n processes with I/O bursts (default: 0)\n";
+    std::cout << "  --io-cpu <m>            Mean CPU time before each I/O burst (default: 4)\n";
+    std::cout << "  --io-mean <m>           Mean I/O burst length (default: 10)\n";
+    std::cout << "  --gen-threads <N>       Generate on N threads (0 = all cores)\n";
+    std::cout << "  --dynamic               Inject arrivals while running (--arrivals, --bursts)\n";
+    std::cout << "  --max-time <t>          Last dynamic arrival time (default: 1000)\n";
     std::cout << "  -a, --algorithm <algo>  Run specific algorithm:\n";
     std::cout << "                            rr    - Round Robin\n";
     std::cout << "                            pp    - Priority Preemptive\n";
     std::cout << "                            pnp   - Priority Non-Preemptive\n";
     std::cout << "                            mlq   - Multilevel Queue\n";
     std::cout << "                            mlfq  - Multilevel Feedback Queue\n";
+    std::cout << "                            sjf   - Shortest Job First\n";
+    std::cout << "                            srtf  - Shortest Remaining Time\n";
+    std::cout << "                            fair  - Fair share (CFS)\n";
     std::cout << "                            all   - Run all and compare\n";
     std::cout << "  -q, --quantum <value>   Set time quantum (default: 4)\n";
     std::cout << "  -c, --context <value>   Set context switch time (default: 1)\n";
-    std::cout << "  -b, --benchmark         Run performance benchmark\n";
+    std::cout << "  --fair-latency <t>      Fair: period in which every process runs (default: 20)\n";
+    std::cout << "  --fair-granularity <t>  Fair: shortest slice (default: 2)\n";
+    std::cout << "  --cpus <N>              Simulate N CPUs with per-CPU run queues (rr, pp, pnp, mlfq)\n";
+    std::cout << "  --migration-cost <t>    Extra switch time when a process changes CPU (default: 1)\n";
+    std::cout << "  --no-push               SMP: keep arrivals on their home CPU (pid mod N)\n";
+    std::cout << "  --no-steal              SMP: idle CPUs do not steal from other queues\n";
+    std::cout << "  -b, --benchmark         Run performance benchmark (-o writes JSON)\n";
+    std::cout << "  --bench-sizes <list>    Benchmark process counts, e.g. 1000,1000000\n";
+    std::cout << "  --bench-iterations <N>  Timed runs per algorithm and size (default: 5)\n";
+    std::cout << "  --bench-warmup <N>      Untimed runs first (default: 1)\n";
     std::cout << "  -o, --output <file>     Export results to CSV file\n";
     std::cout << "  --no-color              Disable colored output\n";
     std::cout << "  --no-gantt              Disable Gantt chart display\n";
+    std::cout << "  --gantt-window <t0:t1>  Show only [t0, t1) of the Gantt chart\n";
+    std::cout << "  --verify-engine         Check event-driven results against tick-based run\n";
+    std::cout << "  --policy-engine         Run the policy-composed engine instead of the classic classes\n";
+    std::cout << "  --headless              Print only results (CSV on stdout, or -o); no charts\n";
+    std::cout << "  --pause-at <t>          Pause the -a run at time t and save it (--snapshot-out)\n";
+    std::cout << "  --snapshot-out <file>   Snapshot file written by --pause-at\n";
+    std::cout << "  --resume <file>         Finish a snapshotted run under the current -q, -c, ...\n";
+    std::cout << "  --trace <prefix>        Stream events and completions to <prefix>_*.csv\n";
+    std::cout << "  --no-history            Keep no timeline or per-process metrics in memory\n";
+    std::cout << "  -p, --parallel [N]      Run compared algorithms in parallel (N threads)\n";
+    std::cout << "\nParameter sweep (runs -a algorithm(s) at every point, -o writes the table):\n";
+    std::cout << "  --sweep                 Enable sweep mode\n";
+    std::cout << "  --sweep-quantum <list>  Time quantum values, e.g. 2,4,8\n";
+    std::cout << "  --sweep-context <list>  Context switch times, e.g. 0,1,2\n";
+    std::cout << "  --sweep-queues <list>   Queue counts, e.g. 2,3,4\n";
+    std::cout << "  --sweep-quantums <sets> MLFQ quantum sets, e.g. 2:4:8,4:8:16\n";
+    std::cout << "  --sweep-aging <list>    Aging thresholds, e.g. 5,10,20\n";
+    std::cout << "  --sweep-random <N>      Sample N random points instead of the full grid\n";
+    std::cout << "  --seed <value>          Seed for sweeps, benchmarks and -n (default: 1)\n";
+    std::cout << "\nReplicas (-n workloads with seeds seed, seed+1, ...; -p N sets threads):\n";
+    std::cout << "  --replicas <K>          Run up to K replicas per -a algorithm(s)\n";
+    std::cout << "  --replica-min <N>       Replicas before stopping early (default: 5)\n";
+    std::cout << "  --replica-batch <N>     Replicas between stopping checks (default: 8)\n";
+    std::cout << "  --ci-level <p>          Confidence level (default: 0.95)\n";
+    std::cout << "  --ci-target <r>         Stop at half-width/mean r (default: 0.05, 0 = run K)\n";
     std::cout << "\nExamples:\n";
     std::cout << "  " << programName << " -i\n";
     std::cout << "  " << programName << " -n 10 -a all\n";
     std::cout << "  " << programName << " -f processes.txt -a rr -q 5\n";
-    std::cout << "  " << programName << " -b -o results.csv\n";
+    std::cout << "  " << programName << " -n 1000000 --arrivals poisson --bursts pareto --seed 7 -a rr --no-gantt\n";
+    std::cout << "  " << programName << " --dynamic --arrival-rate 0.09 --max-time 100000 -a all --no-gantt\n";
+    std::cout << "  " << programName << " -n 100000 --cpus 64 -a mlfq --no-gantt\n";
+    std::cout << "  " << programName << " -f trace.bin -a all -p --headless > results.csv\n";
+    std::cout << "  " << programName << " -n 200 -a mlfq --pause-at 500 --snapshot-out run.snap\n";
+    std::cout << "  " << programName << " --resume run.snap -q 8\n";
+    std::cout << "  " << programName << " -b --bench-sizes 1000,100000 -o bench.json\n";
+    std::cout << "  " << programName << " -n 500 --replicas 200 --ci-target 0.02 -p 8 -o replicas.csv\n";
+    std::cout << "  " << programName << " -f processes.txt --sweep --sweep-quantum 2,4,8 --sweep-context 0,1 -o sweep.csv\n";
     std::cout << "\n";
 }
 
@@ -87,6 +153,78 @@ std::vector<Process> createSampleProcesses() {
     return processes;
 }
 
+/**
+ * @brief Map a command-line algorithm name to a scheduler type
+ * @param name Algorithm name (rr, pp, pnp, mlq, mlfq, sjf, srtf, fair)
+ * @param type Output scheduler type
+ * @return true if the name is known
+ */
+bool parseAlgorithm(const std::string& name, SchedulerType& type) {
+    if (name == "rr") {
+        type = SchedulerType::ROUND_ROBIN;
+    }
+    else if (name == "pp") {
+        type = SchedulerType::PRIORITY_PREEMPTIVE;
+    }
+    else if (name == "pnp") {
+        type = SchedulerType::PRIORITY_NON_PREEMPTIVE;
+    }
+    else if (name == "mlq") {
+        type = SchedulerType::MULTILEVEL_QUEUE;
+    }
+    else if (name == "mlfq") {
+        type = SchedulerType::MULTILEVEL_FEEDBACK_QUEUE;
+    }
+    else if (name == "sjf") {
+        type = SchedulerType::SHORTEST_JOB_FIRST;
+    }
+    else if (name == "srtf") {
+        type = SchedulerType::SHORTEST_REMAINING_TIME;
+    }
+    else if (name == "fair") {
+        type = SchedulerType::FAIR;
+    }
+    else {
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Parse one --sweep-<field> option into the sweep space
+ * @param option Option name
+ * @param value Option value (comma-separated list)
+ * @param space Sweep space to fill
+ * @return false if the option is unknown or the value is malformed
+ */
+bool parseSweepOption(const std::string& option, const std::string& value, SweepSpace& space) {
+    try {
+        if (option == "--sweep-quantum") {
+            space.timeQuantums = ParameterSweep::parseList(value);
+        }
+        else if (option == "--sweep-context") {
+            space.contextSwitchTimes = ParameterSweep::parseList(value);
+        }
+        else if (option == "--sweep-queues") {
+            space.numQueues = ParameterSweep::parseList(value);
+        }
+        else if (option == "--sweep-quantums") {
+            space.quantums = ParameterSweep::parseQuantumSets(value);
+        }
+        else if (option == "--sweep-aging") {
+            space.agingThresholds = ParameterSweep::parseList(value);
+        }
+        else {
+            std::cerr << "Error: Unknown option '" << option << "'\n";
+            return false;
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << "\n";
+        return false;
+    }
+    return true;
+}
+
 /**
  * @brief Quick demo mode
  */
@@ -106,7 +244,14 @@ void runQuickDemo() {
  * @brief Parse command line arguments
  */
 int main(int argc, char* argv[]) {
-    displayWelcomeBanner();
+    // Headless runs print nothing but results, so check before the banner
+    bool headless = false;
+    for (int i = 1; i < argc; ++i) {
+        headless = headless || std::string(argv[i]) == "--headless";
+    }
+    if (!headless) {
+        displayWelcomeBanner();
+    }
     
     // Default configuration
     SimulationConfig simConfig;
@@ -117,8 +262,21 @@ int main(int argc, char* argv[]) {
     bool useColor = true;
     std::string inputFile;
     std::string outputFile;
+    std::string convertFile;
     std::string algorithm;
     int numProcesses = 0;
+    bool sweepMode = false;
+    bool streamMode = false;
+    int pauseAt = -1;
+    std::string snapshotFile;
+    std::string resumeFile;
+    SweepSpace sweepSpace;
+    SweepOptions sweepOptions;
+    BenchmarkOptions benchOptions;
+    bool replicaMode = false;
+    ReplicaOptions replicaOptions;
+    WorkloadSpec workloadSpec;
+    bool customWorkload = false;
     
     // Parse command line arguments
     for (int i = 1; i < argc; ++i) {
@@ -143,6 +301,69 @@ int main(int argc, char* argv[]) {
                 interactiveMode = false;
             }
         }
+        else if (arg == "--arrivals" || arg == "--bursts") {
+            bool known = false;
+            if (i + 1 < argc) {
+                std::string name = argv[++i];
+                known = (arg == "--arrivals") ?
+                    WorkloadGenerator::parseArrivalPattern(name, workloadSpec.arrivals) :
+                    WorkloadGenerator::parseBurstDistribution(name, workloadSpec.bursts);
+            }
+            if (!known) {
+                std::cerr << "Error: Unknown or missing value for " << arg << "\n";
+                return 1;
+            }
+            customWorkload = true;
+        }
+        else if (arg == "--arrival-rate") {
+            if (i + 1 < argc) {
+                workloadSpec.arrivalRate = std::atof(argv[++i]);
+                customWorkload = true;
+            }
+        }
+        else if (arg == "--diurnal-period") {
+            if (i + 1 < argc) {
+                workloadSpec.diurnalPeriod = std::atof(argv[++i]);
+                customWorkload = true;
+            }
+        }
+        else if (arg == "--burst-mean") {
+            if (i + 1 < argc) {
+                workloadSpec.burstMean = std::atof(argv[++i]);
+                customWorkload = true;
+            }
+        }
+        else if (arg == "--burst-max") {
+            if (i + 1 < argc) {
+                workloadSpec.maxBurst = std::atoi(argv[++i]);
+                workloadSpec.burstCap = workloadSpec.maxBurst;
+                customWorkload = true;
+            }
+        }
+        else if (arg == "--io-share") {
+            if (i + 1 < argc) {
+                workloadSpec.ioShare = std::atof(argv[++i]);
+                customWorkload = true;
+            }
+        }
+        else if (arg == "--io-cpu") {
+            if (i + 1 < argc) {
+                workloadSpec.ioCpuMean = std::atof(argv[++i]);
+                customWorkload = true;
+            }
+        }
+        else if (arg == "--io-mean") {
+            if (i + 1 < argc) {
+                workloadSpec.ioMean = std::atof(argv[++i]);
+                customWorkload = true;
+            }
+        }
+        else if (arg == "--gen-threads") {
+            if (i + 1 < argc) {
+                workloadSpec.threads = std::atoi(argv[++i]);
+                customWorkload = true;
+            }
+        }
         else if (arg == "-a" || arg == "--algorithm") {
             if (i + 1 < argc) {
                 algorithm = argv[++i];
@@ -159,10 +380,91 @@ int main(int argc, char* argv[]) {
                 schedConfig.contextSwitchTime = std::atoi(argv[++i]);
             }
         }
+        else if (arg == "--fair-latency") {
+            if (i + 1 < argc) {
+                schedConfig.targetLatency = std::atoi(argv[++i]);
+            }
+            if (schedConfig.targetLatency < 1) {
+                std::cerr << "Error: --fair-latency needs a positive time\n";
+                return 1;
+            }
+        }
+        else if (arg == "--fair-granularity") {
+            if (i + 1 < argc) {
+                schedConfig.minGranularity = std::atoi(argv[++i]);
+            }
+            if (schedConfig.minGranularity < 1) {
+                std::cerr << "Error: --fair-granularity needs a positive time\n";
+                return 1;
+            }
+        }
+        else if (arg == "--cpus") {
+            if (i + 1 < argc) {
+                schedConfig.numCpus = std::atoi(argv[++i]);
+            }
+        }
+        else if (arg == "--migration-cost") {
+            if (i + 1 < argc) {
+                schedConfig.migrationCost = std::atoi(argv[++i]);
+            }
+        }
+        else if (arg == "--no-push") {
+            schedConfig.pushMigration = false;
+        }
+        else if (arg == "--no-steal") {
+            schedConfig.workStealing = false;
+        }
         else if (arg == "-b" || arg == "--benchmark") {
             benchmarkMode = true;
             interactiveMode = false;
         }
+        else if (arg == "--bench-sizes") {
+            if (i + 1 < argc) {
+                try {
+                    benchOptions.sizes = ParameterSweep::parseList(argv[++i]);
+                } catch (const std::exception& e) {
+                    std::cerr << "Error: " << e.what() << "\n";
+                    return 1;
+                }
+            }
+        }
+        else if (arg == "--bench-iterations") {
+            if (i + 1 < argc) {
+                benchOptions.iterations = std::atoi(argv[++i]);
+            }
+        }
+        else if (arg == "--bench-warmup") {
+            if (i + 1 < argc) {
+                benchOptions.warmupRuns = std::atoi(argv[++i]);
+            }
+        }
+        else if (arg == "--replicas") {
+            if (i + 1 < argc) {
+                replicaMode = true;
+                interactiveMode = false;
+                replicaOptions.maxReplicas = std::atoi(argv[++i]);
+            }
+        }
+        else if (arg == "--replica-min") {
+            if (i + 1 < argc) {
+                replicaOptions.minReplicas = std::atoi(argv[++i]);
+            }
+        }
+        else if (arg == "--replica-batch") {
+            if (i + 1 < argc) {
+                replicaOptions.batchSize = std::atoi(argv[++i]);
+            }
+        }
+        else if (arg == "--ci-level") {
+            if (i + 1 < argc) {
+                replicaOptions.confidence = std::atof(argv[++i]);
+            }
+        }
+        else if (arg == "--ci-target") {
+            if (i + 1 < argc) {
+                replicaOptions.targetPrecision = std::atof(argv[++i]);
+            }
+        }
         else if (arg == "-o" || arg == "--output") {
             if (i + 1 < argc) {
                 outputFile = argv[++i];
@@ -174,17 +476,121 @@ int main(int argc, char* argv[]) {
         else if (arg == "--no-gantt") {
             simConfig.showGanttChart = false;
         }
+        else if (arg == "--gantt-window") {
+            int from = 0;
+            int to = 0;
+            char separator = 0;
+            std::istringstream window(i + 1 < argc ? argv[++i] : "");
+            if (!(window >> from >> separator >> to) || separator != ':' || to <= from) {
+                std::cerr << "Error: --gantt-window needs <start>:<end> with start < end\n";
+                return 1;
+            }
+            simConfig.ganttStart = from;
+            simConfig.ganttEnd = to;
+        }
+        else if (arg == "--load-threads") {
+            if (i + 1 < argc) {
+                simConfig.loadThreads = std::atoi(argv[++i]);
+            }
+        }
+        else if (arg == "--stream") {
+            streamMode = true;
+        }
+        else if (arg == "--pause-at") {
+            if (i + 1 < argc) {
+                pauseAt = std::atoi(argv[++i]);
+            }
+        }
+        else if (arg == "--snapshot-out") {
+            if (i + 1 < argc) {
+                snapshotFile = argv[++i];
+            }
+        }
+        else if (arg == "--resume") {
+            if (i + 1 < argc) {
+                resumeFile = argv[++i];
+                interactiveMode = false;
+            }
+        }
+        else if (arg == "--convert") {
+            if (i + 1 < argc) {
+                convertFile = argv[++i];
+                interactiveMode = false;
+            }
+        }
+        else if (arg == "--trace") {
+            if (i + 1 < argc) {
+                simConfig.tracePrefix = argv[++i];
+            }
+        }
+        else if (arg == "--dynamic") {
+            simConfig.dynamicArrivals = true;
+            interactiveMode = false;
+        }
+        else if (arg == "--max-time") {
+            if (i + 1 < argc) {
+                simConfig.maxSimulationTime = std::atoi(argv[++i]);
+            }
+        }
+        else if (arg == "--no-history") {
+            schedConfig.keepTimeline = false;
+            schedConfig.keepProcessMetrics = false;
+        }
+        else if (arg == "--verify-engine") {
+            simConfig.verifyEventEngine = true;
+        }
+        else if (arg == "--policy-engine") {
+            schedConfig.policyEngine = true;
+        }
+        else if (arg == "--headless") {
+            simConfig.headless = true;
+            interactiveMode = false;
+        }
+        else if (arg == "-p" || arg == "--parallel") {
+            simConfig.parallelComparison = true;
+            if (i + 1 < argc && std::isdigit(static_cast<unsigned char>(argv[i + 1][0]))) {
+                simConfig.workerThreads = std::atoi(argv[++i]);
+            }
+        }
+        else if (arg == "--sweep") {
+            sweepMode = true;
+            interactiveMode = false;
+        }
+        else if (arg == "--sweep-random") {
+            if (i + 1 < argc) {
+                sweepOptions.mode = SweepMode::RANDOM;
+                sweepOptions.samples = std::atoi(argv[++i]);
+            }
+        }
+        else if (arg.rfind("--sweep-", 0) == 0) {
+            if (i + 1 < argc && !parseSweepOption(arg, argv[++i], sweepSpace)) {
+                return 1;
+            }
+        }
+        else if (arg == "--seed" && i + 1 < argc) {
+            sweepOptions.seed = static_cast<unsigned int>(std::strtoul(argv[++i], nullptr, 10));
+            benchOptions.seed = sweepOptions.seed;
+            workloadSpec.seed = sweepOptions.seed;
+            customWorkload = true;
+        }
         else if (arg == "--demo") {
             runQuickDemo();
             return 0;
         }
     }
     
+    // Dynamic arrivals share the generator options
+    simConfig.arrivalSpec = workloadSpec;
+    
     // Create simulator
     Simulator simulator;
     simulator.initialize(simConfig, schedConfig);
     simulator.setColorMode(useColor);
     
+    // Progress lines go nowhere in headless mode
+    std::ostream quiet(nullptr);
+    std::ostream& status = headless ? quiet : std::cout;
+    
     // Run in appropriate mode
     if (interactiveMode) {
         // Interactive menu mode
@@ -192,72 +598,169 @@ int main(int argc, char* argv[]) {
     }
     else if (benchmarkMode) {
         // Benchmark mode
-        std::cout << "Starting performance benchmark...\n";
-        simulator.runBenchmark(5);
-        
+        SchedulerType type;
+        if (!algorithm.empty() && algorithm != "all") {
+            if (!parseAlgorithm(algorithm, type)) {
+                std::cerr << "Error: Unknown algorithm '" << algorithm << "'\n";
+                return 1;
+            }
+            benchOptions.algorithms.push_back(type);
+        }
+        status << "Starting performance benchmark...\n";
+        if (!simulator.runBenchmark(benchOptions, outputFile)) {
+            return 1;
+        }
+    }
+    else if (replicaMode) {
+        // Replica mode: K seeded workloads per algorithm, drawn from -n and --seed
+        if (numProcesses <= 0 || !inputFile.empty()) {
+            std::cerr << "Error: --replicas draws its workloads from -n <count> and --seed.\n";
+            return 1;
+        }
+        SchedulerType type;
+        if (!algorithm.empty() && algorithm != "all") {
+            if (!parseAlgorithm(algorithm, type)) {
+                std::cerr << "Error: Unknown algorithm '" << algorithm << "'\n";
+                return 1;
+            }
+            replicaOptions.algorithms.push_back(type);
+        }
+        replicaOptions.workerThreads = simConfig.workerThreads;
+        workloadSpec.count = numProcesses;
+        if (!simulator.runReplicas(workloadSpec, replicaOptions, outputFile)) {
+            return 1;
+        }
+    }
+    else if (streamMode) {
+        // Streaming mode: one algorithm, processes read straight from the file
+        SchedulerType type;
+        if (inputFile.empty() || sweepMode || !parseAlgorithm(algorithm, type)) {
+            std::cerr << "Error: --stream needs -f <file> and a single -a algorithm.\n";
+            return 1;
+        }
+        status << "Streaming processes from " << inputFile << "...\n";
+        if (!simulator.runStreaming(type, inputFile)) {
+            return 1;
+        }
+        if (!outputFile.empty()) {
+            simulator.exportResults(outputFile);
+        }
+        else if (headless) {
+            simulator.writeResults(std::cout);
+        }
+    }
+    else if (!resumeFile.empty()) {
+        // Resume mode: the snapshot holds the type and processes, the options the rest
+        if (!simulator.resumeSnapshot(resumeFile)) {
+            return 1;
+        }
         if (!outputFile.empty()) {
             simulator.exportResults(outputFile);
         }
+        else if (headless) {
+            simulator.writeResults(std::cout);
+        }
     }
     else {
         // Command-line mode
         
         // Load or generate processes
         if (!inputFile.empty()) {
-            std::cout << "Loading processes from " << inputFile << "...\n";
+            status << "Loading processes from " << inputFile << "...\n";
             if (!simulator.loadProcessesFromFile(inputFile)) {
                 std::cerr << "Error: Failed to load processes from file.\n";
                 return 1;
             }
         }
         else if (numProcesses > 0) {
-            std::cout << "Generating " << numProcesses << " random processes...\n";
-            simulator.generateProcesses(numProcesses);
+            status << "Generating " << numProcesses << " random processes...\n";
+            if (!customWorkload) {
+                simulator.generateProcesses(numProcesses);
+            }
+            else {
+                workloadSpec.count = numProcesses;
+                if (!simulator.generateProcesses(workloadSpec)) {
+                    return 1;
+                }
+            }
+        }
+        else if (simConfig.dynamicArrivals) {
+            status << "Starting empty; arrivals are injected until time "
+                      << simConfig.maxSimulationTime << "...\n";
         }
         else {
-            std::cout << "Using sample process set...\n";
+            status << "Using sample process set...\n";
             simulator.setProcesses(createSampleProcesses());
         }
         
         // Run scheduler(s)
-        if (algorithm.empty() || algorithm == "all") {
-            std::cout << "Running comparison of all algorithms...\n";
-            simulator.runComparison();
+        if (!convertFile.empty()) {
+            if (!simulator.saveProcessesToFile(convertFile, true)) {
+                return 1;
+            }
+            status << "Saved binary workload to " << convertFile << "\n";
+            return 0;
         }
-        else {
+        else if (sweepMode) {
             SchedulerType type;
-            
-            if (algorithm == "rr") {
-                type = SchedulerType::ROUND_ROBIN;
-            }
-            else if (algorithm == "pp") {
-                type = SchedulerType::PRIORITY_PREEMPTIVE;
+            if (!algorithm.empty() && algorithm != "all") {
+                if (!parseAlgorithm(algorithm, type)) {
+                    std::cerr << "Error: Unknown algorithm '" << algorithm << "'\n";
+                    return 1;
+                }
+                sweepOptions.algorithms.push_back(type);
             }
-            else if (algorithm == "pnp") {
-                type = SchedulerType::PRIORITY_NON_PREEMPTIVE;
+            sweepOptions.workerThreads = simConfig.workerThreads;
+            return simulator.runSweep(sweepSpace, sweepOptions, outputFile) ? 0 : 1;
+        }
+        else if (pauseAt >= 0) {
+            SchedulerType type;
+            if (!parseAlgorithm(algorithm, type) || snapshotFile.empty() ||
+                simConfig.dynamicArrivals) {
+                std::cerr << "Error: --pause-at needs a single -a algorithm and --snapshot-out <file>,"
+                          << " without --dynamic.\n";
+                return 1;
             }
-            else if (algorithm == "mlq") {
-                type = SchedulerType::MULTILEVEL_QUEUE;
+            if (!simulator.runToSnapshot(type, pauseAt, snapshotFile)) {
+                return 1;
             }
-            else if (algorithm == "mlfq") {
-                type = SchedulerType::MULTILEVEL_FEEDBACK_QUEUE;
+            if (simulator.getResults().empty()) {
+                // Paused; --resume finishes the run
+                return 0;
             }
-            else {
+        }
+        else if (algorithm.empty() || algorithm == "all") {
+            status << "Running comparison of all algorithms...\n";
+            simulator.runComparison();
+        }
+        else {
+            SchedulerType type;
+            
+            if (!parseAlgorithm(algorithm, type)) {
                 std::cerr << "Error: Unknown algorithm '" << algorithm << "'\n";
                 std::cerr << "Use --help for list of supported algorithms.\n";
                 return 1;
             }
             
-            std::cout << "Running " << algorithm << " scheduler...\n";
+            status << "Running " << algorithm << " scheduler...\n";
             simulator.run(type);
         }
         
-        // Export results if requested
+        // Export results if requested; headless runs write them to stdout otherwise
         if (!outputFile.empty()) {
             simulator.exportResults(outputFile);
         }
+        else if (headless) {
+            simulator.writeResults(std::cout);
+        }
         
-        simulator.printSummary();
+        if (!headless) {
+            simulator.printSummary();
+        }
+    }
+    
+    if (headless) {
+        return 0;
     }
     
     std::cout << "\n";
@@ -4,6 +4,7 @@
  */
 
 #include "Process.h"
+#include "ProcessTable.h"
 #include <iostream>
 #include <stdexcept>
 
@@ -114,6 +115,41 @@ void test_reset_functionality() {
     ASSERT_FALSE(p.hasStartedExecution());
 }
 
+void test_process_table_round_trip() {
+    ProcessTable table;
+    table.add(Process(1, 2, 10, 0, "worker"));
+    table.add(Process(2, 1, 4, 3, "worker"));
+    table.add(Process(3, 0, 6, 1));
+    
+    ASSERT_EQ(table.size(), 3u);
+    ASSERT_EQ(table.getName(0), "worker");
+    ASSERT_EQ(table.getName(1), "worker");
+    ASSERT_EQ(table.getName(2), "P3");
+    
+    ASSERT_EQ(table.execute(0, 4), 4);
+    ASSERT_EQ(table.getState(0), ProcessState::RUNNING);
+    ASSERT_EQ(table.execute(1, 8), 4);
+    ASSERT_EQ(table.getState(1), ProcessState::TERMINATED);
+    ASSERT_EQ(table.countUnfinished(), 2u);
+    
+    Process p = table.getProcess(0);
+    ASSERT_EQ(p.getPid(), 1);
+    ASSERT_EQ(p.getRemainingTime(), 6);
+    ASSERT_TRUE(p.hasStartedExecution());
+    
+    table.beginWait(2, 5);
+    table.endWait(2, 8);
+    table.beginWait(2, 10);
+    table.endWait(2, 14);
+    ASSERT_EQ(table.getWaitingTime(2), 7);
+    ASSERT_EQ(table.getWaitingTime(0), 0);
+    
+    table.resetAll();
+    ASSERT_EQ(table.getRemainingTime(1), 4);
+    ASSERT_EQ(table.getState(1), ProcessState::NEW);
+    ASSERT_EQ(table.getWaitingTime(2), 0);
+}
+
 void test_process() {
     std::cout << "  Testing Process class..." << std::endl;
     test_default_constructor();
@@ -127,4 +163,5 @@ void test_process() {
     test_queue_level_management();
     test_priority_modification();
     test_reset_functionality();
+    test_process_table_round_trip();
 }
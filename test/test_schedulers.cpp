@@ -7,9 +7,32 @@
 #include "PriorityScheduler.h"
 #include "MultilevelQueueScheduler.h"
 #include "MultilevelFeedbackQueueScheduler.h"
+#include "Simulator.h"
+#include "ParameterSweep.h"
+#include "WorkloadLoader.h"
+#include "TraceSink.h"
+#include "Benchmark.h"
+#include "WorkloadGenerator.h"
+#include "ArrivalSource.h"
+#include "LevelMask.h"
+#include "ReplicaRunner.h"
+#include "SchedulerEngine.h"
+#include "SchedulerSnapshot.h"
+#include "TimerWheel.h"
+#include "Workload.h"
 #include <iostream>
+#include <fstream>
+#include <cstdio>
+#include <iterator>
 #include <stdexcept>
 #include <vector>
+#include <memory>
+#include <sstream>
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <cstdlib>
+#include <new>
 
 #define ASSERT_EQ(a, b) if ((a) != (b)) throw std::runtime_error("Assertion failed: " #a " != " #b)
 #define ASSERT_TRUE(a) if (!(a)) throw std::runtime_error("Assertion failed: " #a " is not true")
@@ -18,6 +41,24 @@
 #define ASSERT_GE(a, b) if ((a) < (b)) throw std::runtime_error("Assertion failed: " #a " not greater than or equal to " #b)
 #define ASSERT_LE(a, b) if ((a) > (b)) throw std::runtime_error("Assertion failed: " #a " not less than or equal to " #b)
 
+// Heap allocations made while allocationCounting is set (array and nothrow
+// forms go through this operator new; nothing scheduled is over-aligned)
+static size_t allocationCount = 0;
+static bool allocationCounting = false;
+
+void* operator new(std::size_t size) {
+    if (allocationCounting) {
+        allocationCount++;
+    }
+    if (void* p = std::malloc(size == 0 ? 1 : size)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+
 std::vector<Process> createTestProcesses() {
     std::vector<Process> procs;
     procs.emplace_back(1, 2, 10, 0, "P1");
@@ -128,6 +169,1785 @@ void test_edge_cases() {
     ASSERT_EQ(scheduler2.getMetrics().getAvgWaitingTime(), 0.0);
 }
 
+// Event-driven engine must reproduce the tick-based loops exactly
+void test_event_engine_matches_tick() {
+    std::cout << "  Testing event engine against tick-based loops..." << std::endl;
+    std::vector<Process> procs;
+    procs.emplace_back(1, 5, 12, 0);
+    procs.emplace_back(2, 3, 4, 2);
+    procs.emplace_back(3, 8, 9, 3);
+    procs.emplace_back(4, 1, 6, 30);   // arrives after an idle gap
+    procs.emplace_back(5, 9, 15, 31);
+    procs.emplace_back(6, 0, 2, 33);
+    
+    SchedulerConfig config;
+    config.agingThreshold = 3;
+    
+    std::vector<Scheduler*> schedulers;
+    RoundRobinScheduler rr(3, config);
+    PriorityScheduler pp(true, config);
+    PriorityScheduler pnp(false, config);
+    MultilevelQueueScheduler mlq(3, config);
+    MultilevelFeedbackQueueScheduler mlfq(3, config);
+    schedulers = {&rr, &pp, &pnp, &mlq, &mlfq};
+    
+    for (Scheduler* scheduler : schedulers) {
+        scheduler->addProcesses(procs);
+        std::string mismatch;
+        if (!scheduler->verifyEventEngine(&mismatch)) {
+            throw std::runtime_error(mismatch);
+        }
+        ASSERT_EQ(scheduler->getMetrics().getProcessCount(), 6);
+    }
+}
+
+// A process arriving while a context switch is in progress must still run
+void test_round_robin_arrival_during_switch() {
+    std::cout << "  Testing Round Robin arrival during context switch..." << std::endl;
+    RoundRobinScheduler scheduler(4);
+    scheduler.addProcess(Process(1, 0, 4, 0));
+    scheduler.addProcess(Process(2, 0, 4, 0));
+    scheduler.addProcess(Process(3, 0, 2, 5));
+    scheduler.run();
+    
+    ASSERT_TRUE(scheduler.isComplete());
+    for (const auto& p : scheduler.getProcesses()) {
+        ASSERT_GT(p.getCompletionTime(), 0);
+    }
+}
+
+// Late arrivals must join the queue their priority maps to
+void test_multilevel_queue_late_arrival() {
+    std::cout << "  Testing Multilevel Queue late arrival placement..." << std::endl;
+    MultilevelQueueScheduler scheduler(3);
+    scheduler.addProcess(Process(1, 8, 20, 0));   // batch
+    scheduler.addProcess(Process(2, 8, 4, 1));    // batch, arrives later
+    scheduler.run();
+    
+    for (const auto& p : scheduler.getProcesses()) {
+        if (p.getPid() == 2) {
+            // Waits behind P1's second batch slice instead of jumping to the system queue
+            ASSERT_EQ(p.getResponseTime(), 15);
+        }
+    }
+}
+
+// Aging must lift a waiting process above a long-running one
+void test_priority_aging_prevents_starvation() {
+    std::cout << "  Testing Priority aging..." << std::endl;
+    SchedulerConfig config;
+    config.agingThreshold = 3;
+    PriorityScheduler scheduler(true, config);
+    scheduler.addProcess(Process(1, 1, 20, 0));
+    scheduler.addProcess(Process(2, 2, 1, 0));
+    scheduler.run();
+    
+    int p1Done = 0, p2Done = 0;
+    for (const auto& p : scheduler.getProcesses()) {
+        if (p.getPid() == 1) p1Done = p.getCompletionTime();
+        if (p.getPid() == 2) p2Done = p.getCompletionTime();
+    }
+    ASSERT_GT(p1Done, p2Done);
+    ASSERT_LE(p2Done, 10);
+}
+
+// Round Robin must stay fast with thousands of queued processes
+void test_round_robin_many_processes() {
+    std::cout << "  Testing Round Robin with many processes..." << std::endl;
+    RoundRobinScheduler scheduler(2);
+    const int count = 20000;
+    for (int i = 0; i < count; ++i) {
+        scheduler.addProcess(Process(i + 1, 0, 1 + i % 5, i / 4));
+    }
+    scheduler.run();
+    
+    ASSERT_TRUE(scheduler.isComplete());
+    ASSERT_EQ(scheduler.getMetrics().getProcessCount(), count);
+}
+
+// With no switch overhead and every process present from the start,
+// waiting time is turnaround minus burst
+void test_waiting_time_accounting() {
+    std::cout << "  Testing waiting time accounting..." << std::endl;
+    SchedulerConfig config;
+    config.contextSwitchTime = 0;
+    config.timeQuantum = 3;
+    
+    std::vector<std::unique_ptr<Scheduler>> schedulers;
+    schedulers.emplace_back(new PriorityScheduler(true, config));
+    schedulers.emplace_back(new PriorityScheduler(false, config));
+    schedulers.emplace_back(new MultilevelQueueScheduler(3, config));
+    schedulers.emplace_back(new MultilevelFeedbackQueueScheduler(3, config));
+    
+    for (auto& scheduler : schedulers) {
+        scheduler->addProcess(Process(1, 4, 9, 0));
+        scheduler->addProcess(Process(2, 1, 5, 0));
+        scheduler->addProcess(Process(3, 7, 7, 0));
+        scheduler->addProcess(Process(4, 2, 3, 0));
+        scheduler->run();
+        
+        for (const auto& p : scheduler->getProcesses()) {
+            ASSERT_EQ(p.getWaitingTime(), p.getTurnaroundTime() - p.getBurstTime());
+        }
+    }
+}
+
+// A parallel comparison must report exactly what a sequential one does
+void test_parallel_comparison_matches_sequential() {
+    std::cout << "  Testing parallel comparison..." << std::endl;
+    std::vector<Process> procs;
+    for (int i = 0; i < 200; ++i) {
+        procs.emplace_back(i + 1, (i * 7) % 10, 1 + (i * 13) % 17, (i * 5) % 120);
+    }
+    
+    std::string outputs[2];
+    std::vector<Metrics> results[2];
+    for (int mode = 0; mode < 2; ++mode) {
+        SimulationConfig simConfig;
+        simConfig.parallelComparison = (mode == 1);
+        simConfig.workerThreads = 3;
+        Simulator sim;
+        sim.initialize(simConfig);
+        sim.setColorMode(false);
+        sim.setProcesses(procs);
+        
+        std::ostringstream captured;
+        std::streambuf* original = std::cout.rdbuf(captured.rdbuf());
+        sim.runComparison();
+        std::cout.rdbuf(original);
+        
+        outputs[mode] = captured.str();
+        results[mode] = sim.getResults();
+    }
+    
+    ASSERT_EQ(results[0].size(), 6u);
+    ASSERT_TRUE(results[0] == results[1]);
+    ASSERT_TRUE(outputs[0] == outputs[1]);
+}
+
+// Headless runs render nothing and give the same metrics as a normal run
+void test_headless_batch() {
+    std::cout << "  Testing headless batch runs..." << std::endl;
+    std::vector<Process> procs;
+    for (int i = 0; i < 200; ++i) {
+        procs.emplace_back(i + 1, (i * 7) % 10, 1 + (i * 13) % 17, (i * 5) % 120);
+    }
+    
+    Simulator rendered;
+    rendered.setColorMode(false);
+    rendered.setProcesses(procs);
+    std::ostringstream renderedOut;
+    std::streambuf* original = std::cout.rdbuf(renderedOut.rdbuf());
+    rendered.runComparison();
+    std::cout.rdbuf(original);
+    
+    for (int mode = 0; mode < 2; ++mode) {
+        SimulationConfig simConfig;
+        simConfig.headless = true;
+        simConfig.parallelComparison = (mode == 1);
+        simConfig.workerThreads = 3;
+        SchedulerConfig schedConfig;
+        schedConfig.numCpus = 2;
+        Simulator sim;
+        sim.initialize(simConfig, schedConfig);
+        sim.setProcesses(procs);
+        sim.addScheduler(SchedulerType::MULTILEVEL_QUEUE);
+        
+        std::ostringstream captured;
+        original = std::cout.rdbuf(captured.rdbuf());
+        std::vector<RunResult> batch = sim.runBatch();
+        std::cout.rdbuf(original);
+        ASSERT_TRUE(captured.str().empty());
+        ASSERT_EQ(batch.size(), 1u);
+        ASSERT_EQ(batch[0].schedulerName, std::string("Multilevel Queue"));
+        ASSERT_TRUE(batch[0].metrics == rendered.getResults()[3]);
+        ASSERT_TRUE(batch[0].messages.find("simulates a single CPU") != std::string::npos);
+        ASSERT_TRUE(sim.getResults()[0] == batch[0].metrics);
+    }
+    
+    // The CLI paths stay silent too; results come out through writeResults
+    SimulationConfig simConfig;
+    simConfig.headless = true;
+    Simulator sim;
+    sim.initialize(simConfig);
+    sim.setProcesses(procs);
+    std::ostringstream captured;
+    original = std::cout.rdbuf(captured.rdbuf());
+    sim.runComparison();
+    sim.run(SchedulerType::ROUND_ROBIN);
+    std::cout.rdbuf(original);
+    ASSERT_TRUE(captured.str().empty());
+    ASSERT_TRUE(sim.getResults() == std::vector<Metrics>({
+        rendered.getResults()[0], rendered.getResults()[1], rendered.getResults()[2],
+        rendered.getResults()[3], rendered.getResults()[4], rendered.getResults()[5],
+        rendered.getResults()[0]}));
+    
+    std::ostringstream table;
+    sim.writeResults(table);
+    const std::string rows = table.str();
+    ASSERT_EQ(std::count(rows.begin(), rows.end(), '\n'), 8);
+    
+    Simulator empty;
+    empty.initialize(simConfig);
+    empty.addScheduler(SchedulerType::ROUND_ROBIN);
+    ASSERT_TRUE(empty.runBatch().empty());
+}
+
+// Gantt columns merge same-pid runs and downsample long timelines
+void test_gantt_downsampling() {
+    std::cout << "  Testing scalable Gantt rendering..." << std::endl;
+    auto event = [](int pid, int start, int end, EventKind kind) {
+        ExecutionEvent e{pid, start, end, kind};
+        return e;
+    };
+    std::vector<ExecutionEvent> lane = {
+        event(1, 0, 4, EventKind::EXECUTE), event(-1, 4, 5, EventKind::CONTEXT_SWITCH),
+        event(2, 5, 9, EventKind::PREEMPT), event(-1, 9, 9, EventKind::CONTEXT_SWITCH),
+        event(1, 12, 20, EventKind::EXECUTE)
+    };
+    
+    std::vector<GanttBucket> units = Visualizer::bucketTimeline(lane, 0, 20, 20);
+    ASSERT_EQ(units.size(), 20u);
+    ASSERT_EQ(units[3].processId, 1);
+    ASSERT_EQ(units[4].processId, GanttBucket::SWITCH);
+    ASSERT_EQ(units[4].busyFraction, 0.0);
+    ASSERT_EQ(units[8].processId, 2);
+    ASSERT_EQ(units[10].processId, GanttBucket::IDLE);
+    ASSERT_EQ(units[19].busyFraction, 1.0);
+    
+    std::vector<GanttBucket> wide = Visualizer::bucketTimeline(lane, 0, 20, 5);
+    ASSERT_EQ(wide[0].processId, 1);
+    ASSERT_EQ(wide[1].processId, 2);
+    ASSERT_EQ(wide[1].busyFraction, 0.75);
+    ASSERT_EQ(wide[2].processId, GanttBucket::IDLE);
+    ASSERT_EQ(wide[2].busyFraction, 0.25);
+    
+    // Zoomed windows only look at the events they cover
+    std::vector<GanttBucket> zoom = Visualizer::bucketTimeline(lane, 13, 15, 8);
+    for (const GanttBucket& bucket : zoom) {
+        ASSERT_EQ(bucket.processId, 1);
+    }
+    
+    // Crowded columns are sampled: half of every column is switching
+    std::vector<ExecutionEvent> crowded;
+    for (int t = 0; t < 200000; t += 2) {
+        crowded.push_back(event(t % 7, t, t + 1, EventKind::EXECUTE));
+        crowded.push_back(event(-1, t + 1, t + 2, EventKind::CONTEXT_SWITCH));
+    }
+    for (const GanttBucket& bucket : Visualizer::bucketTimeline(crowded, 0, 200000, 40)) {
+        ASSERT_TRUE(bucket.busyFraction > 0.4 && bucket.busyFraction < 0.6);
+    }
+    
+    // Adjacent slices of one pid render as a single labelled run
+    Visualizer view(80, false);
+    std::ostringstream chart;
+    view.setOutputStream(chart);
+    std::vector<ExecutionEvent> merged = {
+        event(3, 0, 4, EventKind::EXECUTE), event(-1, 4, 4, EventKind::CONTEXT_SWITCH),
+        event(3, 4, 8, EventKind::EXECUTE)
+    };
+    view.displayGanttChart(merged);
+    const std::string text = chart.str();
+    ASSERT_EQ(text.find("[P3"), text.rfind("[P3"));
+    
+    // A ten-million-unit run renders in a few lines, one lane per CPU
+    std::vector<ExecutionEvent> smp = {
+        event(1, 0, 10000000, EventKind::EXECUTE), event(2, 0, 5000000, EventKind::EXECUTE)
+    };
+    smp[1].cpu = 1;
+    chart.str("");
+    view.displayGanttChart(smp, 2);
+    const std::string lanes = chart.str();
+    ASSERT_TRUE(lanes.find("CPU0") != std::string::npos);
+    ASSERT_TRUE(lanes.find("CPU1") != std::string::npos);
+    ASSERT_TRUE(lanes.find("10000000") != std::string::npos);
+    ASSERT_TRUE(std::count(lanes.begin(), lanes.end(), '\n') < 12);
+}
+
+// A sweep covers the full grid and gives the same table on any thread count
+void test_parameter_sweep() {
+    std::cout << "  Testing parameter sweep..." << std::endl;
+    std::vector<Process> procs = createTestProcesses();
+    procs.emplace_back(4, 6, 12, 5, "P4");
+    
+    SweepSpace space;
+    space.timeQuantums = {1, 2, 4};
+    space.contextSwitchTimes = {0, 1};
+    space.quantums = {{2, 4, 8}, {1, 3, 9}};
+    
+    SweepOptions options;
+    options.workerThreads = 1;
+    ParameterSweep sequential(procs, SchedulerConfig(), space, options);
+    ASSERT_EQ(sequential.generatePoints().size(), 12u);
+    std::vector<SweepResult> expected = sequential.run();
+    ASSERT_EQ(expected.size(), 72u);
+    
+    options.workerThreads = 4;
+    std::vector<SweepResult> parallel = ParameterSweep(procs, SchedulerConfig(), space, options).run();
+    ASSERT_EQ(parallel.size(), expected.size());
+    for (size_t i = 0; i < expected.size(); ++i) {
+        ASSERT_EQ(parallel[i].point, expected[i].point);
+        ASSERT_TRUE(parallel[i].algorithm == expected[i].algorithm);
+        ASSERT_TRUE(parallel[i].metrics == expected[i].metrics);
+    }
+    
+    // Random sampling is reproducible from the seed
+    options.mode = SweepMode::RANDOM;
+    options.samples = 7;
+    std::vector<SchedulerConfig> a = ParameterSweep(procs, SchedulerConfig(), space, options).generatePoints();
+    std::vector<SchedulerConfig> b = ParameterSweep(procs, SchedulerConfig(), space, options).generatePoints();
+    ASSERT_EQ(a.size(), 7u);
+    for (size_t i = 0; i < a.size(); ++i) {
+        ASSERT_EQ(a[i].timeQuantum, b[i].timeQuantum);
+        ASSERT_TRUE(a[i].quantums == b[i].quantums);
+    }
+}
+
+// Accessors hand out the scheduler's own storage; take* moves it out
+void test_zero_copy_accessors() {
+    std::cout << "  Testing zero-copy accessors..." << std::endl;
+    RoundRobinScheduler scheduler(2);
+    scheduler.addProcess(Process(1, 0, 5, 0));
+    scheduler.addProcess(Process(2, 0, 3, 1));
+    scheduler.run();
+    
+    const std::vector<ExecutionEvent>& timeline = scheduler.getTimeline();
+    ASSERT_TRUE(&timeline == &scheduler.getTimeline());
+    ASSERT_TRUE(&scheduler.getMetrics() == &scheduler.getMetrics());
+    ASSERT_EQ(scheduler.getProcessTable().size(), 2u);
+    
+    const size_t events = timeline.size();
+    ASSERT_GT(events, 0u);
+    std::vector<ExecutionEvent> taken = scheduler.takeTimeline();
+    ASSERT_EQ(taken.size(), events);
+    ASSERT_TRUE(scheduler.getTimeline().empty());
+    
+    const double avgWait = scheduler.getMetrics().getAvgWaitingTime();
+    Metrics moved = scheduler.takeMetrics();
+    ASSERT_EQ(moved.getProcessCount(), 2);
+    ASSERT_EQ(moved.getAvgWaitingTime(), avgWait);
+    ASSERT_EQ(scheduler.getMetrics().getProcessCount(), 0);
+}
+
+// Timeline entries carry a kind; descriptions are built on demand
+void test_timeline_event_kinds() {
+    std::cout << "  Testing timeline event kinds..." << std::endl;
+    ASSERT_TRUE(sizeof(ExecutionEvent) <= 16);
+    
+    RoundRobinScheduler scheduler(2);
+    scheduler.addProcess(Process(1, 0, 3, 0));
+    scheduler.addProcess(Process(2, 0, 2, 6));
+    scheduler.run();
+    
+    // P1 0-2 preempted, P1 2-3 done, idle 3-6, switch 6-7, P2 7-9
+    const std::vector<ExecutionEvent>& timeline = scheduler.getTimeline();
+    ASSERT_EQ(timeline.size(), 5u);
+    ASSERT_TRUE(timeline[0].kind == EventKind::PREEMPT);
+    ASSERT_TRUE(timeline[1].kind == EventKind::EXECUTE);
+    ASSERT_TRUE(timeline[2].kind == EventKind::IDLE);
+    ASSERT_TRUE(timeline[3].isContextSwitch());
+    ASSERT_TRUE(timeline[4].kind == EventKind::EXECUTE);
+    ASSERT_TRUE(timeline[0].describe() == "Preempt P1");
+    ASSERT_TRUE(timeline[2].describe() == "CPU Idle");
+    ASSERT_TRUE(timeline[3].describe() == "Context Switch");
+    ASSERT_TRUE(timeline[4].describe() == "Execute P2");
+    
+    SchedulerConfig config;
+    config.quantums = {2, 4, 8};
+    MultilevelFeedbackQueueScheduler mlfq(3, config);
+    mlfq.addProcess(Process(1, 0, 5, 0));
+    mlfq.run();
+    ASSERT_TRUE(mlfq.getTimeline().front().kind == EventKind::DEMOTE);
+    ASSERT_TRUE(mlfq.getTimeline().back().kind == EventKind::EXECUTE);
+}
+
+// Trace files load the same way whether mapped, streamed or chunked
+void test_workload_loader() {
+    std::cout << "  Testing workload loader..." << std::endl;
+    const char* small = "test_workload_small.tmp";
+    {
+        std::ofstream file(small);
+        file << "PID Priority BurstTime ArrivalTime\n"
+             << "# comment\n"
+             << "1 2 10 0\n"
+             << "2,1,5,+1\r\n"
+             << "\n"
+             << "3 x 8 2\n"
+             << "4 2 4 99999999999\n"
+             << "5\t4 6 4 trailing text";
+    }
+    std::vector<Process> loaded;
+    ASSERT_TRUE(WorkloadLoader::load(small, loaded));
+    ASSERT_EQ(loaded.size(), 3u);
+    ASSERT_EQ(loaded[1].getPid(), 2);
+    ASSERT_EQ(loaded[1].getArrivalTime(), 1);
+    ASSERT_EQ(loaded[2].getPid(), 5);
+    ASSERT_EQ(loaded[2].getArrivalTime(), 4);
+    
+    WorkloadReader reader(small);
+    Process process;
+    for (const auto& expected : loaded) {
+        ASSERT_TRUE(reader.next(process));
+        ASSERT_EQ(process.getPid(), expected.getPid());
+        ASSERT_EQ(process.getBurstTime(), expected.getBurstTime());
+    }
+    ASSERT_FALSE(reader.next(process));
+    std::remove(small);
+    
+    std::vector<Process> missing;
+    ASSERT_FALSE(WorkloadLoader::load("test_workload_missing.tmp", missing));
+    
+    // Large enough to be split across threads
+    const char* large = "test_workload_large.tmp";
+    {
+        std::ofstream file(large);
+        for (int i = 1; i <= 120000; ++i) {
+            file << i << " " << i % 10 << " " << 1 + i % 17 << " " << i / 3 << "\n";
+        }
+    }
+    std::vector<Process> sequential;
+    std::vector<Process> chunked;
+    ASSERT_TRUE(WorkloadLoader::load(large, sequential, 1));
+    ASSERT_TRUE(WorkloadLoader::load(large, chunked, 4));
+    std::remove(large);
+    ASSERT_EQ(sequential.size(), 120000u);
+    ASSERT_EQ(chunked.size(), sequential.size());
+    for (size_t i = 0; i < sequential.size(); ++i) {
+        ASSERT_EQ(chunked[i].getPid(), sequential[i].getPid());
+        ASSERT_EQ(chunked[i].getArrivalTime(), sequential[i].getArrivalTime());
+    }
+}
+
+// Binary workloads round-trip columns and names without text parsing
+void test_binary_workload_round_trip() {
+    std::cout << "  Testing binary workload round trip..." << std::endl;
+    const char* plain = "test_workload_plain.tmp";
+    const char* named = "test_workload_named.tmp";
+    
+    std::vector<Process> procs;
+    for (int i = 1; i <= 50; ++i) {
+        procs.emplace_back(i, i % 7, 1 + i % 9, i / 2);
+    }
+    ASSERT_TRUE(WorkloadLoader::saveBinary(plain, procs));
+    ASSERT_TRUE(WorkloadLoader::isBinary(plain));
+    
+    std::vector<Process> loaded;
+    ASSERT_TRUE(WorkloadLoader::load(plain, loaded));
+    ASSERT_EQ(loaded.size(), procs.size());
+    for (size_t i = 0; i < procs.size(); ++i) {
+        ASSERT_EQ(loaded[i].getPid(), procs[i].getPid());
+        ASSERT_EQ(loaded[i].getPriority(), procs[i].getPriority());
+        ASSERT_EQ(loaded[i].getBurstTime(), procs[i].getBurstTime());
+        ASSERT_EQ(loaded[i].getArrivalTime(), procs[i].getArrivalTime());
+        ASSERT_TRUE(loaded[i].getName() == procs[i].getName());
+    }
+    
+    procs[3] = Process(4, 1, 2, 3, "daemon");
+    ASSERT_TRUE(WorkloadLoader::saveBinary(named, procs));
+    ProcessTable table;
+    ASSERT_TRUE(WorkloadLoader::loadBinary(named, table));
+    ASSERT_EQ(table.size(), procs.size());
+    ASSERT_TRUE(table.getName(3) == "daemon");
+    ASSERT_TRUE(table.getName(4) == "P5");
+    ASSERT_EQ(table.getRemainingTime(3), 2);
+    ASSERT_EQ(table.getState(3), ProcessState::NEW);
+    
+    // Scheduling a binary-loaded table matches scheduling the processes
+    RoundRobinScheduler fromTable(3);
+    fromTable.setProcessTable(table);
+    fromTable.run();
+    RoundRobinScheduler fromProcesses(3);
+    fromProcesses.addProcesses(procs);
+    fromProcesses.run();
+    ASSERT_TRUE(fromTable.getMetrics() == fromProcesses.getMetrics());
+    
+    // A truncated file is rejected
+    {
+        std::ifstream in(named, std::ios::binary);
+        std::string bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+        std::ofstream out(plain, std::ios::binary | std::ios::trunc);
+        out.write(bytes.data(), static_cast<std::streamsize>(bytes.size() / 2));
+    }
+    ProcessTable truncated;
+    std::string error;
+    ASSERT_FALSE(WorkloadLoader::loadBinary(plain, truncated, &error));
+    ASSERT_FALSE(error.empty());
+    
+    std::remove(plain);
+    std::remove(named);
+}
+
+// A sink sees the same events and completions the scheduler would keep
+void test_trace_sink() {
+    std::cout << "  Testing trace sinks..." << std::endl;
+    std::vector<Process> procs;
+    for (int i = 1; i <= 20; ++i) {
+        procs.emplace_back(i, i % 5, 1 + (i * 7) % 11, (i * 3) % 17);
+    }
+    
+    RoundRobinScheduler kept(3);
+    kept.addProcesses(procs);
+    kept.run();
+    
+    std::vector<ExecutionEvent> events;
+    std::vector<CompletionRecord> completions;
+    CallbackTraceSink sink(
+        [&events](const ExecutionEvent& event) { events.push_back(event); },
+        [&completions](const CompletionRecord& record) { completions.push_back(record); });
+    SchedulerConfig config;
+    config.keepTimeline = false;
+    config.keepProcessMetrics = false;
+    RoundRobinScheduler streamed(3, config);
+    streamed.setTraceSink(&sink);
+    streamed.addProcesses(procs);
+    streamed.run();
+    
+    const std::vector<ExecutionEvent>& timeline = kept.getTimeline();
+    ASSERT_TRUE(streamed.getTimeline().empty());
+    ASSERT_EQ(events.size(), timeline.size());
+    for (size_t i = 0; i < timeline.size(); ++i) {
+        ASSERT_EQ(events[i].processId, timeline[i].processId);
+        ASSERT_EQ(events[i].startTime, timeline[i].startTime);
+        ASSERT_EQ(events[i].endTime, timeline[i].endTime);
+        ASSERT_TRUE(events[i].kind == timeline[i].kind);
+    }
+    ASSERT_EQ(completions.size(), procs.size());
+    
+    // Running totals give the same summary as the per-process samples
+    const Metrics& full = kept.getMetrics();
+    const Metrics& summary = streamed.getMetrics();
+    ASSERT_EQ(summary.getProcessCount(), full.getProcessCount());
+    ASSERT_EQ(summary.getAvgWaitingTime(), full.getAvgWaitingTime());
+    ASSERT_EQ(summary.getAvgTurnaroundTime(), full.getAvgTurnaroundTime());
+    ASSERT_EQ(summary.getAvgResponseTime(), full.getAvgResponseTime());
+    ASSERT_EQ(summary.getCpuUtilization(), full.getCpuUtilization());
+    ASSERT_EQ(summary.getMinWaitingTime(), full.getMinWaitingTime());
+    ASSERT_EQ(summary.getMaxWaitingTime(), full.getMaxWaitingTime());
+    double delta = summary.getWaitingTimeVariance() - full.getWaitingTimeVariance();
+    ASSERT_TRUE(delta < 1e-9 && delta > -1e-9);
+    delta = summary.getTurnaroundTimeVariance() - full.getTurnaroundTimeVariance();
+    ASSERT_TRUE(delta < 1e-9 && delta > -1e-9);
+    
+    // The CSV sink writes a header plus one row per record
+    std::ostringstream eventsCsv;
+    std::ostringstream completionsCsv;
+    {
+        CsvTraceSink csv(eventsCsv, completionsCsv, 64);
+        RoundRobinScheduler csvRun(3);
+        csvRun.setTraceSink(&csv);
+        csvRun.addProcesses(procs);
+        csvRun.run();
+    }
+    std::string text = eventsCsv.str();
+    ASSERT_EQ(text.compare(0, 19, "PID,Start,End,Kind\n"), 0);
+    ASSERT_EQ(static_cast<size_t>(std::count(text.begin(), text.end(), '\n')),
+              timeline.size() + 1);
+    text = completionsCsv.str();
+    ASSERT_EQ(static_cast<size_t>(std::count(text.begin(), text.end(), '\n')),
+              procs.size() + 1);
+}
+
+// Online summaries merge exactly; percentiles stay within the sketch error
+void test_streaming_statistics() {
+    std::cout << "  Testing streaming statistics..." << std::endl;
+    RunningStats whole;
+    RunningStats left;
+    RunningStats right;
+    QuantileSketch small;
+    for (int value = 1; value <= 100; ++value) {
+        whole.add(value);
+        (value % 3 == 0 ? left : right).add(value);
+        small.add(value);
+    }
+    left.merge(right);
+    ASSERT_EQ(left.getCount(), whole.getCount());
+    ASSERT_EQ(left.getSum(), whole.getSum());
+    ASSERT_EQ(left.getMin(), 1);
+    ASSERT_EQ(left.getMax(), 100);
+    double delta = left.getVariance() - whole.getVariance();
+    ASSERT_TRUE(delta < 1e-9 && delta > -1e-9);
+    
+    // Small values are counted exactly
+    ASSERT_EQ(small.quantile(0.5), 50);
+    ASSERT_EQ(small.quantile(0.95), 95);
+    ASSERT_EQ(small.quantile(0.99), 99);
+    ASSERT_EQ(small.quantile(1.0), 100);
+    
+    // Large values are within the relative error bound
+    std::vector<int> values;
+    QuantileSketch large;
+    for (int i = 0; i < 5000; ++i) {
+        values.push_back(1000 + (i * 7919) % 200000);
+        large.add(values.back());
+    }
+    std::sort(values.begin(), values.end());
+    for (double fraction : {0.5, 0.95, 0.99, 0.999}) {
+        int exact = values[static_cast<size_t>(fraction * values.size() + 0.999999) - 1];
+        int approx = large.quantile(fraction);
+        ASSERT_TRUE(approx <= exact);
+        ASSERT_TRUE(exact - approx <= exact / 50);
+    }
+    
+    // Merging two runs matches summarising every process at once
+    std::vector<Process> first;
+    std::vector<Process> second;
+    for (int i = 1; i <= 30; ++i) {
+        (i % 2 ? first : second).emplace_back(i, i % 4, 1 + (i * 5) % 13, (i * 3) % 20);
+    }
+    RoundRobinScheduler runA(3);
+    runA.addProcesses(first);
+    runA.run();
+    RoundRobinScheduler runB(3);
+    runB.addProcesses(second);
+    runB.run();
+    const Metrics& a = runA.getMetrics();
+    const Metrics& b = runB.getMetrics();
+    
+    Metrics expected;
+    for (const ProcessTable* table : {&runA.getProcessTable(), &runB.getProcessTable()}) {
+        for (size_t i = 0; i < table->size(); ++i) {
+            expected.addWaitingTime(table->getWaitingTime(i));
+            expected.addTurnaroundTime(table->getTurnaroundTime(i));
+            expected.addResponseTime(table->getResponseTime(i));
+        }
+    }
+    expected.calculateAverages();
+    
+    Metrics merged = a;
+    merged.merge(b);
+    ASSERT_EQ(merged.getProcessCount(), 30);
+    ASSERT_EQ(merged.getAvgWaitingTime(), expected.getAvgWaitingTime());
+    ASSERT_EQ(merged.getAvgResponseTime(), expected.getAvgResponseTime());
+    ASSERT_EQ(merged.getMinWaitingTime(), std::min(a.getMinWaitingTime(), b.getMinWaitingTime()));
+    ASSERT_EQ(merged.getMaxWaitingTime(), std::max(a.getMaxWaitingTime(), b.getMaxWaitingTime()));
+    ASSERT_EQ(merged.getWaitingTimePercentile(0.99), expected.getWaitingTimePercentile(0.99));
+    ASSERT_EQ(merged.getResponseTimePercentile(0.95), expected.getResponseTimePercentile(0.95));
+    delta = merged.getTurnaroundTimeVariance() - expected.getTurnaroundTimeVariance();
+    ASSERT_TRUE(delta < 1e-6 && delta > -1e-6);
+    ASSERT_EQ(merged.getTotalExecutionTime(), a.getTotalExecutionTime() + b.getTotalExecutionTime());
+    ASSERT_EQ(merged.getTotalContextSwitches(),
+              a.getTotalContextSwitches() + b.getTotalContextSwitches());
+}
+
+// Benchmark workloads are reproducible and every run is measured
+void test_benchmark_suite() {
+    std::cout << "  Testing benchmark suite..." << std::endl;
+    ProcessTable first = Benchmark::generateWorkload(200, 7);
+    ProcessTable second = Benchmark::generateWorkload(200, 7);
+    ASSERT_EQ(first.size(), 200u);
+    for (size_t i = 0; i < first.size(); ++i) {
+        ASSERT_EQ(first.getBurstTime(i), second.getBurstTime(i));
+        ASSERT_EQ(first.getArrivalTime(i), second.getArrivalTime(i));
+        ASSERT_EQ(first.getPriority(i), second.getPriority(i));
+    }
+    
+    BenchmarkOptions options;
+    options.sizes = {50, 200};
+    options.warmupRuns = 1;
+    options.iterations = 3;
+    options.algorithms = {SchedulerType::ROUND_ROBIN, SchedulerType::MULTILEVEL_QUEUE};
+    Benchmark benchmark(SchedulerConfig(), options);
+    std::vector<BenchmarkResult> results = benchmark.run();
+    ASSERT_EQ(results.size(), 4u);
+    ASSERT_EQ(results[0].processes, 50);
+    ASSERT_EQ(results[3].processes, 200);
+    
+    // Events match a normal run of the same workload
+    RoundRobinScheduler reference(4);
+    reference.setProcessTable(Benchmark::generateWorkload(50, options.seed));
+    reference.run();
+    ASSERT_EQ(results[0].events, static_cast<long long>(reference.getTimeline().size()));
+    
+    for (const BenchmarkResult& result : results) {
+        ASSERT_EQ(result.wallMs.size(), 3u);
+        ASSERT_TRUE(result.minMs <= result.medianMs);
+        ASSERT_TRUE(result.medianMs <= result.p90Ms);
+        ASSERT_TRUE(result.p99Ms <= result.maxMs);
+        ASSERT_GT(result.events, 0);
+#ifdef __linux__
+        ASSERT_GT(result.peakRssKb, 0);
+#endif
+    }
+    
+    std::ostringstream json;
+    benchmark.writeJson(json, results);
+    ASSERT_TRUE(json.str().find("\"results\": [") != std::string::npos);
+    ASSERT_TRUE(json.str().find("\"algorithm\": \"Multilevel Queue\"") != std::string::npos);
+    
+    bool threw = false;
+    try {
+        options.iterations = 0;
+        Benchmark invalid(SchedulerConfig(), options);
+    } catch (const std::invalid_argument&) {
+        threw = true;
+    }
+    ASSERT_TRUE(threw);
+}
+
+// Replicas are reproducible and stop once the intervals are tight
+void test_replica_runner() {
+    std::cout << "  Testing Monte Carlo replicas and confidence intervals..." << std::endl;
+    auto near = [](double a, double b) { return a - b < 1e-3 && b - a < 1e-3; };
+    ASSERT_TRUE(near(SampleStats::tQuantile(0.975, 1), 12.7062));
+    ASSERT_TRUE(near(SampleStats::tQuantile(0.975, 10), 2.2281));
+    ASSERT_TRUE(near(SampleStats::tQuantile(0.995, 30), 2.7500));
+    ASSERT_TRUE(near(SampleStats::tQuantile(0.025, 1000000), -1.9600));
+    
+    SampleStats whole;
+    SampleStats left;
+    SampleStats right;
+    for (int i = 1; i <= 10; ++i) {
+        whole.add(i * 0.5);
+        (i <= 4 ? left : right).add(i * 0.5);
+    }
+    left.merge(right);
+    ASSERT_TRUE(near(left.getMean(), whole.getMean()));
+    ASSERT_TRUE(near(left.getVariance(), whole.getVariance()));
+    ASSERT_TRUE(near(whole.halfWidth(0.95), 2.2622 * std::sqrt(whole.getVariance() / 10)));
+    
+    WorkloadSpec spec;
+    spec.count = 40;
+    spec.seed = 11;
+    ReplicaOptions options;
+    options.algorithms = {SchedulerType::ROUND_ROBIN, SchedulerType::MULTILEVEL_FEEDBACK_QUEUE};
+    options.minReplicas = 4;
+    options.batchSize = 3;
+    options.maxReplicas = 13;
+    options.targetPrecision = 0.0;
+    options.workerThreads = 1;
+    std::vector<ReplicaResult> sequential = ReplicaRunner(spec, SchedulerConfig(), options).run();
+    options.workerThreads = 4;
+    std::vector<ReplicaResult> parallel = ReplicaRunner(spec, SchedulerConfig(), options).run();
+    ASSERT_EQ(sequential.size(), 2u);
+    for (size_t a = 0; a < sequential.size(); ++a) {
+        ASSERT_EQ(sequential[a].replicas, 13);
+        ASSERT_FALSE(sequential[a].converged);
+        ASSERT_TRUE(sequential[a].pooled == parallel[a].pooled);
+        ASSERT_EQ(sequential[a].waiting.getMean(), parallel[a].waiting.getMean());
+        ASSERT_EQ(sequential[a].pooled.getProcessCount(), 13 * spec.count);
+    }
+    
+    // Replica 0 is the workload the spec itself describes
+    options.maxReplicas = 2;
+    options.minReplicas = 2;
+    options.algorithms = {SchedulerType::ROUND_ROBIN};
+    std::vector<ReplicaResult> pair = ReplicaRunner(spec, SchedulerConfig(), options).run();
+    RoundRobinScheduler first(SchedulerConfig().timeQuantum);
+    first.setProcessTable(WorkloadGenerator(spec).generate());
+    first.run();
+    spec.seed++;
+    RoundRobinScheduler second(SchedulerConfig().timeQuantum);
+    second.setProcessTable(WorkloadGenerator(spec).generate());
+    second.run();
+    spec.seed--;
+    ASSERT_TRUE(near(pair[0].waiting.getMean(), (first.getMetrics().getAvgWaitingTime() +
+                                                 second.getMetrics().getAvgWaitingTime()) / 2));
+    
+    // A loose target stops at the first check, a tight one runs to the limit
+    options.algorithms.clear();
+    options.minReplicas = 6;
+    options.maxReplicas = 30;
+    options.targetPrecision = 10.0;
+    for (const ReplicaResult& result : ReplicaRunner(spec, SchedulerConfig(), options).run()) {
+        ASSERT_EQ(result.replicas, 6);
+        ASSERT_TRUE(result.converged);
+    }
+    options.targetPrecision = 1e-9;
+    for (const ReplicaResult& result : ReplicaRunner(spec, SchedulerConfig(), options).run()) {
+        ASSERT_EQ(result.replicas, 30);
+        ASSERT_FALSE(result.converged);
+    }
+    
+    bool threw = false;
+    try {
+        options.minReplicas = 1;
+        ReplicaRunner invalid(spec, SchedulerConfig(), options);
+    } catch (const std::invalid_argument&) {
+        threw = true;
+    }
+    ASSERT_TRUE(threw);
+}
+
+// Generated workloads are reproducible and follow their distributions
+void test_workload_generator() {
+    std::cout << "  Testing workload generator..." << std::endl;
+    WorkloadSpec spec;
+    spec.count = 50000;
+    spec.seed = 11;
+    spec.chunkSize = 4096;
+    spec.arrivals = ArrivalPattern::POISSON;
+    spec.arrivalRate = 0.5;
+    spec.bursts = BurstDistribution::EXPONENTIAL;
+    spec.burstMean = 8.0;
+    
+    // Same table whatever the thread count
+    ProcessTable serial = WorkloadGenerator(spec).generate();
+    spec.threads = 4;
+    ProcessTable parallel = WorkloadGenerator(spec).generate();
+    ASSERT_EQ(serial.size(), 50000u);
+    ASSERT_EQ(parallel.size(), serial.size());
+    long long burstSum = 0;
+    for (size_t i = 0; i < serial.size(); ++i) {
+        ASSERT_EQ(serial.getPid(i), static_cast<int>(i));
+        ASSERT_EQ(parallel.getArrivalTime(i), serial.getArrivalTime(i));
+        ASSERT_EQ(parallel.getBurstTime(i), serial.getBurstTime(i));
+        ASSERT_EQ(parallel.getPriority(i), serial.getPriority(i));
+        if (i > 0) {
+            ASSERT_GE(serial.getArrivalTime(i), serial.getArrivalTime(i - 1));
+        }
+        ASSERT_GE(serial.getBurstTime(i), 1);
+        burstSum += serial.getBurstTime(i);
+    }
+    // 50000 arrivals at rate 0.5 span about 100000 time units
+    int span = serial.getArrivalTime(serial.size() - 1);
+    ASSERT_TRUE(span > 97000 && span < 103000);
+    double meanBurst = static_cast<double>(burstSum) / serial.size();
+    ASSERT_TRUE(meanBurst > 7.5 && meanBurst < 8.6);
+    
+    // Pareto bursts are heavy-tailed, diurnal arrivals stay ordered
+    spec.bursts = BurstDistribution::PARETO;
+    spec.arrivals = ArrivalPattern::DIURNAL;
+    spec.diurnalPeriod = 1000.0;
+    spec.diurnalAmplitude = 0.9;
+    ProcessTable heavy = WorkloadGenerator(spec).generate();
+    int longest = 0;
+    int peakHalf = 0;
+    for (size_t i = 0; i < heavy.size(); ++i) {
+        longest = std::max(longest, heavy.getBurstTime(i));
+        if (i > 0) {
+            ASSERT_GE(heavy.getArrivalTime(i), heavy.getArrivalTime(i - 1));
+        }
+        // The rate peaks in the first half of each cycle
+        if (heavy.getArrivalTime(i) % 1000 < 500) {
+            peakHalf++;
+        }
+    }
+    ASSERT_GT(longest, 80 * 8);
+    ASSERT_GT(peakHalf, static_cast<int>(heavy.size() * 3 / 4));
+    
+    // Defaults keep the classic uniform bounds
+    WorkloadSpec classic;
+    classic.count = 1000;
+    std::vector<Process> procs = WorkloadGenerator(classic).generateProcesses();
+    ASSERT_EQ(procs.size(), 1000u);
+    for (const Process& p : procs) {
+        ASSERT_TRUE(p.getBurstTime() >= 1 && p.getBurstTime() <= 20);
+        ASSERT_TRUE(p.getArrivalTime() >= 0 && p.getArrivalTime() <= 10);
+        ASSERT_TRUE(p.getPriority() >= 0 && p.getPriority() <= 10);
+    }
+    
+    bool threw = false;
+    try {
+        spec.paretoShape = 1.0;
+        WorkloadGenerator invalid(spec);
+    } catch (const std::invalid_argument&) {
+        threw = true;
+    }
+    ASSERT_TRUE(threw);
+}
+
+void test_dynamic_arrivals() {
+    std::cout << "  Testing dynamic arrivals..." << std::endl;
+    WorkloadSpec spec;
+    spec.count = 1000;
+    spec.seed = 5;
+    spec.chunkSize = 64;
+    spec.arrivals = ArrivalPattern::POISSON;
+    spec.arrivalRate = 0.08;
+    
+    // The lazy stream is generate() chunk by chunk, pids shifted
+    ProcessTable batch = WorkloadGenerator(spec).generate();
+    GeneratedArrivalSource stream(spec, 7);
+    Arrival arrival;
+    for (int pass = 0; pass < 2; ++pass) {
+        for (size_t i = 0; i < batch.size(); ++i) {
+            ASSERT_TRUE(stream.next(arrival));
+            ASSERT_EQ(arrival.pid, static_cast<int>(i) + 7);
+            ASSERT_EQ(arrival.arrivalTime, batch.getArrivalTime(i));
+            ASSERT_EQ(arrival.burstTime, batch.getBurstTime(i));
+            ASSERT_EQ(arrival.priority, batch.getPriority(i));
+        }
+        ASSERT_FALSE(stream.next(arrival));
+        stream.rewind();
+    }
+    
+    // Injecting a workload schedules it exactly as loading it up front;
+    // arrivals are made distinct since Round Robin's table sort is unstable
+    spec.count = 300;
+    ProcessTable generated = WorkloadGenerator(spec).generate();
+    ProcessTable workload;
+    for (size_t i = 0; i < generated.size(); ++i) {
+        workload.add(generated.getPid(i), generated.getPriority(i), generated.getBurstTime(i),
+                     generated.getArrivalTime(i) + static_cast<int>(i));
+    }
+    SchedulerConfig config;
+    const SchedulerType types[] = {
+        SchedulerType::ROUND_ROBIN, SchedulerType::PRIORITY_PREEMPTIVE,
+        SchedulerType::PRIORITY_NON_PREEMPTIVE, SchedulerType::MULTILEVEL_QUEUE,
+        SchedulerType::MULTILEVEL_FEEDBACK_QUEUE
+    };
+    for (SchedulerType type : types) {
+        std::unique_ptr<Scheduler> loaded = Simulator::createScheduler(type, config);
+        loaded->setProcessTable(workload);
+        loaded->run();
+        
+        TableArrivalSource replay(workload);
+        std::unique_ptr<Scheduler> open = Simulator::createScheduler(type, config);
+        open->setArrivalSource(&replay);
+        open->run();
+        ASSERT_EQ(open->getInjectedCount(), workload.size());
+        ASSERT_TRUE(open->getMetrics() == loaded->getMetrics());
+        ASSERT_EQ(open->getTimeline().size(), loaded->getTimeline().size());
+        
+        // Every run starts from the beginning of the source
+        ASSERT_TRUE(open->verifyEventEngine());
+        ASSERT_EQ(open->getProcessTable().size(), workload.size());
+        ASSERT_TRUE(open->getMetrics() == loaded->getMetrics());
+    }
+    
+    // Arrivals stop at the horizon and the admitted processes drain
+    spec.count = INT_MAX;
+    GeneratedArrivalSource open(spec, 3);
+    RoundRobinScheduler rr(4, config);
+    rr.addProcess(Process(0, 1, 30, 0));
+    rr.addProcess(Process(1, 2, 10, 2));
+    rr.addProcess(Process(2, 0, 5, 4));
+    rr.setArrivalSource(&open, 2000);
+    rr.run();
+    const ProcessTable& table = rr.getProcessTable();
+    ASSERT_GT(rr.getInjectedCount(), 100u);
+    ASSERT_EQ(table.size(), rr.getInjectedCount() + 3);
+    for (size_t i = 0; i < table.size(); ++i) {
+        ASSERT_TRUE(table.getArrivalTime(i) <= 2000);
+        ASSERT_TRUE(table.getState(i) == ProcessState::TERMINATED);
+    }
+    ASSERT_EQ(rr.getMetrics().getWaitingStats().getCount(), static_cast<long long>(table.size()));
+    rr.reset();
+    ASSERT_EQ(rr.getProcessTable().size(), 3u);
+    
+    bool threw = false;
+    try {
+        spec.arrivals = ArrivalPattern::UNIFORM;
+        GeneratedArrivalSource unordered(spec);
+    } catch (const std::invalid_argument&) {
+        threw = true;
+    }
+    ASSERT_TRUE(threw);
+}
+
+void test_pid_slots() {
+    std::cout << "  Testing pid slot remapping..." << std::endl;
+    WorkloadSpec spec;
+    spec.count = 400;
+    spec.seed = 9;
+    spec.maxArrival = 600;
+    ProcessTable dense = WorkloadGenerator(spec).generate();
+    
+    // Aging state follows the pid, so sparse pids must schedule identically
+    ProcessTable sparse;
+    for (size_t i = 0; i < dense.size(); ++i) {
+        sparse.add(dense.getPid(i) * 7 + 100000, dense.getPriority(i), dense.getBurstTime(i),
+                   dense.getArrivalTime(i));
+    }
+    SchedulerConfig config;
+    config.agingThreshold = 3;
+    const SchedulerType types[] = {
+        SchedulerType::PRIORITY_PREEMPTIVE, SchedulerType::PRIORITY_NON_PREEMPTIVE,
+        SchedulerType::MULTILEVEL_FEEDBACK_QUEUE
+    };
+    for (SchedulerType type : types) {
+        std::unique_ptr<Scheduler> first = Simulator::createScheduler(type, config);
+        first->setProcessTable(dense);
+        first->run();
+        std::unique_ptr<Scheduler> second = Simulator::createScheduler(type, config);
+        second->setProcessTable(sparse);
+        ASSERT_TRUE(second->verifyEventEngine());
+        ASSERT_TRUE(second->getMetrics() == first->getMetrics());
+    }
+    
+    // Rows sharing a pid share its aging clock, as they shared a map entry
+    PriorityScheduler shared(true, config);
+    shared.addProcess(Process(5, 4, 6, 0));
+    shared.addProcess(Process(5, 4, 6, 1));
+    shared.addProcess(Process(-3, 2, 20, 0));
+    ASSERT_TRUE(shared.verifyEventEngine());
+    ASSERT_EQ(shared.getProcessTable().countUnfinished(), 0u);
+}
+
+void test_deep_queue_levels() {
+    std::cout << "  Testing deep queue hierarchies..." << std::endl;
+    LevelMask mask;
+    mask.reset(5000);
+    ASSERT_TRUE(mask.empty());
+    mask.set(4999);
+    mask.set(139);
+    mask.set(64);
+    ASSERT_EQ(mask.first(), 64);
+    mask.clear(64);
+    ASSERT_EQ(mask.first(), 139);
+    ASSERT_TRUE(mask.test(4999));
+    mask.clear(139);
+    ASSERT_EQ(mask.first(), 4999);
+    mask.clear(4999);
+    ASSERT_EQ(mask.first(), -1);
+    
+    // 140 levels, as in the Linux O(1) scheduler; deep quanta saturate
+    WorkloadSpec spec;
+    spec.count = 300;
+    spec.seed = 17;
+    spec.maxArrival = 2000;
+    spec.minBurst = 50;
+    spec.maxBurst = 400;
+    ProcessTable workload = WorkloadGenerator(spec).generate();
+    SchedulerConfig config;
+    config.timeQuantum = 1;
+    config.agingThreshold = 400;
+    MultilevelFeedbackQueueScheduler mlfq(140, config);
+    mlfq.setProcessTable(workload);
+    ASSERT_TRUE(mlfq.verifyEventEngine());
+    ASSERT_EQ(mlfq.getProcessTable().countUnfinished(), 0u);
+    
+    MultilevelQueueScheduler mlq(140, config);
+    mlq.setProcessTable(workload);
+    ASSERT_TRUE(mlq.verifyEventEngine());
+    ASSERT_EQ(mlq.getProcessTable().countUnfinished(), 0u);
+}
+
+void test_smp_scheduling() {
+    std::cout << "  Testing SMP run queues and load balancing..." << std::endl;
+    SchedulerConfig config;
+    config.numCpus = 2;
+    config.contextSwitchTime = 1;
+    config.migrationCost = 1;
+    
+    // Two processes, two CPUs: both run at once, so the run takes one burst
+    RoundRobinScheduler pair(4, config);
+    pair.addProcess(Process(1, 1, 4, 0));
+    pair.addProcess(Process(2, 1, 4, 0));
+    ASSERT_TRUE(pair.verifyEventEngine());
+    ASSERT_EQ(pair.getMetrics().getTotalExecutionTime(), 4);
+    ASSERT_EQ(pair.getMetrics().getCpuCount(), 2u);
+    ASSERT_EQ(pair.getMetrics().getCpuUtilization(), 100.0);
+    
+    // A higher priority arrival preempts the process on the least-loaded CPU
+    PriorityScheduler preemptive(true, config);
+    preemptive.addProcess(Process(1, 5, 10, 0));
+    preemptive.addProcess(Process(2, 5, 10, 0));
+    preemptive.addProcess(Process(3, 0, 4, 2));
+    ASSERT_TRUE(preemptive.verifyEventEngine());
+    ASSERT_EQ(preemptive.getProcessTable().getResponseTime(2), 1);
+    ASSERT_EQ(preemptive.getTimeline().front().kind, EventKind::PREEMPT);
+    
+    // Every supported policy completes a saturated workload on 8 CPUs
+    WorkloadSpec spec;
+    spec.count = 600;
+    spec.seed = 21;
+    spec.maxArrival = 500;
+    ProcessTable workload = WorkloadGenerator(spec).generate();
+    long long totalBurst = 0;
+    for (size_t i = 0; i < workload.size(); ++i) {
+        totalBurst += workload.getBurstTime(i);
+    }
+    config.numCpus = 8;
+    const SchedulerType types[] = {
+        SchedulerType::ROUND_ROBIN, SchedulerType::PRIORITY_PREEMPTIVE,
+        SchedulerType::PRIORITY_NON_PREEMPTIVE, SchedulerType::MULTILEVEL_FEEDBACK_QUEUE
+    };
+    for (SchedulerType type : types) {
+        std::unique_ptr<Scheduler> scheduler = Simulator::createScheduler(type, config);
+        ASSERT_TRUE(scheduler->supportsSmp());
+        scheduler->setProcessTable(workload);
+        ASSERT_TRUE(scheduler->verifyEventEngine());
+        ASSERT_EQ(scheduler->getProcessTable().countUnfinished(), 0u);
+        const Metrics& metrics = scheduler->getMetrics();
+        ASSERT_EQ(metrics.getCpuCount(), 8u);
+        long long busy = 0;
+        for (size_t cpu = 0; cpu < metrics.getCpuCount(); ++cpu) {
+            busy += metrics.getCpuBusyTimes()[cpu];
+            ASSERT_TRUE(metrics.getCpuUtilization(cpu) > 0.0);
+        }
+        ASSERT_EQ(busy, totalBurst);
+        ASSERT_TRUE(metrics.getContextSwitchOverhead() >=
+                    metrics.getTotalMigrations() * config.migrationCost);
+    }
+    
+    // Every pid is a multiple of 4, so without push migration all work
+    // starts on CPU 0 and only stealing spreads it
+    ProcessTable pinned;
+    for (size_t i = 0; i < workload.size(); ++i) {
+        pinned.add(static_cast<int>(i) * 4, workload.getPriority(i), workload.getBurstTime(i),
+                   workload.getArrivalTime(i));
+    }
+    config.numCpus = 4;
+    config.pushMigration = false;
+    config.workStealing = false;
+    RoundRobinScheduler isolated(4, config);
+    isolated.setProcessTable(pinned);
+    isolated.run();
+    ASSERT_EQ(isolated.getMetrics().getCpuBusyTimes()[0], totalBurst);
+    ASSERT_EQ(isolated.getMetrics().getTotalMigrations(), 0);
+    
+    config.workStealing = true;
+    RoundRobinScheduler stealing(4, config);
+    stealing.setProcessTable(pinned);
+    ASSERT_TRUE(stealing.verifyEventEngine());
+    ASSERT_GT(stealing.getMetrics().getTotalMigrations(), 0);
+    ASSERT_GT(stealing.getMetrics().getCpuBusyTimes()[3], 0);
+    ASSERT_TRUE(stealing.getMetrics().getTotalExecutionTime() <
+                isolated.getMetrics().getTotalExecutionTime());
+    
+    // Merged runs on the same CPU count add up per CPU
+    Metrics merged = stealing.getMetrics();
+    merged.merge(stealing.getMetrics());
+    ASSERT_EQ(merged.getCpuBusyTimes()[3], 2 * stealing.getMetrics().getCpuBusyTimes()[3]);
+    ASSERT_EQ(merged.getCpuUtilization(), stealing.getMetrics().getCpuUtilization());
+    
+    // Policies without an SMP mode keep simulating one CPU
+    MultilevelQueueScheduler single(3, config);
+    single.setProcessTable(workload);
+    single.run();
+    ASSERT_FALSE(single.supportsSmp());
+    ASSERT_EQ(single.getMetrics().getCpuCount(), 1u);
+}
+
+void test_scheduler_engine() {
+    std::cout << "  Testing policy-composed scheduler engine..." << std::endl;
+    
+    // Each classic type and its engine instantiation give the same schedule
+    WorkloadSpec spec;
+    spec.count = 400;
+    spec.seed = 29;
+    spec.maxArrival = 1500;
+    ProcessTable workload = WorkloadGenerator(spec).generate();
+    const SchedulerType types[] = {
+        SchedulerType::ROUND_ROBIN, SchedulerType::PRIORITY_PREEMPTIVE,
+        SchedulerType::PRIORITY_NON_PREEMPTIVE, SchedulerType::MULTILEVEL_QUEUE,
+        SchedulerType::MULTILEVEL_FEEDBACK_QUEUE
+    };
+    for (int contextSwitch : {0, 2}) {
+        for (bool eventDriven : {true, false}) {
+            SchedulerConfig config;
+            config.contextSwitchTime = contextSwitch;
+            config.eventDriven = eventDriven;
+            config.agingThreshold = 7;
+            for (SchedulerType type : types) {
+                std::unique_ptr<Scheduler> classic = Simulator::createScheduler(type, config);
+                config.policyEngine = true;
+                std::unique_ptr<Scheduler> engine = Simulator::createScheduler(type, config);
+                config.policyEngine = false;
+                ASSERT_EQ(engine->getName(), classic->getName());
+                ASSERT_TRUE(engine->getType() == type);
+                ASSERT_FALSE(engine->supportsSmp());
+                
+                classic->setProcessTable(workload);
+                classic->run();
+                engine->setProcessTable(workload);
+                engine->run();
+                ASSERT_TRUE(engine->getMetrics() == classic->getMetrics());
+                const std::vector<ExecutionEvent>& expected = classic->getTimeline();
+                const std::vector<ExecutionEvent>& actual = engine->getTimeline();
+                ASSERT_EQ(actual.size(), expected.size());
+                for (size_t i = 0; i < actual.size(); ++i) {
+                    ASSERT_EQ(actual[i].processId, expected[i].processId);
+                    ASSERT_EQ(actual[i].startTime, expected[i].startTime);
+                    ASSERT_EQ(actual[i].endTime, expected[i].endTime);
+                    ASSERT_TRUE(actual[i].kind == expected[i].kind);
+                }
+            }
+        }
+    }
+    
+    // Injected arrivals grow the policies' state as they do the classes'
+    SchedulerConfig config;
+    config.agingThreshold = 7;
+    for (SchedulerType type : types) {
+        TableArrivalSource replay(workload);
+        std::unique_ptr<Scheduler> classic = Simulator::createScheduler(type, config);
+        classic->setArrivalSource(&replay);
+        classic->run();
+        std::unique_ptr<Scheduler> engine = createEngineScheduler(type, config);
+        engine->setArrivalSource(&replay);
+        ASSERT_TRUE(engine->verifyEventEngine());
+        ASSERT_EQ(engine->getInjectedCount(), workload.size());
+        ASSERT_TRUE(engine->getMetrics() == classic->getMetrics());
+    }
+    
+    // New compositions: the textbook SJF and SRTF example
+    config.contextSwitchTime = 0;
+    ShortestJobEngine sjf("Shortest Job First", SchedulerType::SHORTEST_JOB_FIRST, config);
+    ShortestRemainingEngine srtf("Shortest Remaining Time",
+                                 SchedulerType::SHORTEST_REMAINING_TIME, config);
+    for (Scheduler* scheduler : std::vector<Scheduler*>{&sjf, &srtf}) {
+        scheduler->addProcess(Process(1, 0, 8, 0));
+        scheduler->addProcess(Process(2, 0, 4, 1));
+        scheduler->addProcess(Process(3, 0, 9, 2));
+        scheduler->addProcess(Process(4, 0, 5, 3));
+        ASSERT_TRUE(scheduler->verifyEventEngine());
+    }
+    ASSERT_EQ(sjf.getMetrics().getAvgWaitingTime(), 7.75);
+    ASSERT_EQ(srtf.getMetrics().getAvgWaitingTime(), 6.5);
+    ASSERT_EQ(srtf.getTimeline().front().endTime, 1);
+    ASSERT_TRUE(srtf.getTimeline().front().kind == EventKind::PREEMPT);
+    
+    // SRTF never waits longer on average than SJF, on any workload
+    std::unique_ptr<Scheduler> shortest =
+        Simulator::createScheduler(SchedulerType::SHORTEST_JOB_FIRST, config);
+    std::unique_ptr<Scheduler> remaining =
+        Simulator::createScheduler(SchedulerType::SHORTEST_REMAINING_TIME, config);
+    shortest->setProcessTable(workload);
+    remaining->setProcessTable(workload);
+    ASSERT_TRUE(shortest->verifyEventEngine());
+    ASSERT_TRUE(remaining->verifyEventEngine());
+    ASSERT_EQ(remaining->getProcessTable().countUnfinished(), 0u);
+    ASSERT_LE(remaining->getMetrics().getAvgWaitingTime(),
+              shortest->getMetrics().getAvgWaitingTime());
+}
+
+// The fair scheduler shares the CPU by weight within the target latency
+void test_fair_scheduler() {
+    std::cout << "  Testing fair (CFS) scheduler..." << std::endl;
+    
+    // Equal weights split the target latency evenly and alternate
+    SchedulerConfig config;
+    config.contextSwitchTime = 0;
+    std::unique_ptr<Scheduler> fair = Simulator::createScheduler(SchedulerType::FAIR, config);
+    ASSERT_EQ(fair->getName(), std::string("Fair (CFS)"));
+    ASSERT_TRUE(fair->getType() == SchedulerType::FAIR);
+    fair->addProcess(Process(1, 0, 30, 0));
+    fair->addProcess(Process(2, 0, 30, 0));
+    ASSERT_TRUE(fair->verifyEventEngine());
+    const std::vector<ExecutionEvent>& even = fair->getTimeline();
+    ASSERT_EQ(even[0].processId, 1);
+    ASSERT_EQ(even[0].endTime, 10);
+    ASSERT_TRUE(even[0].kind == EventKind::PREEMPT);
+    ASSERT_TRUE(even[1].kind == EventKind::CONTEXT_SWITCH);
+    ASSERT_EQ(even[2].processId, 2);
+    ASSERT_EQ(even[2].endTime, 20);
+    
+    // Priority 0 weighs 1024 and priority 5 weighs 335: about a quarter of
+    // the CPU goes to the lighter process while both are runnable
+    std::unique_ptr<Scheduler> weighted = Simulator::createScheduler(SchedulerType::FAIR, config);
+    weighted->addProcess(Process(1, 0, 1000, 0));
+    weighted->addProcess(Process(2, 5, 1000, 0));
+    weighted->run();
+    int heavyDone = 0;
+    for (const ExecutionEvent& event : weighted->getTimeline()) {
+        if (event.processId == 1) {
+            heavyDone = event.endTime;
+        }
+    }
+    int lightShare = 0;
+    for (const ExecutionEvent& event : weighted->getTimeline()) {
+        if (event.processId == 2 && event.endTime <= heavyDone) {
+            lightShare += event.endTime - event.startTime;
+        }
+    }
+    ASSERT_GE(lightShare, 300);
+    ASSERT_LE(lightShare, 360);
+    
+    // A crowded queue stretches the period so no slice is below the granularity
+    std::unique_ptr<Scheduler> crowded = Simulator::createScheduler(SchedulerType::FAIR, config);
+    for (int pid = 1; pid <= 40; ++pid) {
+        crowded->addProcess(Process(pid, 0, 50, 0));
+    }
+    crowded->run();
+    ASSERT_EQ(crowded->getTimeline().front().endTime, 2);
+    
+    // Late arrivals start at the minimum vruntime and everything completes
+    WorkloadSpec spec;
+    spec.count = 400;
+    spec.seed = 31;
+    spec.maxArrival = 1500;
+    ProcessTable workload = WorkloadGenerator(spec).generate();
+    config.contextSwitchTime = 1;
+    std::unique_ptr<Scheduler> loaded = Simulator::createScheduler(SchedulerType::FAIR, config);
+    loaded->setProcessTable(workload);
+    ASSERT_TRUE(loaded->verifyEventEngine());
+    ASSERT_EQ(loaded->getProcessTable().countUnfinished(), 0u);
+    TableArrivalSource replay(workload);
+    std::unique_ptr<Scheduler> injected = Simulator::createScheduler(SchedulerType::FAIR, config);
+    injected->setArrivalSource(&replay);
+    ASSERT_TRUE(injected->verifyEventEngine());
+    ASSERT_EQ(injected->getInjectedCount(), workload.size());
+    ASSERT_EQ(injected->getProcessTable().countUnfinished(), 0u);
+    
+    bool threw = false;
+    try {
+        config.minGranularity = 0;
+        Simulator::createScheduler(SchedulerType::FAIR, config);
+    } catch (const std::invalid_argument&) {
+        threw = true;
+    }
+    ASSERT_TRUE(threw);
+}
+
+// Profiling builds count each phase; other builds leave the counters at 0
+void test_run_stats() {
+    std::cout << "  Testing run statistics..." << std::endl;
+    
+    RunStats first;
+    first.counter(RunPhase::SELECTION).calls = 3;
+    first.counter(RunPhase::SELECTION).nanoseconds = 500;
+    first.events = 10;
+    first.runNanoseconds = 2000;
+    first.peakRunnable = 4;
+    first.runs = 1;
+    RunStats second = first;
+    second.peakRunnable = 9;
+    second.peakDeadlines = 2;
+    first.merge(second);
+    ASSERT_EQ(first.counter(RunPhase::SELECTION).calls, 6u);
+    ASSERT_EQ(first.phaseNanoseconds(), 1000u);
+    ASSERT_EQ(first.peakRunnable, 9u);
+    ASSERT_EQ(first.peakDeadlines, 2u);
+    ASSERT_EQ(first.runs, 2);
+    ASSERT_GT(first.eventsPerSecond(), 4.999e6);
+    ASSERT_LE(first.eventsPerSecond(), 5.001e6);
+    ASSERT_EQ(first.share(RunPhase::SELECTION), 0.25);
+    ASSERT_EQ(std::string(RunStats::phaseName(RunPhase::TIMELINE)), std::string("timeline"));
+    
+    WorkloadSpec spec;
+    spec.count = 300;
+    spec.seed = 37;
+    spec.maxArrival = 1200;
+    ProcessTable workload = WorkloadGenerator(spec).generate();
+    SchedulerConfig config;
+    config.agingThreshold = 7;
+    for (bool engine : {false, true}) {
+        config.policyEngine = engine;
+        for (SchedulerType type : {SchedulerType::ROUND_ROBIN, SchedulerType::PRIORITY_PREEMPTIVE,
+                                   SchedulerType::MULTILEVEL_QUEUE,
+                                   SchedulerType::MULTILEVEL_FEEDBACK_QUEUE}) {
+            std::unique_ptr<Scheduler> scheduler = Simulator::createScheduler(type, config);
+            scheduler->setProcessTable(workload);
+            scheduler->run();
+            const RunStats& stats = scheduler->getRunStats();
+            if (!RunStats::enabled) {
+                ASSERT_EQ(stats.events, 0u);
+                ASSERT_EQ(stats.runs, 0);
+                ASSERT_EQ(stats.phaseNanoseconds(), 0u);
+                continue;
+            }
+            ASSERT_EQ(stats.runs, 1);
+            ASSERT_EQ(stats.events, scheduler->getTimeline().size());
+            ASSERT_EQ(stats.counter(RunPhase::TIMELINE).calls, stats.events);
+            ASSERT_EQ(stats.counter(RunPhase::METRICS).calls, 1u);
+            ASSERT_GT(stats.counter(RunPhase::ADMISSION).calls, 0u);
+            ASSERT_GT(stats.counter(RunPhase::SELECTION).calls, 0u);
+            ASSERT_GE(stats.runNanoseconds, stats.phaseNanoseconds());
+            ASSERT_GE(stats.peakRunnable, 1u);
+            ASSERT_LE(stats.peakRunnable, workload.size());
+            ASSERT_EQ(stats.runnable, 0u);
+            if (type == SchedulerType::PRIORITY_PREEMPTIVE ||
+                type == SchedulerType::MULTILEVEL_FEEDBACK_QUEUE) {
+                ASSERT_GT(stats.counter(RunPhase::DEADLINES).calls, 0u);
+                ASSERT_GT(stats.peakDeadlines, 0u);
+            }
+        }
+    }
+    
+    // SMP runs count the same phases
+    config.policyEngine = false;
+    config.numCpus = 4;
+    std::unique_ptr<Scheduler> smp =
+        Simulator::createScheduler(SchedulerType::ROUND_ROBIN, config);
+    smp->setProcessTable(workload);
+    smp->run();
+    ASSERT_EQ(smp->getRunStats().runnable, 0u);
+    ASSERT_EQ(smp->getRunStats().counter(RunPhase::SELECTION).calls > 0, RunStats::enabled);
+    
+    BenchmarkOptions options;
+    options.sizes = {200};
+    options.iterations = 2;
+    options.warmupRuns = 0;
+    options.algorithms = {SchedulerType::MULTILEVEL_QUEUE};
+    Benchmark benchmark(SchedulerConfig(), options);
+    std::vector<BenchmarkResult> results = benchmark.run();
+    ASSERT_EQ(results[0].profile.runs, RunStats::enabled ? 2 : 0);
+    std::ostringstream json;
+    benchmark.writeJson(json, results);
+    ASSERT_EQ(json.str().find("\"profile\": {") != std::string::npos, RunStats::enabled);
+}
+
+void test_scheduler_snapshots() {
+    std::cout << "  Testing scheduler snapshots..." << std::endl;
+    
+    // Pausing, saving and resuming gives the uninterrupted run
+    WorkloadSpec spec;
+    spec.count = 250;
+    spec.seed = 41;
+    spec.maxArrival = 1000;
+    ProcessTable workload = WorkloadGenerator(spec).generate();
+    SchedulerConfig config;
+    config.agingThreshold = 6;
+    for (SchedulerType type : {SchedulerType::ROUND_ROBIN, SchedulerType::PRIORITY_PREEMPTIVE,
+                               SchedulerType::PRIORITY_NON_PREEMPTIVE,
+                               SchedulerType::MULTILEVEL_QUEUE,
+                               SchedulerType::MULTILEVEL_FEEDBACK_QUEUE, SchedulerType::FAIR,
+                               SchedulerType::SHORTEST_JOB_FIRST,
+                               SchedulerType::SHORTEST_REMAINING_TIME}) {
+        std::unique_ptr<Scheduler> whole = createEngineScheduler(type, config);
+        whole->setProcessTable(workload);
+        whole->run();
+        
+        std::unique_ptr<Scheduler> first = createEngineScheduler(type, config);
+        ASSERT_TRUE(first->supportsSnapshots());
+        first->setProcessTable(workload);
+        ASSERT_FALSE(first->runUntil(400));
+        ASSERT_GE(first->getCurrentTime(), 400);
+        std::stringstream file;
+        ASSERT_TRUE(first->snapshot().write(file));
+        
+        SchedulerSnapshot loaded;
+        std::string error;
+        ASSERT_TRUE(SchedulerSnapshot::read(file, loaded, &error));
+        std::unique_ptr<Scheduler> second = createEngineScheduler(type, config);
+        ASSERT_FALSE(second->resume(loaded, 700));
+        ASSERT_TRUE(second->resume(second->snapshot()));
+        ASSERT_TRUE(second->getMetrics() == whole->getMetrics());
+        const std::vector<ExecutionEvent>& expected = whole->getTimeline();
+        const std::vector<ExecutionEvent>& actual = second->getTimeline();
+        ASSERT_EQ(actual.size(), expected.size());
+        for (size_t i = 0; i < actual.size(); ++i) {
+            ASSERT_EQ(actual[i].processId, expected[i].processId);
+            ASSERT_EQ(actual[i].startTime, expected[i].startTime);
+            ASSERT_EQ(actual[i].endTime, expected[i].endTime);
+            ASSERT_TRUE(actual[i].kind == expected[i].kind);
+        }
+    }
+    
+    // The rest of a run follows the resuming scheduler's configuration
+    std::unique_ptr<Scheduler> paused =
+        createEngineScheduler(SchedulerType::MULTILEVEL_FEEDBACK_QUEUE, config);
+    paused->setProcessTable(workload);
+    paused->runUntil(300);
+    const SchedulerSnapshot saved = paused->snapshot();
+    SchedulerConfig wider = config;
+    wider.timeQuantum = 9;
+    wider.numQueues = 2;
+    wider.agingThreshold = 20;
+    std::unique_ptr<Scheduler> resumed =
+        createEngineScheduler(SchedulerType::MULTILEVEL_FEEDBACK_QUEUE, wider);
+    ASSERT_TRUE(resumed->resume(saved));
+    const ProcessTable& finished = resumed->getProcessTable();
+    ASSERT_EQ(finished.size(), workload.size());
+    ASSERT_EQ(finished.countUnfinished(), 0u);
+    for (size_t i = 0; i < finished.size(); ++i) {
+        ASSERT_LE(finished.getQueueLevel(i), 1);
+    }
+    for (const ExecutionEvent& event : resumed->getTimeline()) {
+        if (event.startTime >= saved.currentTime && event.processId != -1) {
+            ASSERT_LE(event.endTime - event.startTime, 18);
+        }
+    }
+    
+    // Snapshots only go back into their own type, and only of paused runs
+    bool threw = false;
+    try {
+        createEngineScheduler(SchedulerType::ROUND_ROBIN, config)->resume(saved);
+    } catch (const std::invalid_argument&) {
+        threw = true;
+    }
+    ASSERT_TRUE(threw);
+    threw = false;
+    try {
+        resumed->snapshot();
+    } catch (const std::logic_error&) {
+        threw = true;
+    }
+    ASSERT_TRUE(threw);
+    threw = false;
+    try {
+        RoundRobinScheduler classic(4, config);
+        classic.runUntil(10);
+    } catch (const std::logic_error&) {
+        threw = true;
+    }
+    ASSERT_TRUE(threw);
+    
+    std::stringstream junk("not a snapshot at all, just some text");
+    SchedulerSnapshot rejected;
+    std::string error;
+    ASSERT_FALSE(SchedulerSnapshot::read(junk, rejected, &error));
+    ASSERT_FALSE(error.empty());
+    std::stringstream whole;
+    saved.write(whole);
+    std::stringstream truncated(whole.str().substr(0, whole.str().size() / 2));
+    ASSERT_FALSE(SchedulerSnapshot::read(truncated, rejected, &error));
+}
+
+void test_io_bursts() {
+    std::cout << "  Testing I/O bursts..." << std::endl;
+    
+    // Bursts must lie inside the CPU time, in order
+    Process checked(1, 0, 10, 0);
+    ASSERT_FALSE(checked.addIoBurst(0, 5));
+    ASSERT_FALSE(checked.addIoBurst(10, 5));
+    ASSERT_FALSE(checked.addIoBurst(3, 0));
+    ASSERT_TRUE(checked.addIoBurst(3, 5));
+    ASSERT_FALSE(checked.addIoBurst(3, 2));
+    ASSERT_TRUE(checked.addIoBurst(7, 2));
+    ASSERT_EQ(checked.getIoTime(), 7);
+    
+    // The wheel fires in time order, FIFO within a time, across growth
+    TimerWheel wheel(4);
+    wheel.schedule(0, 20);
+    wheel.schedule(1, 5);
+    wheel.schedule(2, 20);
+    wheel.schedule(3, 7);
+    ASSERT_EQ(wheel.size(), 4u);
+    ASSERT_EQ(wheel.nextTime(), 5);
+    std::vector<int> fired;
+    wheel.expire(7, [&fired](int id) { fired.push_back(id); });
+    ASSERT_TRUE(fired == std::vector<int>({1, 3}));
+    ASSERT_EQ(wheel.nextTime(), 20);
+    wheel.schedule(1, 9);
+    wheel.expire(100, [&fired](int id) { fired.push_back(id); });
+    ASSERT_TRUE(fired == std::vector<int>({1, 3, 1, 0, 2}));
+    ASSERT_TRUE(wheel.empty());
+    ASSERT_EQ(wheel.nextTime(), INT_MAX);
+    
+    // P1 blocks after 3 and 7, P2 after 2; the CPU runs others meanwhile
+    std::vector<Process> procs = {Process(1, 2, 10, 0), Process(2, 1, 6, 1),
+                                  Process(3, 3, 8, 2)};
+    procs[0].addIoBurst(3, 5);
+    procs[0].addIoBurst(7, 2);
+    procs[1].addIoBurst(2, 4);
+    SchedulerConfig config;
+    config.timeQuantum = 4;
+    RoundRobinEngine rr("Round Robin", SchedulerType::ROUND_ROBIN, config);
+    ASSERT_TRUE(rr.supportsIo());
+    rr.addProcesses(procs);
+    ASSERT_FALSE(rr.runUntil(13));
+    ASSERT_TRUE(rr.getProcessTable().getState(0) == ProcessState::WAITING);
+    ASSERT_TRUE(rr.getProcessTable().getState(1) == ProcessState::READY);
+    rr.run();
+    const std::vector<ExecutionEvent>& timeline = rr.getTimeline();
+    ASSERT_TRUE(timeline[0].kind == EventKind::BLOCK);
+    ASSERT_EQ(timeline[0].endTime, 3);
+    ASSERT_EQ(rr.getCurrentTime(), 30);
+    const ProcessTable& done = rr.getProcessTable();
+    for (size_t i = 0; i < done.size(); ++i) {
+        // Time blocked is not time waiting
+        ASSERT_EQ(done.getWaitingTime(i), done.getTurnaroundTime(i) - done.getBurstTime(i) -
+                                          done.getIoTime(i));
+    }
+    ASSERT_EQ(done.getWaitingTime(0), 13);
+    
+    // Generated I/O keeps the CPU columns and does not depend on threads
+    WorkloadSpec spec;
+    spec.count = 300;
+    spec.seed = 17;
+    spec.maxArrival = 600;
+    spec.chunkSize = 64;
+    const ProcessTable cpuOnly = WorkloadGenerator(spec).generate();
+    spec.ioShare = 0.5;
+    spec.ioCpuMean = 3.0;
+    spec.ioMean = 6.0;
+    const ProcessTable workload = WorkloadGenerator(spec).generate();
+    spec.threads = 4;
+    const ProcessTable threaded = WorkloadGenerator(spec).generate();
+    ASSERT_TRUE(workload.hasIo());
+    size_t withIo = 0;
+    for (size_t i = 0; i < workload.size(); ++i) {
+        ASSERT_EQ(workload.getBurstTime(i), cpuOnly.getBurstTime(i));
+        ASSERT_EQ(workload.getArrivalTime(i), cpuOnly.getArrivalTime(i));
+        ASSERT_EQ(workload.getIoBurstCount(i), threaded.getIoBurstCount(i));
+        ASSERT_EQ(workload.getIoTime(i), threaded.getIoTime(i));
+        withIo += workload.getIoBurstCount(i) > 0 ? 1 : 0;
+    }
+    ASSERT_GT(withIo, 50u);
+    
+    // Every engine type blocks the same way event-driven and ticked, and
+    // resumes a snapshot taken with processes blocked
+    size_t pendingWakeups = 0;
+    for (SchedulerType type : {SchedulerType::ROUND_ROBIN, SchedulerType::PRIORITY_PREEMPTIVE,
+                               SchedulerType::PRIORITY_NON_PREEMPTIVE,
+                               SchedulerType::MULTILEVEL_QUEUE,
+                               SchedulerType::MULTILEVEL_FEEDBACK_QUEUE, SchedulerType::FAIR,
+                               SchedulerType::SHORTEST_JOB_FIRST,
+                               SchedulerType::SHORTEST_REMAINING_TIME}) {
+        std::unique_ptr<Scheduler> verified = createEngineScheduler(type, config);
+        verified->setProcessTable(workload);
+        ASSERT_TRUE(verified->verifyEventEngine());
+        std::unique_ptr<Scheduler> whole = createEngineScheduler(type, config);
+        whole->setProcessTable(workload);
+        whole->run();
+        const ProcessTable& table = whole->getProcessTable();
+        for (size_t i = 0; i < table.size(); ++i) {
+            ASSERT_TRUE(table.getState(i) == ProcessState::TERMINATED);
+            ASSERT_GE(table.getTurnaroundTime(i), table.getBurstTime(i) + table.getIoTime(i));
+        }
+        
+        std::unique_ptr<Scheduler> first = createEngineScheduler(type, config);
+        first->setProcessTable(workload);
+        ASSERT_FALSE(first->runUntil(500));
+        const SchedulerSnapshot saved = first->snapshot();
+        pendingWakeups += saved.wakeups.size();
+        std::stringstream file;
+        ASSERT_TRUE(saved.write(file));
+        SchedulerSnapshot loaded;
+        ASSERT_TRUE(SchedulerSnapshot::read(file, loaded));
+        ASSERT_EQ(loaded.wakeups.size(), saved.wakeups.size());
+        std::unique_ptr<Scheduler> second = createEngineScheduler(type, config);
+        ASSERT_TRUE(second->resume(loaded));
+        ASSERT_TRUE(second->getMetrics() == whole->getMetrics());
+        ASSERT_EQ(second->getTimeline().size(), whole->getTimeline().size());
+    }
+    ASSERT_GT(pendingWakeups, 0u);
+    
+    // Text and binary workloads carry the bursts
+    const char* text = "test_workload_io.tmp";
+    const char* binary = "test_workload_io_bin.tmp";
+    {
+        std::ofstream out(text);
+        out << "PID Priority BurstTime ArrivalTime\n"
+            << "1 2 10 0 3:5 7:2\n"
+            << "2 1 6 1 2:4 note\n"
+            << "3 3 8 2\n";
+    }
+    std::vector<Process> parsed;
+    ASSERT_TRUE(WorkloadLoader::load(text, parsed));
+    ASSERT_EQ(parsed.size(), 3u);
+    ASSERT_EQ(parsed[0].getIoBursts().size(), 2u);
+    ASSERT_EQ(parsed[0].getIoBursts()[1].after, 7);
+    ASSERT_EQ(parsed[1].getIoTime(), 4);
+    ASSERT_TRUE(parsed[2].getIoBursts().empty());
+    ASSERT_TRUE(WorkloadLoader::saveBinary(binary, parsed));
+    std::vector<Process> reloaded;
+    ASSERT_TRUE(WorkloadLoader::load(binary, reloaded));
+    ASSERT_EQ(reloaded.size(), parsed.size());
+    for (size_t i = 0; i < parsed.size(); ++i) {
+        ASSERT_EQ(reloaded[i].getIoBursts().size(), parsed[i].getIoBursts().size());
+        ASSERT_EQ(reloaded[i].getIoTime(), parsed[i].getIoTime());
+    }
+    std::remove(text);
+    std::remove(binary);
+    
+    // Pausing on or just after an I/O completion leaves due wakeups in the
+    // snapshot; resuming fires them as the uninterrupted run did
+    spec.count = 30;
+    spec.maxArrival = 60;
+    spec.ioShare = 0.7;
+    spec.ioMean = 6;
+    const ProcessTable blocking = WorkloadGenerator(spec).generate();
+    ASSERT_TRUE(blocking.hasIo());
+    bool dueAtPause = false;
+    bool dueBeforePause = false;
+    for (SchedulerType type : {SchedulerType::ROUND_ROBIN, SchedulerType::MULTILEVEL_FEEDBACK_QUEUE,
+                               SchedulerType::FAIR, SchedulerType::SHORTEST_REMAINING_TIME}) {
+        std::unique_ptr<Scheduler> uninterrupted = createEngineScheduler(type, config);
+        uninterrupted->setProcessTable(blocking);
+        uninterrupted->run();
+        const std::vector<ExecutionEvent>& expected = uninterrupted->getTimeline();
+        for (int pause = 1; pause < uninterrupted->getCurrentTime(); ++pause) {
+            std::unique_ptr<Scheduler> first = createEngineScheduler(type, config);
+            first->setProcessTable(blocking);
+            if (first->runUntil(pause)) {
+                continue;  // The last slice runs past the pause time
+            }
+            const SchedulerSnapshot saved = first->snapshot();
+            for (const SimEvent& wakeup : saved.wakeups) {
+                dueAtPause = dueAtPause || wakeup.time == saved.currentTime;
+                dueBeforePause = dueBeforePause || wakeup.time < saved.currentTime;
+            }
+            std::stringstream file;
+            ASSERT_TRUE(saved.write(file));
+            SchedulerSnapshot loaded;
+            ASSERT_TRUE(SchedulerSnapshot::read(file, loaded));
+            std::unique_ptr<Scheduler> second = createEngineScheduler(type, config);
+            ASSERT_TRUE(second->resume(loaded));
+            ASSERT_TRUE(second->getMetrics() == uninterrupted->getMetrics());
+            const std::vector<ExecutionEvent>& actual = second->getTimeline();
+            ASSERT_EQ(actual.size(), expected.size());
+            for (size_t i = 0; i < actual.size(); ++i) {
+                ASSERT_EQ(actual[i].processId, expected[i].processId);
+                ASSERT_EQ(actual[i].startTime, expected[i].startTime);
+                ASSERT_EQ(actual[i].endTime, expected[i].endTime);
+                ASSERT_TRUE(actual[i].kind == expected[i].kind);
+            }
+        }
+    }
+    ASSERT_TRUE(dueAtPause);
+    ASSERT_TRUE(dueBeforePause);
+}
+
+// Schedulers share one immutable workload and rerun it without allocating
+void test_shared_workloads() {
+    std::cout << "  Testing shared workloads..." << std::endl;
+    WorkloadSpec spec;
+    spec.count = 300;
+    spec.seed = 23;
+    spec.maxArrival = 900;
+    const ProcessTable table = WorkloadGenerator(spec).generate();
+    const std::shared_ptr<const Workload> shared = std::make_shared<const Workload>(table);
+    ASSERT_EQ(shared->size(), table.size());
+    
+    for (int engine = 0; engine < 2; ++engine) {
+        for (SchedulerType type : {SchedulerType::ROUND_ROBIN, SchedulerType::PRIORITY_PREEMPTIVE,
+                                   SchedulerType::PRIORITY_NON_PREEMPTIVE,
+                                   SchedulerType::MULTILEVEL_QUEUE,
+                                   SchedulerType::MULTILEVEL_FEEDBACK_QUEUE, SchedulerType::FAIR,
+                                   SchedulerType::SHORTEST_JOB_FIRST,
+                                   SchedulerType::SHORTEST_REMAINING_TIME}) {
+            SchedulerConfig config;
+            config.policyEngine = (engine == 1);
+            config.agingThreshold = 8;
+            
+            // The first run matches a scheduler given its own copy
+            std::unique_ptr<Scheduler> copied = Simulator::createScheduler(type, config);
+            copied->setProcessTable(table);
+            copied->run();
+            std::unique_ptr<Scheduler> scheduler = Simulator::createScheduler(type, config);
+            scheduler->setWorkload(shared);
+            scheduler->run();
+            ASSERT_TRUE(scheduler->getMetrics() == copied->getMetrics());
+            
+            // Aged priorities and sorted rows do not leak into the rerun, and a
+            // rerun of a grown scheduler allocates nothing
+            scheduler->run();
+            allocationCount = 0;
+            allocationCounting = true;
+            scheduler->run();
+            allocationCounting = false;
+            ASSERT_TRUE(scheduler->getMetrics() == copied->getMetrics());
+            ASSERT_EQ(allocationCount, 0u);
+            scheduler->reset();
+            ASSERT_TRUE(scheduler->getWorkload() == shared);
+            ASSERT_EQ(scheduler->getProcessTable().size(), shared->size());
+        }
+    }
+    
+    // No run changed the workload
+    const ProcessTable& kept = shared->getTable();
+    for (size_t i = 0; i < table.size(); ++i) {
+        ASSERT_EQ(kept.getPid(i), table.getPid(i));
+        ASSERT_EQ(kept.getPriority(i), table.getPriority(i));
+        ASSERT_EQ(kept.getRemainingTime(i), table.getBurstTime(i));
+        ASSERT_TRUE(kept.getState(i) == ProcessState::NEW);
+    }
+    
+    // Changing the processes detaches the workload
+    RoundRobinScheduler detached(4);
+    detached.setWorkload(shared);
+    detached.addProcess(Process(9999, 0, 5, 0));
+    ASSERT_TRUE(detached.getWorkload() == nullptr);
+    ASSERT_EQ(detached.getProcessTable().size(), shared->size() + 1);
+    
+    // The simulator hands its workload to every scheduler
+    Simulator sim;
+    sim.setWorkload(shared);
+    sim.addScheduler(SchedulerType::ROUND_ROBIN);
+    sim.addScheduler(SchedulerType::MULTILEVEL_FEEDBACK_QUEUE);
+    const std::vector<RunResult> first = sim.runBatch();
+    const std::vector<RunResult> second = sim.runBatch();
+    ASSERT_EQ(first.size(), 2u);
+    for (size_t i = 0; i < first.size(); ++i) {
+        ASSERT_TRUE(first[i].metrics == second[i].metrics);
+        ASSERT_EQ(first[i].metrics.getProcessCount(), static_cast<int>(shared->size()));
+    }
+}
+
 void test_schedulers() {
     test_round_robin();
     test_priority_scheduler();
@@ -135,4 +1955,33 @@ void test_schedulers() {
     test_multilevel_feedback_queue();
     test_metrics();
     test_edge_cases();
+    test_event_engine_matches_tick();
+    test_round_robin_arrival_during_switch();
+    test_multilevel_queue_late_arrival();
+    test_priority_aging_prevents_starvation();
+    test_round_robin_many_processes();
+    test_waiting_time_accounting();
+    test_parallel_comparison_matches_sequential();
+    test_parameter_sweep();
+    test_zero_copy_accessors();
+    test_timeline_event_kinds();
+    test_workload_loader();
+    test_binary_workload_round_trip();
+    test_trace_sink();
+    test_streaming_statistics();
+    test_benchmark_suite();
+    test_workload_generator();
+    test_dynamic_arrivals();
+    test_pid_slots();
+    test_deep_queue_levels();
+    test_smp_scheduling();
+    test_replica_runner();
+    test_headless_batch();
+    test_gantt_downsampling();
+    test_scheduler_engine();
+    test_fair_scheduler();
+    test_run_stats();
+    test_scheduler_snapshots();
+    test_io_bursts();
+    test_shared_workloads();
 }